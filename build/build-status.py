@@ -0,0 +1,8 @@
+#! /usr/bin/env python3
+
+# Programs that are runnable.
+ns3_runnable_programs = ['build/scratch/ns3-dev-tc-bench-debug', 'build/scratch/ns3-dev-anim-bench-debug', 'build/scratch/ns3-dev-dsr-bench-debug', 'build/scratch/ns3-dev-drr-debug', 'build/scratch/subdir/ns3-dev-subdir-debug', 'build/scratch/ns3-dev-sqlite-bench-debug', 'build/scratch/ns3-dev-tsa-bench-debug', 'build/scratch/ns3-dev-olsr-bench-debug', 'build/scratch/ns3-dev-scratch-simulator-debug']
+
+# Scripts that are runnable.
+ns3_runnable_scripts = []
+
@@ -0,0 +1,135 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2021
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef FQ_FLOW_TABLE_H
+#define FQ_FLOW_TABLE_H
+
+#include "ns3/ptr.h"
+#include <vector>
+
+namespace ns3 {
+
+class QueueDiscClass;
+
+/**
+ * \ingroup traffic-control
+ *
+ * \brief The flow queues of a flow queueing (FQ-CoDel like) queue disc
+ *
+ * The table has one slot per flow queue index, holding the flow queue (once
+ * created), the tag used by the set associative hash and the links of the
+ * intrusive lists of new and old flows. Looking up a flow queue, and adding
+ * or removing a flow queue to/from the head or the tail of a list, take
+ * constant time and never allocate memory.
+ *
+ * A flow queue is active when it belongs to either list.
+ */
+class FqFlowTable
+{
+public:
+  /// The lists of active flow queues
+  enum FlowList
+  {
+    NEW_FLOWS = 0,
+    OLD_FLOWS
+  };
+
+  FqFlowTable ();
+
+  /**
+   * Remove all the flow queues and size the table for the given number of
+   * flow queues.
+   *
+   * \param nFlows the number of flow queues
+   */
+  void Reset (uint32_t nFlows);
+  /**
+   * Remove all the flow queues and release the slots, e.g., when the queue
+   * disc owning the table is disposed.
+   */
+  void Clear (void);
+  /**
+   * Compute the index of the flow queue for the flow having the given hash,
+   * according to the set associative hash approach, and tag the flow queue
+   * with the hash of the flow.
+   *
+   * \param flowHash the hash of the flow 5-tuple
+   * \param setWays the size of a set of flow queues
+   * \return the index of the flow queue for the given flow
+   */
+  uint32_t SetAssociativeHash (uint32_t flowHash, uint32_t setWays);
+  /**
+   * \param index the index of a flow queue
+   * \return the flow queue, or a null pointer if it has not been created yet
+   */
+  Ptr<QueueDiscClass> GetFlow (uint32_t index) const;
+  /**
+   * \param index the index of a flow queue
+   * \param flow the flow queue
+   */
+  void SetFlow (uint32_t index, Ptr<QueueDiscClass> flow);
+  /**
+   * \param index the index of a flow queue
+   * \return true if the flow queue belongs to either list
+   */
+  bool IsActive (uint32_t index) const;
+  /**
+   * \param list the list
+   * \return true if the list is empty
+   */
+  bool IsEmpty (FlowList list) const;
+  /**
+   * \param list the (non-empty) list
+   * \return the index of the flow queue at the head of the list
+   */
+  uint32_t GetFront (FlowList list) const;
+  /**
+   * Remove the flow queue at the head of the given (non-empty) list.
+   *
+   * \param list the list
+   */
+  void PopFront (FlowList list);
+  /**
+   * Add the given (inactive) flow queue at the tail of the given list.
+   *
+   * \param list the list
+   * \param index the index of the flow queue
+   */
+  void PushBack (FlowList list, uint32_t index);
+
+private:
+  /// A slot of the table
+  struct Slot
+  {
+    Slot ();
+
+    Ptr<QueueDiscClass> flow;  //!< the flow queue
+    uint32_t tag;              //!< the hash of the flow last mapped to this slot
+    bool tagged;               //!< whether the tag is set
+    bool active;               //!< whether the flow queue belongs to a list
+    uint32_t next;             //!< the index of the next flow queue in the list
+  };
+
+  std::vector<Slot> m_slots;  //!< the slots, indexed by flow queue index
+  uint32_t m_head[2];         //!< the index of the first flow queue of each list
+  uint32_t m_tail[2];         //!< the index of the last flow queue of each list
+};
+
+} // namespace ns3
+
+#endif /* FQ_FLOW_TABLE_H */
@@ -0,0 +1,143 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2021
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef OUTSTANDING_MPDU_BUFFER_H
+#define OUTSTANDING_MPDU_BUFFER_H
+
+#include <vector>
+#include "ns3/ptr.h"
+
+namespace ns3 {
+
+class WifiMacQueueItem;
+
+/**
+ * \ingroup wifi
+ *
+ * The set of MPDUs transmitted under a Block Ack agreement that are waiting
+ * for an acknowledgment. MPDUs are stored in a ring buffer indexed by their
+ * sequence number modulo the buffer size, so that storing, acknowledging and
+ * discarding an MPDU take constant time. All the fragments of an MSDU share
+ * the slot of their sequence number.
+ *
+ * The buffer is sized to the span of the stored sequence numbers (initially
+ * the size of a legacy Block Ack window) and doubles, up to the size of the
+ * sequence number space, whenever an MPDU falls outside of the current span.
+ */
+class OutstandingMpduBuffer
+{
+public:
+  OutstandingMpduBuffer ();
+
+  /**
+   * Make room for the given number of consecutive sequence numbers (typically
+   * the transmit window size), so that the buffer does not need to grow.
+   *
+   * \param size the number of consecutive sequence numbers
+   */
+  void Reserve (std::size_t size);
+  /**
+   * Store the given MPDU, unless an MPDU with the same sequence number and
+   * fragment number is already stored.
+   *
+   * \param mpdu the MPDU to store
+   * \return true if the MPDU has been stored
+   */
+  bool Insert (Ptr<WifiMacQueueItem> mpdu);
+  /**
+   * Remove all the MPDUs (fragments) having the given sequence number.
+   *
+   * \param seq the sequence number
+   */
+  void Remove (uint16_t seq);
+  /**
+   * Remove the MPDU having the same sequence number and fragment number as
+   * the given MPDU, if any.
+   *
+   * \param mpdu the MPDU to remove
+   */
+  void Remove (Ptr<const WifiMacQueueItem> mpdu);
+  /**
+   * Remove all the MPDUs whose sequence number lies in the given range,
+   * taking wrap around into account.
+   *
+   * \param startSeq the first sequence number of the range
+   * \param endSeq the last sequence number of the range
+   */
+  void RemoveRange (uint16_t startSeq, uint16_t endSeq);
+  /**
+   * Remove all the MPDUs.
+   */
+  void Clear (void);
+  /**
+   * \return true if no MPDU is stored
+   */
+  bool IsEmpty (void) const;
+  /**
+   * \return the number of distinct sequence numbers of the stored MPDUs
+   */
+  std::size_t GetNSequenceNumbers (void) const;
+  /**
+   * Get the stored MPDUs sorted in increasing order of distance of their
+   * sequence number from the given starting sequence number, and by increasing
+   * fragment number for the same sequence number.
+   *
+   * \param startingSeq the starting sequence number
+   * \return the sorted stored MPDUs
+   */
+  std::vector<Ptr<WifiMacQueueItem>> GetMpdus (uint16_t startingSeq) const;
+
+private:
+  /// The fragments stored for a sequence number, by increasing fragment number
+  typedef std::vector<Ptr<WifiMacQueueItem>> Slot;
+
+  /**
+   * \param seq a sequence number
+   * \return the slot where the MPDUs with the given sequence number are stored
+   */
+  Slot& GetSlot (uint16_t seq);
+  /**
+   * \param seq a sequence number
+   * \return true if the MPDUs with the given sequence number are stored
+   */
+  bool IsStored (uint16_t seq) const;
+  /**
+   * Rebuild the ring buffer with a size that is a power of two not less than
+   * the given one.
+   *
+   * \param size the minimum size of the ring buffer
+   */
+  void Resize (std::size_t size);
+  /**
+   * Empty the slot of the given sequence number, which was stored until now,
+   * and shrink the span of the stored sequence numbers, if possible.
+   *
+   * \param seq the sequence number
+   */
+  void ClearSlot (uint16_t seq);
+
+  std::vector<Slot> m_slots; //!< the ring buffer
+  std::size_t m_mask;        //!< the size of the ring buffer minus one
+  uint16_t m_first;          //!< the first stored sequence number
+  std::size_t m_span;        //!< the number of sequence numbers from the first to the last stored one
+  std::size_t m_nSeqs;       //!< the number of stored sequence numbers
+};
+
+} //namespace ns3
+
+#endif /* OUTSTANDING_MPDU_BUFFER_H */
@@ -0,0 +1,256 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2012 Centre Tecnologic de Telecomunicacions de Catalunya (CTTC)
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Nicola Baldo <nbaldo@cttc.es>
+ */
+
+
+#ifndef RADIO_ENVIRONMENT_MAP_HELPER_H
+#define RADIO_ENVIRONMENT_MAP_HELPER_H
+
+
+#include <ns3/object.h>
+#include <ns3/core-config.h>
+#include <ns3/vector.h>
+#include <fstream>
+#include <map>
+#include <vector>
+
+#ifdef HAVE_PTHREAD_H
+#include <ns3/system-mutex.h>
+#endif
+
+
+namespace ns3 {
+
+class RemSpectrumPhy;
+class Node;
+class NetDevice;
+class SpectrumChannel;
+class SpectrumValue;
+class SpectrumPhy;
+class PropagationLossModel;
+class SpectrumPropagationLossModel;
+class AntennaModel;
+struct SpectrumSignalParameters;
+//class BuildingsMobilityModel;
+class MobilityModel;
+
+/** 
+ * \ingroup lte
+ *
+ * Generates a 2D map of the SINR from the strongest transmitter in the
+ * downlink of an LTE FDD system. For instructions on usage, please refer to
+ * the User Documentation.
+ *
+ * By default, the map is generated by deploying RemSpectrumPhy listeners,
+ * MaxPointsPerIteration at a time, and letting the simulator deliver the
+ * signals of the eNBs to them. When the DirectEvaluation attribute is
+ * true, the helper instead records the last frame sent by each eNB on the
+ * channel, and computes the SINR of every point by calling the
+ * propagation loss models of the channel directly, with the same
+ * formulas. The rows of the map (points with the same x coordinate) are
+ * then evaluated by NumThreads threads, and written to the output file in
+ * order as soon as they are complete.
+ *
+ * \warning With NumThreads greater than 1, the propagation loss models of
+ * the channel are called concurrently. This is only safe for the models
+ * that compute the loss from the positions alone (e.g., Friis, LogDistance,
+ * Cost231, OkumuraHata), not for the models that keep per-link state or
+ * draw random variables, such as the buildings-aware or the fading models.
+ * When there are buildings, the map is always evaluated by a single thread.
+ */
+class RadioEnvironmentMapHelper : public Object
+{
+public:  
+
+  RadioEnvironmentMapHelper ();
+  virtual ~RadioEnvironmentMapHelper ();
+  
+  // inherited from Object
+  virtual void DoDispose (void);
+  /**
+   *  Register this type.
+   *  \return The object TypeId.
+   */
+  static TypeId GetTypeId (void);
+
+  /** 
+   * \return the bandwidth (in num of RBs) over which SINR is calculated
+   */
+  uint16_t GetBandwidth () const;
+
+  /** 
+   *
+   * \param bw  the bandwidth (in num of RBs) over which SINR is calculated
+   */
+  void SetBandwidth (uint16_t bw);
+
+  /** 
+   * Deploy the RemSpectrumPhy objects that generate the map according to the specified settings.
+   * 
+   */
+  void Install ();
+
+private:
+
+  /**
+   * Scheduled by Install() to perform the actual generation of map.
+   *
+   * If control channel is used for SINR calculation (the default), the delay
+   * is 2.6 milliseconds from the start of simulation. Otherwise, if data
+   * channel is used, the delay is 500.1 milliseconds from the start of
+   * simulation.
+   *
+   * The method will divide the whole map into parts (each contains at most a
+   * certain number of SINR listening points), and then call RunOneIteration()
+   * on each part, one by one.
+   */
+  void DelayedInstall ();
+
+  /**
+   * Mobilize all the listeners to a specified area. Afterwards, schedule a
+   * call to PrintAndReset() in 0.5 milliseconds.
+   *
+   * \param xMin X coordinate of the first SINR listening point to deploy.
+   * \param xMax X coordinate of the last SINR listening point to deploy.
+   * \param yMin Y coordinate of the first SINR listening point to deploy.
+   * \param yMax Y coordinate of the last SINR listening point to deploy.
+   */
+  void RunOneIteration (double xMin, double xMax, double yMin, double yMax);
+
+  /// Go through every listener, write the computed SINR, and then reset it.
+  void PrintAndReset ();
+
+  /// Called when the map generation procedure has been completed.
+  void Finalize ();
+
+  /**
+   * Record the last DL frame (control or data, according to
+   * `UseDataChannel`) sent by each transmitter on the channel, for the
+   * direct evaluation of the map.
+   *
+   * \param params the parameters of the transmitted signal
+   */
+  void RecordTx (Ptr<SpectrumSignalParameters> params);
+
+  /**
+   * Generate the whole map from the frames recorded by RecordTx, without
+   * running the simulator.
+   */
+  void EvaluateDirectly ();
+
+  /**
+   * Evaluate the rows of the map not taken by another thread yet, and
+   * write them to the output file in order. Run by each thread started by
+   * EvaluateDirectly, or by the main thread if there is only one.
+   */
+  void EvaluateRows ();
+
+  /// A transmitter, for the direct evaluation of the map.
+  struct DirectTx
+  {
+    Vector position;             ///< Position of the transmitter.
+    Ptr<AntennaModel> antenna;   ///< Transmit antenna, if any.
+    Ptr<SpectrumValue> psd;      ///< Transmitted PSD, in the spectrum model of the map.
+    double power;                ///< Transmitted power over the RBs of the map.
+  };
+
+  /**
+   * The objects owned by one thread of the direct evaluation, so that the
+   * threads do not share reference-counted objects, which are not
+   * thread-safe.
+   */
+  struct DirectWorker
+  {
+    std::vector<Ptr<MobilityModel> > txMobility;  ///< Copies of the mobility of the transmitters.
+    std::vector<Ptr<SpectrumValue> > txPsd;       ///< Copies of the PSD of the transmitters.
+    Ptr<MobilityModel> rxMobility;                ///< Position of the current point.
+  };
+
+  /// A complete Radio Environment Map is composed of many of this structure.
+  struct RemPoint 
+  {
+    /// Simplified listener which compute SINR over the DL channel.
+    Ptr<RemSpectrumPhy> phy;
+    /// Position of the listener in the environment.
+    Ptr<MobilityModel> bmm;
+  };
+
+  /// List of listeners in the environment.
+  std::list<RemPoint> m_rem;
+
+  double m_xMin;   ///< The `XMin` attribute.
+  double m_xMax;   ///< The `XMax` attribute.
+  uint16_t m_xRes; ///< The `XRes` attribute.
+  double m_xStep;  ///< Distance along X axis between adjacent listening points.
+
+  double m_yMin;   ///< The `YMin` attribute.
+  double m_yMax;   ///< The `YMax` attribute.
+  uint16_t m_yRes; ///< The `YRes` attribute.
+  double m_yStep;  ///< Distance along Y axis between adjacent listening points.
+
+  uint32_t m_maxPointsPerIteration;  ///< The `MaxPointsPerIteration` attribute.
+
+  uint16_t m_earfcn;     ///< The `Earfcn` attribute.
+  uint16_t m_bandwidth;  ///< The `Bandwidth` attribute.
+ 
+  double m_z;  ///< The `Z` attribute.
+
+  std::string m_channelPath;  ///< The `ChannelPath` attribute.
+  std::string m_outputFile;   ///< The `OutputFile` attribute.
+
+  bool m_stopWhenDone;   ///< The `StopWhenDone` attribute.
+  
+  /// The channel object taken from the `ChannelPath` attribute.
+  Ptr<SpectrumChannel> m_channel;
+
+  double m_noisePower;  ///< The `NoisePower` attribute.
+
+  std::ofstream m_outFile;  ///< Stream the output to a file.
+
+  bool m_useDataChannel;  ///< The `UseDataChannel` attribute.
+  int32_t m_rbId;         ///< The `RbId` attribute.
+
+  bool m_directEvaluation;  ///< The `DirectEvaluation` attribute.
+  uint32_t m_numThreads;    ///< The `NumThreads` attribute.
+
+  /// Last frame sent by each transmitter, recorded by RecordTx.
+  std::map<const SpectrumPhy *, Ptr<SpectrumSignalParameters> > m_recordedTxs;
+  std::vector<DirectTx> m_directTxs;          ///< Transmitters of the direct evaluation.
+  std::vector<DirectWorker> m_directWorkers;  ///< Objects of each thread of the direct evaluation.
+  std::vector<double> m_xs;                   ///< X coordinates of the rows of the map.
+  std::vector<double> m_ys;                   ///< Y coordinates of the points of a row.
+  double m_maxLossDb;                         ///< The `MaxLossDb` of the channel.
+  Ptr<PropagationLossModel> m_propagationLoss;                  ///< The propagation loss model of the channel.
+  Ptr<SpectrumPropagationLossModel> m_spectrumPropagationLoss;  ///< The spectrum propagation loss model of the channel.
+  bool m_hasBuildings;                        ///< Whether the points must be located in the buildings.
+  uint32_t m_nextWorker;                      ///< Index of the next thread to start.
+  uint32_t m_nextRow;                         ///< Index of the next row to evaluate.
+  uint32_t m_nextRowToWrite;                  ///< Index of the next row to write.
+  /// Evaluated rows waiting for the previous ones to be written.
+  std::map<uint32_t, std::vector<double> > m_completedRows;
+#ifdef HAVE_PTHREAD_H
+  SystemMutex m_directMutex;  ///< Protects the state shared by the threads.
+#endif
+
+}; // end of `class RadioEnvironmentMapHelper`
+
+
+} // end of `namespace ns3`
+
+#endif /* RADIO_ENVIRONMENT_MAP_HELPER_H */
@@ -0,0 +1,401 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2021
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef RING_BUFFER_H
+#define RING_BUFFER_H
+
+#include <vector>
+#include <iterator>
+#include <cstddef>
+#include <type_traits>
+#include "ns3/assert.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup network
+ *
+ * \brief A sequence container storing its elements in a contiguous,
+ * growable circular buffer.
+ *
+ * The interface is a subset of the std::list interface, so that a queue can
+ * store its items in either container (see DropTailQueue). Adding or removing
+ * an element at either end takes constant time and only allocates memory
+ * when the buffer is full, in which case its capacity doubles. Inserting or
+ * erasing in the middle moves the elements on the shorter side of the
+ * position.
+ *
+ * Unlike std::list, iterators are positions: inserting or erasing an element
+ * invalidates the iterators to the elements that follow it, and growing the
+ * buffer invalidates all the iterators.
+ */
+template <typename T>
+class RingBuffer
+{
+private:
+  /**
+   * \brief An iterator over the elements of a RingBuffer.
+   * \tparam Const whether the iterator gives read-only access
+   */
+  template <bool Const>
+  class IteratorImpl
+  {
+  public:
+    /// Iterator category
+    typedef std::bidirectional_iterator_tag iterator_category;
+    /// Element type
+    typedef T value_type;
+    /// Difference type
+    typedef std::ptrdiff_t difference_type;
+    /// Pointer type
+    typedef typename std::conditional<Const, const T*, T*>::type pointer;
+    /// Reference type
+    typedef typename std::conditional<Const, const T&, T&>::type reference;
+    /// Container type
+    typedef typename std::conditional<Const, const RingBuffer*, RingBuffer*>::type container;
+
+    IteratorImpl ()
+      : m_buffer (0),
+        m_index (0)
+    {
+    }
+    /**
+     * \param buffer the ring buffer
+     * \param index the position in the ring buffer
+     */
+    IteratorImpl (container buffer, std::size_t index)
+      : m_buffer (buffer),
+        m_index (index)
+    {
+    }
+    /**
+     * Convert an iterator into a const iterator.
+     * \param other the iterator to convert
+     */
+    template <bool C = Const, typename = typename std::enable_if<C>::type>
+    IteratorImpl (const IteratorImpl<false>& other)
+      : m_buffer (other.m_buffer),
+        m_index (other.m_index)
+    {
+    }
+
+    /// \return a reference to the element
+    reference operator* () const
+    {
+      return m_buffer->At (m_index);
+    }
+    /// \return a pointer to the element
+    pointer operator-> () const
+    {
+      return &m_buffer->At (m_index);
+    }
+    /// \return this iterator, moved to the next element
+    IteratorImpl& operator++ ()
+    {
+      m_index++;
+      return *this;
+    }
+    /// \return an iterator to this element, after moving to the next one
+    IteratorImpl operator++ (int)
+    {
+      IteratorImpl tmp = *this;
+      m_index++;
+      return tmp;
+    }
+    /// \return this iterator, moved to the previous element
+    IteratorImpl& operator-- ()
+    {
+      m_index--;
+      return *this;
+    }
+    /// \return an iterator to this element, after moving to the previous one
+    IteratorImpl operator-- (int)
+    {
+      IteratorImpl tmp = *this;
+      m_index--;
+      return tmp;
+    }
+    /**
+     * \tparam C whether the other iterator gives read-only access
+     * \param other another iterator
+     * \return true if both iterators point to the same position
+     */
+    template <bool C>
+    bool operator== (const IteratorImpl<C>& other) const
+    {
+      return m_buffer == other.m_buffer && m_index == other.m_index;
+    }
+    /**
+     * \tparam C whether the other iterator gives read-only access
+     * \param other another iterator
+     * \return true if the iterators point to different positions
+     */
+    template <bool C>
+    bool operator!= (const IteratorImpl<C>& other) const
+    {
+      return !(*this == other);
+    }
+
+  private:
+    friend class RingBuffer;
+    friend class IteratorImpl<!Const>;
+
+    container m_buffer;   //!< the ring buffer
+    std::size_t m_index;  //!< the position in the ring buffer
+  };
+
+public:
+  /// Element type
+  typedef T value_type;
+  /// Iterator
+  typedef IteratorImpl<false> iterator;
+  /// Const iterator
+  typedef IteratorImpl<true> const_iterator;
+
+  RingBuffer ()
+    : m_head (0),
+      m_size (0)
+  {
+  }
+
+  /// \return an iterator to the first element
+  iterator begin (void)
+  {
+    return iterator (this, 0);
+  }
+  /// \return an iterator past the last element
+  iterator end (void)
+  {
+    return iterator (this, m_size);
+  }
+  /// \return a const iterator to the first element
+  const_iterator begin (void) const
+  {
+    return const_iterator (this, 0);
+  }
+  /// \return a const iterator past the last element
+  const_iterator end (void) const
+  {
+    return const_iterator (this, m_size);
+  }
+  /// \return a const iterator to the first element
+  const_iterator cbegin (void) const
+  {
+    return begin ();
+  }
+  /// \return a const iterator past the last element
+  const_iterator cend (void) const
+  {
+    return end ();
+  }
+
+  /// \return true if the container holds no element
+  bool empty (void) const
+  {
+    return m_size == 0;
+  }
+  /// \return the number of elements
+  std::size_t size (void) const
+  {
+    return m_size;
+  }
+  /// \return the number of elements the buffer can hold without growing
+  std::size_t capacity (void) const
+  {
+    return m_buffer.size ();
+  }
+
+  /// \return a reference to the first element
+  T& front (void)
+  {
+    return At (0);
+  }
+  /// \return a const reference to the first element
+  const T& front (void) const
+  {
+    return At (0);
+  }
+  /// \return a reference to the last element
+  T& back (void)
+  {
+    return At (m_size - 1);
+  }
+  /// \return a const reference to the last element
+  const T& back (void) const
+  {
+    return At (m_size - 1);
+  }
+
+  /**
+   * Append an element.
+   * \param value the element
+   */
+  void push_back (const T& value)
+  {
+    Grow ();
+    m_size++;
+    back () = value;
+  }
+  /**
+   * Prepend an element.
+   * \param value the element
+   */
+  void push_front (const T& value)
+  {
+    Grow ();
+    m_head = (m_head - 1) & Mask ();
+    m_size++;
+    front () = value;
+  }
+  /// Remove the first element.
+  void pop_front (void)
+  {
+    NS_ASSERT (m_size > 0);
+    front () = T ();
+    m_head = (m_head + 1) & Mask ();
+    m_size--;
+  }
+  /// Remove the last element.
+  void pop_back (void)
+  {
+    NS_ASSERT (m_size > 0);
+    back () = T ();
+    m_size--;
+  }
+
+  /**
+   * Insert an element before the given position.
+   * \param pos the position
+   * \param value the element
+   * \return an iterator to the inserted element
+   */
+  iterator insert (const_iterator pos, const T& value)
+  {
+    std::size_t index = pos.m_index;
+    NS_ASSERT (index <= m_size);
+    if (index < m_size / 2)
+      {
+        // move the elements before the position one place backward
+        push_front (value);
+        for (std::size_t i = 0; i < index; i++)
+          {
+            std::swap (At (i), At (i + 1));
+          }
+      }
+    else
+      {
+        // move the elements after the position one place forward
+        push_back (value);
+        for (std::size_t i = m_size - 1; i > index; i--)
+          {
+            std::swap (At (i), At (i - 1));
+          }
+      }
+    return iterator (this, index);
+  }
+  /**
+   * Erase the element at the given position.
+   * \param pos the position
+   * \return an iterator to the element that followed the erased one
+   */
+  iterator erase (const_iterator pos)
+  {
+    std::size_t index = pos.m_index;
+    NS_ASSERT (index < m_size);
+    if (index < m_size / 2)
+      {
+        for (std::size_t i = index; i > 0; i--)
+          {
+            std::swap (At (i), At (i - 1));
+          }
+        pop_front ();
+      }
+    else
+      {
+        for (std::size_t i = index; i + 1 < m_size; i++)
+          {
+            std::swap (At (i), At (i + 1));
+          }
+        pop_back ();
+      }
+    return iterator (this, index);
+  }
+  /// Remove all the elements, keeping the allocated buffer.
+  void clear (void)
+  {
+    while (m_size > 0)
+      {
+        pop_back ();
+      }
+    m_head = 0;
+  }
+
+private:
+  /// \return the mask to apply to a position in the buffer
+  std::size_t Mask (void) const
+  {
+    return m_buffer.size () - 1;
+  }
+  /**
+   * \param index the position of an element in the container
+   * \return a reference to the element
+   */
+  T& At (std::size_t index)
+  {
+    return m_buffer[(m_head + index) & Mask ()];
+  }
+  /**
+   * \param index the position of an element in the container
+   * \return a const reference to the element
+   */
+  const T& At (std::size_t index) const
+  {
+    return m_buffer[(m_head + index) & Mask ()];
+  }
+  /// Double the capacity of the buffer if it is full.
+  void Grow (void)
+  {
+    if (m_size < m_buffer.size ())
+      {
+        return;
+      }
+    std::size_t capacity = 2 * m_buffer.size ();
+    if (capacity == 0)
+      {
+        capacity = INITIAL_CAPACITY;
+      }
+    std::vector<T> buffer (capacity);
+    for (std::size_t i = 0; i < m_size; i++)
+      {
+        std::swap (buffer[i], At (i));
+      }
+    m_buffer.swap (buffer);
+    m_head = 0;
+  }
+
+  /// Capacity allocated when the first element is added (a power of two)
+  static const std::size_t INITIAL_CAPACITY = 16;
+
+  std::vector<T> m_buffer;  //!< the circular buffer, whose size is a power of two
+  std::size_t m_head;       //!< the position of the first element in the buffer
+  std::size_t m_size;       //!< the number of elements
+};
+
+} // namespace ns3
+
+#endif /* RING_BUFFER_H */
@@ -0,0 +1,429 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2021
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef RNTI_MAP_H
+#define RNTI_MAP_H
+
+#include <vector>
+#include <utility>
+#include <iterator>
+#include <cstddef>
+#include <stdint.h>
+#include <type_traits>
+#include <ns3/assert.h>
+
+namespace ns3 {
+
+/**
+ * \ingroup lte
+ *
+ * \brief A map from RNTI to per-UE state, stored densely.
+ *
+ * The RNTIs of a cell are small integers allocated in increasing order, hence
+ * the state of a UE is stored in a vector at the index given by its RNTI and
+ * a bitmap records which RNTIs are present. Finding the state of a UE takes
+ * constant time, and iterating over the UEs walks a contiguous array.
+ *
+ * The interface is the subset of the std::map<uint16_t, T> interface used by
+ * the FF MAC schedulers, with the same semantics: the elements are visited in
+ * increasing RNTI order, and inserting or erasing an element does not
+ * invalidate the iterators to the other elements.  Unlike with std::map,
+ * inserting or erasing an element may invalidate the references to the other
+ * elements.
+ *
+ * The memory used is proportional to the highest RNTI in the map: the slots
+ * past it are released when the element with the highest RNTI is erased.
+ */
+template <typename T>
+class RntiMap
+{
+public:
+  /// Element type
+  typedef std::pair<uint16_t, T> value_type;
+
+private:
+  /**
+   * \brief An iterator over the elements of a RntiMap.
+   * \tparam Const whether the iterator gives read-only access
+   */
+  template <bool Const>
+  class IteratorImpl
+  {
+  public:
+    /// Iterator category
+    typedef std::bidirectional_iterator_tag iterator_category;
+    /// Element type
+    typedef RntiMap::value_type value_type;
+    /// Difference type
+    typedef std::ptrdiff_t difference_type;
+    /// Pointer type
+    typedef typename std::conditional<Const, const value_type*, value_type*>::type pointer;
+    /// Reference type
+    typedef typename std::conditional<Const, const value_type&, value_type&>::type reference;
+    /// Container type
+    typedef typename std::conditional<Const, const RntiMap*, RntiMap*>::type container;
+
+    IteratorImpl ()
+      : m_map (0),
+        m_index (0)
+    {
+    }
+    /**
+     * \param map the map
+     * \param index the RNTI of the element, or END_INDEX
+     */
+    IteratorImpl (container map, std::size_t index)
+      : m_map (map),
+        m_index (index)
+    {
+    }
+    /**
+     * Convert an iterator into a const iterator.
+     * \param other the iterator to convert
+     */
+    template <bool C = Const, typename = typename std::enable_if<C>::type>
+    IteratorImpl (const IteratorImpl<false>& other)
+      : m_map (other.m_map),
+        m_index (other.m_index)
+    {
+    }
+
+    /// \return a reference to the element
+    reference operator* () const
+    {
+      return m_map->m_slots[m_index];
+    }
+    /// \return a pointer to the element
+    pointer operator-> () const
+    {
+      return &m_map->m_slots[m_index];
+    }
+    /// \return this iterator, moved to the next element
+    IteratorImpl& operator++ ()
+    {
+      m_index = m_map->Next (m_index + 1);
+      return *this;
+    }
+    /// \return an iterator to this element, after moving to the next one
+    IteratorImpl operator++ (int)
+    {
+      IteratorImpl tmp = *this;
+      ++(*this);
+      return tmp;
+    }
+    /**
+     * Moving the iterator to the first element backwards gives end (), like
+     * the std::map iterators of libstdc++ do.
+     * \return this iterator, moved to the previous element
+     */
+    IteratorImpl& operator-- ()
+    {
+      if (m_index > m_map->m_slots.size ())
+        {
+          m_index = m_map->m_slots.size ();
+        }
+      do
+        {
+          if (m_index == 0)
+            {
+              m_index = END_INDEX;
+              return *this;
+            }
+          m_index--;
+        }
+      while (!m_map->IsUsed (m_index));
+      return *this;
+    }
+    /// \return an iterator to this element, after moving to the previous one
+    IteratorImpl operator-- (int)
+    {
+      IteratorImpl tmp = *this;
+      --(*this);
+      return tmp;
+    }
+    /**
+     * \tparam C whether the other iterator gives read-only access
+     * \param other another iterator
+     * \return true if both iterators point to the same element
+     */
+    template <bool C>
+    bool operator== (const IteratorImpl<C>& other) const
+    {
+      return m_map == other.m_map && m_index == other.m_index;
+    }
+    /**
+     * \tparam C whether the other iterator gives read-only access
+     * \param other another iterator
+     * \return true if the iterators point to different elements
+     */
+    template <bool C>
+    bool operator!= (const IteratorImpl<C>& other) const
+    {
+      return !(*this == other);
+    }
+
+  private:
+    friend class RntiMap;
+    friend class IteratorImpl<!Const>;
+
+    container m_map;      //!< the map
+    std::size_t m_index;  //!< the RNTI of the element
+  };
+
+public:
+  /// Iterator
+  typedef IteratorImpl<false> iterator;
+  /// Const iterator
+  typedef IteratorImpl<true> const_iterator;
+
+  RntiMap ()
+    : m_size (0)
+  {
+  }
+
+  /// \return an iterator to the element with the lowest RNTI
+  iterator begin (void)
+  {
+    return iterator (this, Next (0));
+  }
+  /// \return an iterator past the last element
+  iterator end (void)
+  {
+    return iterator (this, END_INDEX);
+  }
+  /// \return a const iterator to the element with the lowest RNTI
+  const_iterator begin (void) const
+  {
+    return const_iterator (this, Next (0));
+  }
+  /// \return a const iterator past the last element
+  const_iterator end (void) const
+  {
+    return const_iterator (this, END_INDEX);
+  }
+
+  /// \return true if the map holds no element
+  bool empty (void) const
+  {
+    return m_size == 0;
+  }
+  /// \return the number of elements
+  std::size_t size (void) const
+  {
+    return m_size;
+  }
+
+  /**
+   * \param rnti the RNTI
+   * \return an iterator to the element with the given RNTI, or end ()
+   */
+  iterator find (uint16_t rnti)
+  {
+    return iterator (this, IsUsed (rnti) ? rnti : END_INDEX);
+  }
+  /**
+   * \param rnti the RNTI
+   * \return a const iterator to the element with the given RNTI, or end ()
+   */
+  const_iterator find (uint16_t rnti) const
+  {
+    return const_iterator (this, IsUsed (rnti) ? rnti : END_INDEX);
+  }
+  /**
+   * \param rnti the RNTI
+   * \return 1 if the map has an element with the given RNTI, 0 otherwise
+   */
+  std::size_t count (uint16_t rnti) const
+  {
+    return IsUsed (rnti) ? 1 : 0;
+  }
+  /**
+   * \param rnti the RNTI
+   * \return a reference to the element with the given RNTI, which is
+   *         default-constructed if not present
+   */
+  T& operator[] (uint16_t rnti)
+  {
+    return insert (value_type (rnti, T ())).first->second;
+  }
+  /**
+   * \param rnti the RNTI of an element of the map
+   * \return a reference to the element with the given RNTI
+   */
+  T& at (uint16_t rnti)
+  {
+    NS_ASSERT_MSG (IsUsed (rnti), "RNTI " << rnti << " not found");
+    return m_slots[rnti].second;
+  }
+  /**
+   * \param rnti the RNTI of an element of the map
+   * \return a const reference to the element with the given RNTI
+   */
+  const T& at (uint16_t rnti) const
+  {
+    NS_ASSERT_MSG (IsUsed (rnti), "RNTI " << rnti << " not found");
+    return m_slots[rnti].second;
+  }
+
+  /**
+   * Insert an element, unless an element with the same RNTI is present.
+   * \tparam U the type of the value of the pair
+   * \param value the pair (RNTI, value)
+   * \return an iterator to the element with the given RNTI, and whether the
+   *         element was inserted
+   */
+  template <typename U>
+  std::pair<iterator, bool> insert (const std::pair<uint16_t, U>& value)
+  {
+    uint16_t rnti = value.first;
+    if (IsUsed (rnti))
+      {
+        return std::make_pair (iterator (this, rnti), false);
+      }
+    if (rnti >= m_slots.size ())
+      {
+        m_slots.resize (rnti + 1);
+        m_used.resize (rnti / 64 + 1, 0);
+      }
+    m_slots[rnti].first = rnti;
+    m_slots[rnti].second = value.second;
+    m_used[rnti / 64] |= (uint64_t (1) << (rnti % 64));
+    m_size++;
+    return std::make_pair (iterator (this, rnti), true);
+  }
+  /**
+   * Erase the element pointed to by the given iterator.
+   * \param pos the iterator
+   */
+  void erase (const_iterator pos)
+  {
+    NS_ASSERT (pos.m_map == this && IsUsed (pos.m_index));
+    std::size_t rnti = pos.m_index;
+    m_used[rnti / 64] &= ~(uint64_t (1) << (rnti % 64));
+    m_slots[rnti].second = T ();
+    m_size--;
+    if (rnti + 1 == m_slots.size ())
+      {
+        Trim ();
+      }
+  }
+  /**
+   * Erase the element with the given RNTI, if any.
+   * \param rnti the RNTI
+   * \return the number of erased elements
+   */
+  std::size_t erase (uint16_t rnti)
+  {
+    if (!IsUsed (rnti))
+      {
+        return 0;
+      }
+    erase (const_iterator (this, rnti));
+    return 1;
+  }
+  /// Remove all the elements.
+  void clear (void)
+  {
+    m_slots.clear ();
+    m_used.clear ();
+    m_size = 0;
+  }
+
+private:
+  /// The index of the end iterator, which does not depend on the number of slots
+  enum
+  {
+    END_INDEX = 65536
+  };
+
+  /**
+   * \param rnti the RNTI
+   * \return true if the map has an element with the given RNTI
+   */
+  bool IsUsed (std::size_t rnti) const
+  {
+    return rnti < m_slots.size () && (m_used[rnti / 64] >> (rnti % 64)) & 1;
+  }
+  /**
+   * Remove the slots past the highest RNTI in the map, and release their
+   * memory once it is more than half of the memory of the slots.
+   */
+  void Trim (void)
+  {
+    std::size_t words = m_used.size ();
+    while (words > 0 && m_used[words - 1] == 0)
+      {
+        words--;
+      }
+    std::size_t slots = 0;
+    if (words > 0)
+      {
+        // one past the highest RNTI in the last non-empty word
+        slots = (words - 1) * 64;
+        for (uint64_t bits = m_used[words - 1]; bits != 0; bits >>= 1)
+          {
+            slots++;
+          }
+      }
+    m_slots.resize (slots);
+    m_used.resize (words);
+    if (m_slots.capacity () > 2 * m_slots.size ())
+      {
+        m_slots.shrink_to_fit ();
+        m_used.shrink_to_fit ();
+      }
+  }
+  /**
+   * \param rnti a RNTI
+   * \return the lowest RNTI of an element not lower than the given RNTI, or
+   *         END_INDEX if there is none
+   */
+  std::size_t Next (std::size_t rnti) const
+  {
+    std::size_t word = rnti / 64;
+    if (word >= m_used.size ())
+      {
+        return END_INDEX;
+      }
+    // discard the bits of the RNTIs lower than the given one
+    uint64_t bits = m_used[word] & (~uint64_t (0) << (rnti % 64));
+    while (bits == 0)
+      {
+        if (++word == m_used.size ())
+          {
+            return END_INDEX;
+          }
+        bits = m_used[word];
+      }
+    std::size_t index = word * 64;
+    while ((bits & 1) == 0)
+      {
+        bits >>= 1;
+        index++;
+      }
+    return index;
+  }
+
+  std::vector<value_type> m_slots;  //!< the elements, indexed by RNTI
+  std::vector<uint64_t> m_used;     //!< the bitmap of the RNTIs in the map
+  std::size_t m_size;               //!< the number of elements
+};
+
+} // namespace ns3
+
+#endif /* RNTI_MAP_H */
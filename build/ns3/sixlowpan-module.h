@@ -0,0 +1,13 @@
+
+#ifdef NS3_MODULE_COMPILATION
+# error "Do not include ns3 module aggregator headers from other modules; these are meant only for end user scripts."
+#endif
+
+#ifndef NS3_MODULE_SIXLOWPAN
+    
+
+// Module headers:
+#include "sixlowpan-header.h"
+#include "sixlowpan-helper.h"
+#include "sixlowpan-net-device.h"
+#endif
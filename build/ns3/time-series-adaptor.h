@@ -0,0 +1,189 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013 University of Washington
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Mitch Watrous (watrous@u.washington.edu)
+ */
+
+#ifndef TIME_SERIES_ADAPTOR_H
+#define TIME_SERIES_ADAPTOR_H
+
+#include "ns3/data-collection-object.h"
+#include "ns3/object.h"
+#include "ns3/type-id.h"
+#include "ns3/traced-value.h"
+#include "ns3/nstime.h"
+#include "ns3/event-id.h"
+#include "ns3/histogram.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup aggregator
+ *
+ * \brief Takes probed values of different types and outputs the
+ * current time plus the value with both converted to doubles.
+ *
+ * The role of the TimeSeriesAdaptor class is that of an adaptor
+ * class, to take raw-valued probe data of different types, and output
+ * a tuple of two double values.  The first is a timestamp which may
+ * be set to different resolutions (e.g. Seconds, Milliseconds, etc.)
+ * in the future, but which presently is hardcoded to Seconds.  The second
+ * is the conversion of
+ * a non-double value to a double value (possibly with loss of precision).
+ *
+ * It should be noted that time series adaptors convert
+ * Simulation Time objects to double values in its output.
+ *
+ * By default, every value is output as soon as it is received. When the
+ * AggregationWindow attribute is set, the values are instead reduced to
+ * a single statistic (the mean, minimum, maximum, sum or count of the
+ * values, or a quantile estimated from a Histogram of the values) over
+ * consecutive windows of simulation time, and only this statistic is
+ * output, at the end of each window with at least one value.  This keeps
+ * the cost of the downstream aggregators, which format and write every
+ * output value, independent of the number of values probed.  The values
+ * of a window which has not ended when the simulation stops are not
+ * output.
+ */
+class TimeSeriesAdaptor : public DataCollectionObject
+{
+public:
+  /**
+   * \brief Get the type ID.
+   * \return the object TypeId
+   */
+  static TypeId GetTypeId (void);
+
+  /// Statistic output for each aggregation window
+  enum Statistic
+  {
+    MEAN,     //!< the mean of the values
+    MIN,      //!< the minimum value
+    MAX,      //!< the maximum value
+    SUM,      //!< the sum of the values
+    COUNT,    //!< the number of values
+    QUANTILE  //!< the quantile set by the Quantile attribute
+  };
+
+  TimeSeriesAdaptor ();
+  virtual ~TimeSeriesAdaptor ();
+
+  /**
+   * \brief Trace sink for receiving data from double valued trace
+   * sources.
+   * \param oldData the original value.
+   * \param newData the new value.
+   *
+   * This method serves as a trace sink to double valued trace
+   * sources.
+   */
+  void TraceSinkDouble (double oldData, double newData);
+
+  /**
+   * \brief Trace sink for receiving data from bool valued trace
+   * sources.
+   * \param oldData the original value.
+   * \param newData the new value.
+   *
+   * This method serves as a trace sink to bool valued trace
+   * sources.
+   */
+  void TraceSinkBoolean (bool oldData, bool newData);
+
+  /**
+   * \brief Trace sink for receiving data from uint8_t valued trace
+   * sources.
+   * \param oldData the original value.
+   * \param newData the new value.
+   *
+   * This method serves as a trace sink to uint8_t valued trace
+   * sources.
+   */
+  void TraceSinkUinteger8 (uint8_t oldData, uint8_t newData);
+
+  /**
+   * \brief Trace sink for receiving data from uint16_t valued trace
+   * sources.
+   * \param oldData the original value.
+   * \param newData the new value.
+   *
+   * This method serves as a trace sink to uint16_t valued trace
+   * sources.
+   */
+  void TraceSinkUinteger16 (uint16_t oldData, uint16_t newData);
+
+  /**
+   * \brief Trace sink for receiving data from uint32_t valued trace
+   * sources.
+   * \param oldData the original value.
+   * \param newData the new value.
+   *
+   * This method serves as a trace sink to uint32_t valued trace
+   * sources.
+   */
+  void TraceSinkUinteger32 (uint32_t oldData, uint32_t newData);
+
+  /**
+   * TracedCallback signature for output trace.
+   *
+   * \param [in] now The current time, in seconds.
+   * \param [in] data The new data value.
+   */
+  typedef void (* OutputTracedCallback) (const double now, const double data);
+  
+protected:
+  virtual void DoDispose (void);
+
+private:
+  /**
+   * \brief Add a value to the current aggregation window.
+   * \param data the value.
+   */
+  void Aggregate (double data);
+
+  /**
+   * \brief Output the statistic of the current aggregation window, and
+   * start a new window.
+   */
+  void OutputWindow (void);
+
+  /**
+   * \brief Estimate the quantile of the values of the current window
+   * from their histogram.
+   * \return the quantile.
+   */
+  double GetQuantile (void);
+
+  TracedCallback<double, double> m_output; //!< output trace
+
+  Time m_window;             //!< duration of the aggregation windows, or zero
+  Statistic m_statistic;     //!< statistic output for each window
+  double m_quantile;         //!< quantile output by the QUANTILE statistic
+  double m_binWidth;         //!< width of the bins of the histogram of the values
+
+  Time m_windowEnd;          //!< end of the current window
+  EventId m_outputEvent;     //!< event outputting the current window
+  uint32_t m_count;          //!< number of values in the current window
+  double m_sum;              //!< sum of the values of the current window
+  double m_min;              //!< minimum value of the current window
+  double m_max;              //!< maximum value of the current window
+  Histogram m_histogram;     //!< histogram of the values of the current window
+};
+
+} // namespace ns3
+
+#endif // TIME_SERIES_ADAPTOR_H
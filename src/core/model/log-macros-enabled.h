@@ -165,6 +165,30 @@
 #define NS_LOG_CONDITION
 #endif
 
+#ifndef NS_LOG_STATIC_MASK
+/**
+ * \ingroup logging
+ * The log levels compiled in.
+ *
+ * The statements logging at the other levels are removed by the
+ * compiler, whatever the levels enabled at run time.  This is set
+ * for each module by the \c --logs-compiled configure option, but
+ * can also be defined in a `.cc` file before including the headers.
+ */
+#define NS_LOG_STATIC_MASK ns3::LOG_ALL
+#endif
+
+/**
+ * \ingroup logging
+ * Check if \pname{level} is compiled in and enabled for \c g_log.
+ * \internal
+ * Logging implementation macro; should not be called directly.
+ *
+ * \param [in] level The log level.
+ */
+#define NS_LOG_IS_ENABLED(level)                                \
+  (((NS_LOG_STATIC_MASK) & (level)) && g_log.IsEnabled (level))
+
 /**
  * \ingroup logging
  *
@@ -179,6 +203,8 @@
  * NS_LOG (LOG_DEBUG, "a number="<<aNumber<<", anotherNumber="<<anotherNumber);
  * \endcode
  *
+ * The message is only evaluated when \pname{level} is enabled.
+ *
  * \param [in] level The log level
  * \param [in] msg The message to log
  * \internal
@@ -187,7 +213,7 @@
 #define NS_LOG(level, msg)                                      \
   NS_LOG_CONDITION                                              \
   do {                                                          \
-      if (g_log.IsEnabled (level))                              \
+      if (NS_LOG_IS_ENABLED (level))                            \
         {                                                       \
           NS_LOG_APPEND_TIME_PREFIX;                            \
           NS_LOG_APPEND_NODE_PREFIX;                            \
@@ -209,7 +235,7 @@
 #define NS_LOG_FUNCTION_NOARGS()                                \
   NS_LOG_CONDITION                                              \
   do {                                                          \
-      if (g_log.IsEnabled (ns3::LOG_FUNCTION))                  \
+      if (NS_LOG_IS_ENABLED (ns3::LOG_FUNCTION))                \
         {                                                       \
           NS_LOG_APPEND_TIME_PREFIX;                            \
           NS_LOG_APPEND_NODE_PREFIX;                            \
@@ -245,7 +271,7 @@
   NS_LOG_CONDITION                                              \
   do                                                            \
     {                                                           \
-      if (g_log.IsEnabled (ns3::LOG_FUNCTION))                  \
+      if (NS_LOG_IS_ENABLED (ns3::LOG_FUNCTION))                \
         {                                                       \
           NS_LOG_APPEND_TIME_PREFIX;                            \
           NS_LOG_APPEND_NODE_PREFIX;                            \
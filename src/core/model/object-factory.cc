@@ -19,6 +19,8 @@
  */
 #include "object-factory.h"
 #include "log.h"
+#include <cstdlib>  // getenv
+#include <cstring>  // strlen
 #include <sstream>
 
 /**
@@ -41,18 +43,21 @@ ObjectFactory::SetTypeId (TypeId tid)
 {
   NS_LOG_FUNCTION (this << tid.GetName ());
   m_tid = tid;
+  m_compiledValid = false;
 }
 void
 ObjectFactory::SetTypeId (std::string tid)
 {
   NS_LOG_FUNCTION (this << tid);
   m_tid = TypeId::LookupByName (tid);
+  m_compiledValid = false;
 }
 void
 ObjectFactory::SetTypeId (const char *tid)
 {
   NS_LOG_FUNCTION (this << tid);
   m_tid = TypeId::LookupByName (tid);
+  m_compiledValid = false;
 }
 bool
 ObjectFactory::IsTypeIdSet (void) const
@@ -85,6 +90,7 @@ ObjectFactory::DoSet (const std::string &name, const AttributeValue &value)
       return;
     }
   m_parameters.Add (name, info.checker, value.Copy ());
+  m_compiledValid = false;
 }
 
 TypeId
@@ -103,11 +109,113 @@ ObjectFactory::Create (void) const
   Object *derived = dynamic_cast<Object *> (base);
   NS_ASSERT (derived != 0);
   derived->SetTypeId (m_tid);
-  derived->Construct (m_parameters);
+  // Attribute defaults given through the environment are matched by
+  // name on every construction, so they bypass the compiled path.
+  const char *envVar = getenv ("NS_ATTRIBUTE_DEFAULT");
+  if (envVar != 0 && std::strlen (envVar) > 0)
+    {
+      derived->Construct (m_parameters);
+    }
+  else
+    {
+      if (!m_compiledValid || m_compiledGeneration != TypeId::GetAttributeGeneration ())
+        {
+          Compile ();
+        }
+      ConstructCompiled (derived);
+    }
   Ptr<Object> object = Ptr<Object> (derived, false);
   return object;
 }
 
+void
+ObjectFactory::Compile (void) const
+{
+  NS_LOG_FUNCTION (this);
+  m_compiled.clear ();
+  // Same traversal as ObjectBase::ConstructSelf
+  TypeId tid = m_tid;
+  do
+    {
+      for (std::size_t i = 0; i < tid.GetAttributeN (); i++)
+        {
+          struct TypeId::AttributeInformation info = tid.GetAttribute (i);
+          Ptr<AttributeValue> value = m_parameters.Find (info.checker);
+          if (!(info.flags & TypeId::ATTR_CONSTRUCT))
+            {
+              if (value == 0)
+                {
+                  continue;
+                }
+              NS_FATAL_ERROR ("Attribute name=" << info.name << " tid=" << tid.GetName () << ": initial value cannot be set using attributes");
+            }
+          struct CompiledAttribute attr;
+          attr.accessor = info.accessor;
+          attr.checker = info.checker;
+          attr.value = value;
+          attr.initialValue = info.initialValue;
+          // Values which need a conversion (typically a StringValue) are
+          // converted again for every object, since the conversion may
+          // create a new instance (e.g., a RandomVariableStream).
+          attr.valueChecked = (value != 0) && info.checker->Check (*value);
+          attr.initialValueChecked = info.checker->Check (*info.initialValue);
+          m_compiled.push_back (attr);
+        }
+      tid = tid.GetParent ();
+    }
+  while (tid != ObjectBase::GetTypeId ());
+  m_compiledGeneration = TypeId::GetAttributeGeneration ();
+  m_compiledValid = true;
+  NS_LOG_LOGIC ("compiled " << m_compiled.size () << " attributes for " << m_tid.GetName ());
+}
+
+/**
+ * \ingroup object
+ * Store an attribute value into an object.
+ *
+ * \param [in] object The object to modify.
+ * \param [in] accessor The accessor of the attribute.
+ * \param [in] checker The checker of the attribute.
+ * \param [in] value The value to store.
+ * \param [in] checked \c true if \pname{value} is already known to be valid.
+ * \returns \c true if the value could be stored.
+ */
+static bool
+SetCompiledAttribute (ObjectBase *object,
+                      Ptr<const AttributeAccessor> accessor,
+                      Ptr<const AttributeChecker> checker,
+                      const AttributeValue &value,
+                      bool checked)
+{
+  if (checked)
+    {
+      return accessor->Set (object, value);
+    }
+  Ptr<AttributeValue> v = checker->CreateValidValue (value);
+  if (v == 0)
+    {
+      return false;
+    }
+  return accessor->Set (object, *v);
+}
+
+void
+ObjectFactory::ConstructCompiled (Object *object) const
+{
+  NS_LOG_FUNCTION (this << object);
+  for (std::vector<struct CompiledAttribute>::const_iterator i = m_compiled.begin ();
+       i != m_compiled.end (); ++i)
+    {
+      if (i->value != 0
+          && SetCompiledAttribute (object, i->accessor, i->checker, *i->value, i->valueChecked))
+        {
+          continue;
+        }
+      SetCompiledAttribute (object, i->accessor, i->checker, *i->initialValue, i->initialValueChecked);
+    }
+  object->NotifyConstructionCompleted ();
+}
+
 std::ostream & operator << (std::ostream &os, const ObjectFactory &factory)
 {
   os << factory.m_tid.GetName () << "[";
@@ -187,6 +295,7 @@ std::istream & operator >> (std::istream &is, ObjectFactory &factory)
               else
                 {
                   factory.m_parameters.Add (name, info.checker, val);
+                  factory.m_compiledValid = false;
                 }
             }
         }
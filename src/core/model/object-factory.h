@@ -23,6 +23,7 @@
 #include "attribute-construction-list.h"
 #include "object.h"
 #include "type-id.h"
+#include <vector>
 
 /**
  * \file
@@ -42,6 +43,14 @@ class AttributeValue;
  * This class can also hold a set of attributes to set
  * automatically during the object construction.
  *
+ * The first call to Create() resolves every attribute of the
+ * configured TypeId, including inherited ones, to its accessor and
+ * to the value it will receive, checking the values against their
+ * checkers where possible.  Subsequent calls replay this compiled
+ * list instead of looking attributes up again, until the factory
+ * configuration or an attribute initial value (e.g., through
+ * Config::SetDefault) changes.
+ *
  * \see attribute_ObjectFactory
  */
 class ObjectFactory
@@ -139,6 +148,16 @@ private:
    * \param [in] value The value of the attribute to set.
    */
   void DoSet (const std::string &name, const AttributeValue &value);
+  /**
+   * Resolve the attributes of the configured TypeId into m_compiled.
+   */
+  void Compile (void) const;
+  /**
+   * Initialize the attributes of a new object from m_compiled.
+   *
+   * \param [in] object The object to construct.
+   */
+  void ConstructCompiled (Object *object) const;
   /**
    * Print the factory configuration on an output stream.
    *
@@ -169,6 +188,29 @@ private:
    * objects by this factory.
    */
   AttributeConstructionList m_parameters;
+
+  /** An attribute resolved by Compile() and replayed by Create(). */
+  struct CompiledAttribute
+  {
+    /** Accessor used to store the value into the new object. */
+    Ptr<const AttributeAccessor> accessor;
+    /** Checker used to validate the values. */
+    Ptr<const AttributeChecker> checker;
+    /** The value set on this factory, or null to use the initial value. */
+    Ptr<const AttributeValue> value;
+    /** The initial value of this attribute. */
+    Ptr<const AttributeValue> initialValue;
+    /** \c true if \c value is already accepted by \c checker. */
+    bool valueChecked;
+    /** \c true if \c initialValue is already accepted by \c checker. */
+    bool initialValueChecked;
+  };
+  /** The attributes resolved by the last call to Compile(). */
+  mutable std::vector<struct CompiledAttribute> m_compiled;
+  /** \c true if m_compiled matches m_tid and m_parameters. */
+  mutable bool m_compiledValid {false};
+  /** The TypeId attribute generation m_compiled was built for. */
+  mutable uint32_t m_compiledGeneration {0};
 };
 
 std::ostream & operator << (std::ostream &os, const ObjectFactory &factory);
@@ -27,6 +27,7 @@
 #include "string.h"
 #include <vector>
 #include <sstream>
+#include <algorithm>
 #include <cstdlib>
 #include <cstring>
 
@@ -46,6 +47,82 @@ NS_LOG_COMPONENT_DEFINE ("Object");
 
 NS_OBJECT_ENSURE_REGISTERED (Object);
 
+/**
+ * \ingroup object
+ *
+ * Direct-mapped cache of DoGetObject() results, shared by all the
+ * Objects of an aggregate and indexed by the low bits of the requested
+ * TypeId uid.  Misses are cached too.  Since an aggregate only grows
+ * through AggregateObject(), which allocates a new Aggregates list,
+ * entries stay valid for the lifetime of the list.
+ */
+struct Object::GetObjectCache
+{
+  /** Number of entries, a power of two. */
+  static const uint16_t SIZE = 8;
+  /** A cached lookup. */
+  struct Entry
+  {
+    /** The requested TypeId uid, 0 if the entry is empty. */
+    uint16_t uid;
+    /** The result of the lookup. */
+    Object *object;
+  };
+  /** The cache entries. */
+  struct Entry entries[SIZE];
+};
+
+namespace {
+
+/**
+ * \ingroup object
+ * GetObject() statistics for one requested TypeId.
+ */
+struct GetObjectStatistics
+{
+  /** Lookups not satisfied by the object itself. */
+  uint64_t lookups;
+  /** Lookups answered by the aggregate cache. */
+  uint64_t hits;
+};
+
+/** \c true if GetObject() statistics are being collected. */
+bool g_getObjectStatisticsEnabled = false;
+
+/**
+ * Get the GetObject() statistics, indexed by TypeId uid.
+ * \returns The statistics.
+ */
+std::vector<struct GetObjectStatistics> &
+GetObjectStatisticsTable (void)
+{
+  static std::vector<struct GetObjectStatistics> table;
+  return table;
+}
+
+/**
+ * Record a GetObject() lookup.
+ * \param [in] uid The requested TypeId uid.
+ * \param [in] hit \c true if the lookup was answered by the cache.
+ */
+void
+RecordGetObject (uint16_t uid, bool hit)
+{
+  std::vector<struct GetObjectStatistics> &table = GetObjectStatisticsTable ();
+  if (table.size () <= uid)
+    {
+      struct GetObjectStatistics empty = {0, 0};
+      table.resize (uid + 1, empty);
+    }
+  table[uid].lookups++;
+  if (hit)
+    {
+      table[uid].hits++;
+    }
+}
+
+} // unnamed namespace
+
 Object::AggregateIterator::AggregateIterator ()
   : m_object (0),
     m_current (0)
@@ -102,6 +179,7 @@ Object::Object ()
 {
   NS_LOG_FUNCTION (this);
   m_aggregates->n = 1;
+  m_aggregates->cache = 0;
   m_aggregates->buffer[0] = this;
 }
 Object::~Object ()
@@ -124,7 +202,13 @@ Object::~Object ()
   // delete the aggregate list
   if (m_aggregates->n == 0)
     {
-      std::free (m_aggregates);
+      FreeAggregates (m_aggregates);
+    }
+  else
+    {
+      // the cache may point to this object
+      delete m_aggregates->cache;
+      m_aggregates->cache = 0;
     }
   m_aggregates = 0;
 }
@@ -136,6 +220,7 @@ Object::Object (const Object &o)
     m_getObjectCount (0)
 {
   m_aggregates->n = 1;
+  m_aggregates->cache = 0;
   m_aggregates->buffer[0] = this;
 }
 void
@@ -151,6 +236,26 @@ Object::DoGetObject (TypeId tid) const
   NS_LOG_FUNCTION (this << tid);
   NS_ASSERT (CheckLoose ());
 
+  uint16_t uid = tid.GetUid ();
+  if (m_aggregates->cache == 0)
+    {
+      m_aggregates->cache = new struct GetObjectCache ();
+    }
+  struct GetObjectCache::Entry *entry =
+    &m_aggregates->cache->entries[uid & (GetObjectCache::SIZE - 1)];
+  if (entry->uid == uid)
+    {
+      if (g_getObjectStatisticsEnabled)
+        {
+          RecordGetObject (uid, true);
+        }
+      return entry->object;
+    }
+  if (g_getObjectStatisticsEnabled)
+    {
+      RecordGetObject (uid, false);
+    }
+
   uint32_t n = m_aggregates->n;
   TypeId objectTid = Object::GetTypeId ();
   for (uint32_t i = 0; i < n; i++)
@@ -173,10 +278,14 @@ Object::DoGetObject (TypeId tid) const
           current->m_getObjectCount++;
           // then, update the sort
           UpdateSortedArray (m_aggregates, i);
-          // finally, return the match
+          // finally, remember and return the match
+          entry->uid = uid;
+          entry->object = current;
           return const_cast<Object *> (current);
         }
     }
+  entry->uid = uid;
+  entry->object = 0;
   return 0;
 }
 void
@@ -249,6 +358,13 @@ Object::UpdateSortedArray (struct Aggregates *aggregates, uint32_t j) const
     }
 }
 void
+Object::FreeAggregates (struct Aggregates *aggregates)
+{
+  NS_LOG_FUNCTION (aggregates);
+  delete aggregates->cache;
+  std::free (aggregates);
+}
+void
 Object::AggregateObject (Ptr<Object> o)
 {
   NS_LOG_FUNCTION (this << o);
@@ -263,6 +379,7 @@ Object::AggregateObject (Ptr<Object> o)
   struct Aggregates *aggregates =
     (struct Aggregates *)std::malloc (sizeof(struct Aggregates) + (total - 1) * sizeof(Object*));
   aggregates->n = total;
+  aggregates->cache = 0;
 
   // copy our buffer to the new buffer
   std::memcpy (&aggregates->buffer[0],
@@ -314,8 +431,8 @@ Object::AggregateObject (Ptr<Object> o)
     }
 
   // Now that we are done with them, we can free our old aggregate buffers
-  std::free (a);
-  std::free (b);
+  FreeAggregates (a);
+  FreeAggregates (b);
 }
 /**
  * This function must be implemented in the stack that needs to notify
@@ -327,6 +444,46 @@ Object::NotifyNewAggregate ()
   NS_LOG_FUNCTION (this);
 }
 
+void
+Object::EnableGetObjectStatistics (bool enable)
+{
+  NS_LOG_FUNCTION (enable);
+  g_getObjectStatisticsEnabled = enable;
+}
+
+void
+Object::PrintGetObjectStatistics (std::ostream &os)
+{
+  NS_LOG_FUNCTION (&os);
+  const std::vector<struct GetObjectStatistics> &table = GetObjectStatisticsTable ();
+  std::vector<std::pair<uint64_t, uint16_t> > sorted;
+  for (std::size_t uid = 1; uid < table.size (); ++uid)
+    {
+      if (table[uid].lookups > 0)
+        {
+          sorted.push_back (std::make_pair (table[uid].lookups, static_cast<uint16_t> (uid)));
+        }
+    }
+  std::sort (sorted.rbegin (), sorted.rend ());
+  for (std::size_t i = 0; i < sorted.size (); ++i)
+    {
+      uint16_t uid = sorted[i].second;
+      TypeId tid;
+      tid.SetUid (uid);
+      os << tid.GetName ()
+         << " lookups=" << table[uid].lookups
+         << " cacheHits=" << table[uid].hits
+         << std::endl;
+    }
+}
+
+void
+Object::ResetGetObjectStatistics (void)
+{
+  NS_LOG_FUNCTION_NOARGS ();
+  GetObjectStatisticsTable ().clear ();
+}
+
 Object::AggregateIterator
 Object::GetAggregateIterator (void) const
 {
@@ -24,6 +24,7 @@
 #include <stdint.h>
 #include <string>
 #include <vector>
+#include <ostream>
 #include "ptr.h"
 #include "attribute.h"
 #include "object-base.h"
@@ -230,6 +231,28 @@ public:
    */
   bool IsInitialized (void) const;
 
+  /**
+   * Enable or disable the collection of GetObject() statistics.
+   *
+   * When enabled, every lookup which is not satisfied by the object
+   * GetObject() is called on is counted per requested TypeId, along
+   * with the number of these lookups answered by the aggregate cache.
+   * This helps finding the GetObject() calls worth hoisting out of
+   * hot paths.
+   *
+   * \param [in] enable \c true to collect statistics.
+   */
+  static void EnableGetObjectStatistics (bool enable);
+  /**
+   * Print the GetObject() statistics collected so far, most requested
+   * TypeId first.
+   *
+   * \param [in,out] os The output stream.
+   */
+  static void PrintGetObjectStatistics (std::ostream &os);
+  /** Clear the GetObject() statistics collected so far. */
+  static void ResetGetObjectStatistics (void);
+
 protected:
   /**
    * Notify all Objects aggregated to this one of a new Object being
@@ -330,6 +353,9 @@ private:
   friend struct ObjectDeleter;
   /**@}*/
 
+  /** Direct-mapped cache of DoGetObject() results, see object.cc. */
+  struct GetObjectCache;
+
   /**
    * The list of Objects aggregated to this one.
    *
@@ -346,6 +372,8 @@ private:
   {
     /** The number of entries in \c buffer. */
     uint32_t n;
+    /** The DoGetObject() cache, allocated on first use. */
+    struct GetObjectCache *cache;
     /** The array of Objects. */
     Object *buffer[1];
   };
@@ -404,6 +432,12 @@ private:
    * \param [in] i The most recently used entry in the list.
    */
   void UpdateSortedArray (struct Aggregates *aggregates, uint32_t i) const;
+  /**
+   * Release an aggregate list and its cache.
+   *
+   * \param [in] aggregates The list to release.
+   */
+  static void FreeAggregates (struct Aggregates *aggregates);
   /**
    * Attempt to delete this Object.
    *
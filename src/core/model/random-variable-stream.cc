@@ -25,6 +25,7 @@
  */
 #include "random-variable-stream.h"
 #include "assert.h"
+#include "abort.h"
 #include "boolean.h"
 #include "double.h"
 #include "integer.h"
@@ -132,6 +133,25 @@ RandomVariableStream::GetStream (void) const
   return m_stream;
 }
 
+std::vector<double>
+RandomVariableStream::GetRngState (void) const
+{
+  NS_LOG_FUNCTION (this);
+  NS_ASSERT_MSG (m_rng != 0, "RngStream not yet allocated");
+  std::vector<double> state (6);
+  m_rng->GetState (state.data ());
+  return state;
+}
+
+void
+RandomVariableStream::SetRngState (const std::vector<double> &state)
+{
+  NS_LOG_FUNCTION (this);
+  NS_ASSERT_MSG (m_rng != 0, "RngStream not yet allocated");
+  NS_ABORT_MSG_IF (state.size () != 6, "RngStream state must have six elements");
+  m_rng->SetState (state.data ());
+}
+
 RngStream *
 RandomVariableStream::Peek (void) const
 {
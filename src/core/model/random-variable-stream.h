@@ -30,6 +30,7 @@
 #include "object.h"
 #include "attribute-helper.h"
 #include <stdint.h>
+#include <vector>
 
 /**
  * \file
@@ -149,6 +150,23 @@ public:
    */
   virtual uint32_t GetInteger (void) = 0;
 
+  /**
+   * \brief Get the current state of the underlying RngStream.
+   *
+   * The returned state can be stored and later handed to
+   * SetRngState() to resume this stream from the same position,
+   * for instance when restoring a warmed-up simulation snapshot.
+   *
+   * \return The six-element RngStream state vector.
+   */
+  std::vector<double> GetRngState (void) const;
+
+  /**
+   * \brief Restore the state of the underlying RngStream.
+   * \param [in] state A state vector obtained from GetRngState().
+   */
+  void SetRngState (const std::vector<double> &state);
+
 protected:
   /**
    * \brief Get the pointer to the underlying RngStream.
@@ -69,6 +69,21 @@ RealtimeSimulatorImpl::GetTypeId (void)
                    TimeValue (Seconds (0.1)),
                    MakeTimeAccessor (&RealtimeSimulatorImpl::m_hardLimit),
                    MakeTimeChecker ())
+    .AddAttribute ("HardLimitPolicy",
+                   "What to do when an event exceeds the HardLimit "
+                   "(used in conjunction with SynchronizationMode=HardLimit)",
+                   EnumValue (HARD_LIMIT_FATAL),
+                   MakeEnumAccessor (&RealtimeSimulatorImpl::SetHardLimitPolicy),
+                   MakeEnumChecker (HARD_LIMIT_FATAL, "Fatal",
+                                    HARD_LIMIT_COUNT, "Count"))
+    .AddAttribute ("LatenessStatistics",
+                   "Whether to gather the lateness statistics of the events "
+                   "in SynchronizationMode=BestEffort, at the cost of a "
+                   "real-time clock read per event "
+                   "(they are always gathered with SynchronizationMode=HardLimit)",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&RealtimeSimulatorImpl::m_latenessStatistics),
+                   MakeBooleanChecker ())
   ;
   return tid;
 }
@@ -91,6 +106,9 @@ RealtimeSimulatorImpl::RealtimeSimulatorImpl ()
   m_currentContext = Simulator::NO_CONTEXT;
   m_unscheduledEvents = 0;
   m_eventCount = 0;
+  m_lastRealtime = 0;
+  m_latenessStatistics = false;
+  ResetLatenessStatistics ();
 
   m_main = SystemThread::Self ();
 
@@ -205,7 +223,7 @@ RealtimeSimulatorImpl::ProcessOneEvent (void)
       //
       // We use tsNow as the indication of the current real time.
       //
-      uint64_t tsNow;
+      uint64_t tsNow = 0;
 
       {
         CriticalSection cs (m_mutex);
@@ -229,27 +247,38 @@ RealtimeSimulatorImpl::ProcessOneEvent (void)
         //
         // tsNext is the simulation time of the next event we want to execute.
         //
-        tsNow = m_synchronizer->GetCurrentRealtime ();
         tsNext = NextTs ();
 
         //
-        // tsDelay is therefore the real time we need to delay in order to bring the
-        // real time in sync with the simulation time.  If we wait for this amount of
-        // real time, we will accomplish moving the simulation time at the same rate
-        // as the real time.  This is typically called "pacing" the simulation time.
-        //
-        // We do have to be careful if we are falling behind.  If so, tsDelay must be
-        // zero.  If we're late, don't dawdle.
+        // Real time never goes backward, so if the next event is not later than
+        // the last real time we read, it is already due and we can skip reading
+        // the clock.  This lets a burst of overdue events run back to back
+        // without a clock read or a trip through the synchronizer for each one.
         //
-        if (tsNext <= tsNow)
+        if (tsNext > m_lastRealtime)
           {
-            tsDelay = 0;
+            tsNow = m_synchronizer->GetCurrentRealtime ();
+            m_lastRealtime = tsNow;
           }
-        else
+
+        //
+        // We do have to be careful if we are falling behind.  If so, there is
+        // no delay at all and the synchronizer has nothing to do for us.  If
+        // we're late, don't dawdle.
+        //
+        if (tsNext <= m_lastRealtime)
           {
-            tsDelay = tsNext - tsNow;
+            break;
           }
 
+        //
+        // tsDelay is therefore the real time we need to delay in order to bring the
+        // real time in sync with the simulation time.  If we wait for this amount of
+        // real time, we will accomplish moving the simulation time at the same rate
+        // as the real time.  This is typically called "pacing" the simulation time.
+        //
+        tsDelay = tsNext - tsNow;
+
         //
         // We've figured out how long we need to delay in order to pace the
         // simulation time with the real time.  We're going to sleep, but need
@@ -356,29 +385,45 @@ RealtimeSimulatorImpl::ProcessOneEvent (void)
     // We're about to run the event and we've done our best to synchronize this
     // event execution time to real time.  Now, if we're in SYNC_HARD_LIMIT mode
     // we have to decide if we've done a good enough job and if we haven't, we've
-    // been asked to commit ritual suicide.
+    // been asked to either commit ritual suicide or at least own up to it.
     //
     // We check the simulation time against the current real time to make this
-    // judgement.
+    // judgement, and record how late we are for the lateness statistics.  The
+    // clock is not read otherwise, so that a burst of due events runs without
+    // a clock read per event.
     //
-    if (m_synchronizationMode == SYNC_HARD_LIMIT)
+    if (m_synchronizationMode == SYNC_HARD_LIMIT || m_latenessStatistics)
       {
         uint64_t tsFinal = m_synchronizer->GetCurrentRealtime ();
+        m_lastRealtime = tsFinal;
         uint64_t tsJitter;
 
         if (tsFinal >= m_currentTs)
           {
             tsJitter = tsFinal - m_currentTs;
+            Time lateness = TimeStep (tsJitter);
+            m_lateness.totalLateness += lateness;
+            if (lateness > m_lateness.maxLateness)
+              {
+                m_lateness.maxLateness = lateness;
+              }
           }
         else
           {
             tsJitter = m_currentTs - tsFinal;
           }
+        m_lateness.events++;
 
-        if (tsJitter > static_cast<uint64_t> (m_hardLimit.GetTimeStep ()))
+        if (m_synchronizationMode == SYNC_HARD_LIMIT
+            && tsJitter > static_cast<uint64_t> (m_hardLimit.GetTimeStep ()))
           {
-            NS_FATAL_ERROR ("RealtimeSimulatorImpl::ProcessOneEvent (): "
-                            "Hard real-time limit exceeded (jitter = " << tsJitter << ")");
+            m_lateness.hardLimitViolations++;
+            if (m_hardLimitPolicy == HARD_LIMIT_FATAL)
+              {
+                NS_FATAL_ERROR ("RealtimeSimulatorImpl::ProcessOneEvent (): "
+                                "Hard real-time limit exceeded (jitter = " << tsJitter << ")");
+              }
+            NS_LOG_WARN ("Hard real-time limit exceeded (jitter = " << tsJitter << ")");
           }
       }
   }
@@ -433,6 +478,7 @@ RealtimeSimulatorImpl::Run (void)
   m_stop = false;
   m_running = true;
   m_synchronizer->SetOrigin (m_currentTs);
+  m_lastRealtime = 0;
 
   // Sleep until signalled
   uint64_t tsNow = 0;
@@ -853,4 +899,37 @@ RealtimeSimulatorImpl::GetHardLimit (void) const
   return m_hardLimit;
 }
 
+void
+RealtimeSimulatorImpl::SetHardLimitPolicy (enum HardLimitPolicy policy)
+{
+  NS_LOG_FUNCTION (this << policy);
+  m_hardLimitPolicy = policy;
+}
+
+RealtimeSimulatorImpl::HardLimitPolicy
+RealtimeSimulatorImpl::GetHardLimitPolicy (void) const
+{
+  NS_LOG_FUNCTION (this);
+  return m_hardLimitPolicy;
+}
+
+RealtimeSimulatorImpl::LatenessStatistics
+RealtimeSimulatorImpl::GetLatenessStatistics (void) const
+{
+  NS_LOG_FUNCTION (this);
+  CriticalSection cs (m_mutex);
+  return m_lateness;
+}
+
+void
+RealtimeSimulatorImpl::ResetLatenessStatistics (void)
+{
+  NS_LOG_FUNCTION (this);
+  CriticalSection cs (m_mutex);
+  m_lateness.events = 0;
+  m_lateness.maxLateness = Time (0);
+  m_lateness.totalLateness = Time (0);
+  m_lateness.hardLimitViolations = 0;
+}
+
 } // namespace ns3
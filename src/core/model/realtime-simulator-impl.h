@@ -84,6 +84,39 @@ public:
     SYNC_HARD_LIMIT,
   };
 
+  /**
+   * What to do when an event misses the SYNC_HARD_LIMIT tolerance.
+   */
+  enum HardLimitPolicy
+  {
+    /** Exceeding the hard limit triggers a fatal error. */
+    HARD_LIMIT_FATAL,
+    /**
+     * Exceeding the hard limit is logged and counted in the
+     * LatenessStatistics, and the simulation keeps going.
+     */
+    HARD_LIMIT_COUNT,
+  };
+
+  /**
+   * Real-time lateness of the events run since the simulation started,
+   * or since the last call to ResetLatenessStatistics.
+   *
+   * The statistics are only gathered with SYNC_HARD_LIMIT, or when the
+   * \c LatenessStatistics attribute is \c true.
+   *
+   * The lateness of an event is how far real time had passed the event
+   * timestamp when the event was dispatched.  The mean lateness is
+   * \c totalLateness divided by \c events.
+   */
+  struct LatenessStatistics
+  {
+    uint64_t events;              //!< Number of events dispatched.
+    Time maxLateness;             //!< Largest lateness seen.
+    Time totalLateness;           //!< Sum of the lateness of all events.
+    uint64_t hardLimitViolations; //!< Events outside the hard limit.
+  };
+
   /** Constructor. */
   RealtimeSimulatorImpl ();
   /** Destructor. */
@@ -156,6 +189,26 @@ public:
    */
   Time GetHardLimit (void) const;
 
+  /**
+   * Set the HardLimitPolicy.
+   *
+   * \param [in] policy The new HardLimitPolicy.
+   */
+  void SetHardLimitPolicy (RealtimeSimulatorImpl::HardLimitPolicy policy);
+  /**
+   * Get the HardLimitPolicy.
+   * \returns The current HardLimitPolicy.
+   */
+  RealtimeSimulatorImpl::HardLimitPolicy GetHardLimitPolicy (void) const;
+
+  /**
+   * Get the lateness statistics gathered so far.
+   * \returns The lateness statistics.
+   */
+  LatenessStatistics GetLatenessStatistics (void) const;
+  /** Clear the lateness statistics. */
+  void ResetLatenessStatistics (void);
+
 private:
   /**
    * Is the simulator running?
@@ -206,6 +259,13 @@ private:
   uint32_t m_currentContext;
   /** The event count. */
   uint64_t m_eventCount;
+  /**
+   * The most recent normalized real time read from the synchronizer.
+   * Any event with a timestamp at or before it is already due.
+   */
+  uint64_t m_lastRealtime;
+  /** Lateness of the events run so far. */
+  LatenessStatistics m_lateness;
   /**@}*/
 
   /** Mutex to control access to key state. */
@@ -220,6 +280,12 @@ private:
   /** The maximum allowable drift from real-time in SYNC_HARD_LIMIT mode. */
   Time m_hardLimit;
 
+  /** What to do when an event misses #m_hardLimit. */
+  HardLimitPolicy m_hardLimitPolicy;
+
+  /** Whether to gather the lateness statistics with SYNC_BEST_EFFORT. */
+  bool m_latenessStatistics;
+
   /** Main SystemThread. */
   SystemThread::ThreadId m_main;
 };
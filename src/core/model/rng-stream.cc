@@ -389,6 +389,36 @@ RngStream::RngStream (const RngStream& r)
     }
 }
 
+void
+RngStream::GetState (double state[6]) const
+{
+  for (int i = 0; i < 6; ++i)
+    {
+      state[i] = m_currentState[i];
+    }
+}
+
+void
+RngStream::SetState (const double state[6])
+{
+  for (int i = 0; i < 3; ++i)
+    {
+      if (state[i] < 0 || state[i] >= m1 || state[i + 3] < 0 || state[i + 3] >= m2)
+        {
+          NS_FATAL_ERROR ("invalid RngStream state component " << i);
+        }
+    }
+  if ((state[0] == 0 && state[1] == 0 && state[2] == 0)
+      || (state[3] == 0 && state[4] == 0 && state[5] == 0))
+    {
+      NS_FATAL_ERROR ("invalid RngStream state: a component is all zero");
+    }
+  for (int i = 0; i < 6; ++i)
+    {
+      m_currentState[i] = state[i];
+    }
+}
+
 void
 RngStream::AdvanceNthBy (uint64_t nth, int by, double state[6])
 {
@@ -71,6 +71,22 @@ public:
    */
   double RandU01 (void);
 
+  /**
+   * Get the current state of this stream.
+   *
+   * Together with SetState() this allows a stream to be checkpointed
+   * and later resumed at exactly the same position.
+   *
+   * \param [out] state The six-element state vector.
+   */
+  void GetState (double state[6]) const;
+  /**
+   * Restore a state previously obtained from GetState().
+   *
+   * \param [in] state The six-element state vector.
+   */
+  void SetState (const double state[6]);
+
 private:
   /**
    * Advance \pname{state} of the RNG by leaps and bounds.
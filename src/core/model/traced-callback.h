@@ -21,7 +21,7 @@
 #ifndef TRACED_CALLBACK_H
 #define TRACED_CALLBACK_H
 
-#include <list>
+#include <vector>
 #include "callback.h"
 
 /**
@@ -46,6 +46,12 @@ namespace ns3 {
  * calling the \c operator() form with the appropriate
  * number of arguments.
  *
+ * The chain is stored contiguously and the \c operator() returns
+ * immediately when it is empty, so that firing a trace source which
+ * is not connected costs little more than copying its arguments.  When
+ * the arguments are expensive to build, IsEmpty can be called to skip
+ * building them.
+ *
  * \tparam Ts \explicit Types of the functor arguments.
  */
 template<typename... Ts>
@@ -89,6 +95,11 @@ public:
    * \param [in] args The arguments to the functor
    */
   void operator() (Ts... args) const;
+  /**
+   * \brief Checks if the chain of Callbacks is empty.
+   * \return \c true if no Callback is connected.
+   */
+  bool IsEmpty () const;
 
   /**
    *  TracedCallback signature for POD.
@@ -107,7 +118,7 @@ private:
    *
    * \tparam Ts \deduced Types of the functor arguments.
    */
-  typedef std::list<Callback<void,Ts...> > CallbackList;
+  typedef std::vector<Callback<void,Ts...> > CallbackList;
   /** The chain of Callbacks. */
   CallbackList m_callbackList;
 };
@@ -178,16 +189,28 @@ TracedCallback<Ts...>::Disconnect (const CallbackBase & callback, std::string pa
   DisconnectWithoutContext (realCb);
 }
 template<typename... Ts>
-void
+inline void
 TracedCallback<Ts...>::operator() (Ts... args) const
 {
-  for (typename CallbackList::const_iterator i = m_callbackList.begin ();
-       i != m_callbackList.end (); i++)
+  if (m_callbackList.empty ())
+    {
+      return;
+    }
+  // Index the chain on every iteration, as a Callback may connect
+  // another one, which reallocates the chain.
+  for (std::size_t i = 0; i < m_callbackList.size (); i++)
     {
-      (*i)(args...);
+      m_callbackList[i] (args...);
     }
 }
 
+template<typename... Ts>
+inline bool
+TracedCallback<Ts...>::IsEmpty () const
+{
+  return m_callbackList.empty ();
+}
+
 } // namespace ns3
 
 #endif /* TRACED_CALLBACK_H */
@@ -23,7 +23,7 @@
 #include "singleton.h"
 #include "trace-source-accessor.h"
 
-#include <map>
+#include <unordered_map>
 #include <vector>
 #include <sstream>
 #include <iomanip>
@@ -51,7 +51,13 @@ NS_LOG_COMPONENT_DEFINE ("TypeId");
  * \brief TypeId information manager
  *
  * Information records are stored in a vector.  Name and hash lookup
- * are performed by maps to the vector index.
+ * are performed by hash tables mapping to the vector index.
+ *
+ * Each record also keeps a lazily built index of all the attributes
+ * and trace sources visible from that type id, including the ones
+ * inherited from its parents, so lookups by name do not have to walk
+ * the inheritance chain.  The indexes are rebuilt when an attribute,
+ * trace source or parent is registered after they were built.
  *
  * \internal
  * <b>Hash Chaining</b>
@@ -182,6 +188,11 @@ public:
    * \returns The type id.
    */
   uint16_t GetRegistered (uint16_t i) const;
+  /**
+   * Get the attribute generation counter.
+   * \returns The number of attribute registrations and initial value changes.
+   */
+  uint32_t GetAttributeGeneration (void) const;
   /**
    * Record a new attribute in a type id.
    * \param [in] uid The id.
@@ -264,6 +275,26 @@ public:
    * \returns Detailed information about the requested trace source.
    */
   struct TypeId::TraceSourceInformation GetTraceSource (uint16_t uid, std::size_t i) const;
+  /**
+   * Find an Attribute by name in a type id or its parents.
+   * \param [in] uid The id.
+   * \param [in] name The Attribute name.
+   * \param [out] owner The id of the type which registered the Attribute.
+   * \param [out] i The index of the Attribute in \pname{owner}.
+   * \returns \c true if the Attribute was found.
+   */
+  bool LookupAttribute (uint16_t uid, const std::string &name,
+                        uint16_t *owner, std::size_t *i) const;
+  /**
+   * Find a TraceSource by name in a type id or its parents.
+   * \param [in] uid The id.
+   * \param [in] name The TraceSource name.
+   * \param [out] owner The id of the type which registered the TraceSource.
+   * \param [out] i The index of the TraceSource in \pname{owner}.
+   * \returns \c true if the TraceSource was found.
+   */
+  bool LookupTraceSource (uint16_t uid, const std::string &name,
+                          uint16_t *owner, std::size_t *i) const;
   /**
    * Check if this TypeId should not be listed in documentation.
    * \param [in] uid The id.
@@ -293,6 +324,21 @@ private:
    */
   static TypeId::hash_t Hasher (const std::string name);
 
+  /**
+   * Position of an Attribute or TraceSource: the id of the type which
+   * registered it and its index in that type.
+   */
+  typedef std::pair<uint16_t, std::size_t> position_t;
+  /** Type of the by-name Attribute and TraceSource indexes. */
+  typedef std::unordered_map<std::string, position_t> index_t;
+
+  /**
+   * Build the Attribute and TraceSource indexes of a type id,
+   * if they are missing or out of date.
+   * \param [in] uid The id.
+   */
+  void BuildIndexes (uint16_t uid) const;
+
   /** The information record about a single type id. */
   struct IidInformation
   {
@@ -320,6 +366,12 @@ private:
     TypeId::SupportLevel supportLevel;
     /** Support message. */
     std::string supportMsg;
+    /** m_registrationGeneration when the indexes were built. */
+    uint32_t indexGeneration;
+    /** All Attributes visible from this type id, by name. */
+    index_t attributeIndex;
+    /** All TraceSources visible from this type id, by name. */
+    index_t traceSourceIndex;
   };
   /** Iterator type. */
   typedef std::vector<struct IidInformation>::const_iterator Iterator;
@@ -335,15 +387,22 @@ private:
   std::vector<struct IidInformation> m_information;
 
   /** Type of the by-name index. */
-  typedef std::map<std::string, uint16_t> namemap_t;
+  typedef std::unordered_map<std::string, uint16_t> namemap_t;
   /** The by-name index. */
   namemap_t m_namemap;
 
   /** Type of the by-hash index. */
-  typedef std::map<TypeId::hash_t, uint16_t> hashmap_t;
+  typedef std::unordered_map<TypeId::hash_t, uint16_t> hashmap_t;
   /** The by-hash index. */
   hashmap_t m_hashmap;
 
+  /** Attribute registrations and initial value changes so far. */
+  uint32_t m_attributeGeneration {0};
+  /**
+   * Attribute, TraceSource and parent registrations so far.
+   * Starts at 1 so that new records have out of date indexes.
+   */
+  uint32_t m_registrationGeneration {1};
 
   /** IidManager constants. */
   enum
@@ -443,6 +502,7 @@ IidManager::AllocateUid (std::string name)
   information.hasConstructor = false;
   information.mustHideFromDocumentation = false;
   information.supportLevel = TypeId::SUPPORTED;
+  information.indexGeneration = 0;
   m_information.push_back (information);
   std::size_t tuid = m_information.size ();
   NS_ASSERT (tuid <= 0xffff);
@@ -471,6 +531,7 @@ IidManager::SetParent (uint16_t uid, uint16_t parent)
   NS_ASSERT (parent <= m_information.size ());
   struct IidInformation *information = LookupInformation (uid);
   information->parent = parent;
+  ++m_registrationGeneration;
 }
 void
 IidManager::SetGroupName (uint16_t uid, std::string groupName)
@@ -611,36 +672,23 @@ IidManager::GetRegistered (uint16_t i) const
   NS_LOG_FUNCTION (IID << i);
   return i + 1;
 }
+uint32_t
+IidManager::GetAttributeGeneration (void) const
+{
+  NS_LOG_FUNCTION (IID);
+  return m_attributeGeneration;
+}
 
 bool
 IidManager::HasAttribute (uint16_t uid,
                           std::string name)
 {
   NS_LOG_FUNCTION (IID << uid << name);
-  struct IidInformation *information  = LookupInformation (uid);
-  while (true)
-    {
-      for (std::vector<struct TypeId::AttributeInformation>::const_iterator i = information->attributes.begin ();
-           i != information->attributes.end (); ++i)
-        {
-          if (i->name == name)
-            {
-              NS_LOG_LOGIC (IIDL << true);
-              return true;
-            }
-        }
-      struct IidInformation *parent = LookupInformation (information->parent);
-      if (parent == information)
-        {
-          // top of inheritance tree
-          NS_LOG_LOGIC (IIDL << false);
-          return false;
-        }
-      // check parent
-      information = parent;
-    }
-  NS_LOG_LOGIC (IIDL << false);
-  return false;
+  uint16_t owner;
+  std::size_t i;
+  bool found = LookupAttribute (uid, name, &owner, &i);
+  NS_LOG_LOGIC (IIDL << found);
+  return found;
 }
 
 void
@@ -681,6 +729,8 @@ IidManager::AddAttribute (uint16_t uid,
   info.supportLevel = supportLevel;
   info.supportMsg = supportMsg;
   information->attributes.push_back (info);
+  ++m_attributeGeneration;
+  ++m_registrationGeneration;
   NS_LOG_LOGIC (IIDL << information->attributes.size () - 1);
 }
 void
@@ -692,6 +742,7 @@ IidManager::SetAttributeInitialValue (uint16_t uid,
   struct IidInformation *information = LookupInformation (uid);
   NS_ASSERT (i < information->attributes.size ());
   information->attributes[i].initialValue = initialValue;
+  ++m_attributeGeneration;
 }
 
 
@@ -720,30 +771,11 @@ IidManager::HasTraceSource (uint16_t uid,
                             std::string name)
 {
   NS_LOG_FUNCTION (IID << uid << name);
-  struct IidInformation *information  = LookupInformation (uid);
-  while (true)
-    {
-      for (std::vector<struct TypeId::TraceSourceInformation>::const_iterator i = information->traceSources.begin ();
-           i != information->traceSources.end (); ++i)
-        {
-          if (i->name == name)
-            {
-              NS_LOG_LOGIC (IIDL << true);
-              return true;
-            }
-        }
-      struct IidInformation *parent = LookupInformation (information->parent);
-      if (parent == information)
-        {
-          // top of inheritance tree
-          NS_LOG_LOGIC (IIDL << false);
-          return false;
-        }
-      // check parent
-      information = parent;
-    }
-  NS_LOG_LOGIC (IIDL << false);
-  return false;
+  uint16_t owner;
+  std::size_t i;
+  bool found = LookupTraceSource (uid, name, &owner, &i);
+  NS_LOG_LOGIC (IIDL << found);
+  return found;
 }
 
 void
@@ -773,6 +805,7 @@ IidManager::AddTraceSource (uint16_t uid,
   source.supportLevel = supportLevel;
   source.supportMsg = supportMsg;
   information->traceSources.push_back (source);
+  ++m_registrationGeneration;
   NS_LOG_LOGIC (IIDL << information->traceSources.size () - 1);
 }
 std::size_t
@@ -793,6 +826,78 @@ IidManager::GetTraceSource (uint16_t uid, std::size_t i) const
   NS_LOG_LOGIC (IIDL << information->name);
   return information->traceSources[i];
 }
+
+void
+IidManager::BuildIndexes (uint16_t uid) const
+{
+  NS_LOG_FUNCTION (IID << uid);
+  struct IidInformation *information = LookupInformation (uid);
+  if (information->indexGeneration == m_registrationGeneration)
+    {
+      return;
+    }
+  information->attributeIndex.clear ();
+  information->traceSourceIndex.clear ();
+  // Walk up from this type, so that an entry registered by a child
+  // hides an entry with the same name registered by a parent.
+  uint16_t current = uid;
+  while (true)
+    {
+      struct IidInformation *c = LookupInformation (current);
+      for (std::size_t i = 0; i < c->attributes.size (); ++i)
+        {
+          information->attributeIndex.insert (std::make_pair (c->attributes[i].name,
+                                                              position_t (current, i)));
+        }
+      for (std::size_t i = 0; i < c->traceSources.size (); ++i)
+        {
+          information->traceSourceIndex.insert (std::make_pair (c->traceSources[i].name,
+                                                                position_t (current, i)));
+        }
+      if (c->parent == current || c->parent == 0)
+        {
+          // top of inheritance tree
+          break;
+        }
+      current = c->parent;
+    }
+  information->indexGeneration = m_registrationGeneration;
+}
+
+bool
+IidManager::LookupAttribute (uint16_t uid, const std::string &name,
+                             uint16_t *owner, std::size_t *i) const
+{
+  NS_LOG_FUNCTION (IID << uid << name);
+  BuildIndexes (uid);
+  struct IidInformation *information = LookupInformation (uid);
+  index_t::const_iterator it = information->attributeIndex.find (name);
+  if (it == information->attributeIndex.end ())
+    {
+      return false;
+    }
+  *owner = it->second.first;
+  *i = it->second.second;
+  return true;
+}
+
+bool
+IidManager::LookupTraceSource (uint16_t uid, const std::string &name,
+                               uint16_t *owner, std::size_t *i) const
+{
+  NS_LOG_FUNCTION (IID << uid << name);
+  BuildIndexes (uid);
+  struct IidInformation *information = LookupInformation (uid);
+  index_t::const_iterator it = information->traceSourceIndex.find (name);
+  if (it == information->traceSourceIndex.end ())
+    {
+      return false;
+    }
+  *owner = it->second.first;
+  *i = it->second.second;
+  return true;
+}
+
 bool
 IidManager::MustHideFromDocumentation (uint16_t uid) const
 {
@@ -878,45 +983,37 @@ TypeId::GetRegistered (uint16_t i)
   NS_LOG_FUNCTION (i);
   return TypeId (IidManager::Get ()->GetRegistered (i));
 }
+uint32_t
+TypeId::GetAttributeGeneration (void)
+{
+  NS_LOG_FUNCTION_NOARGS ();
+  return IidManager::Get ()->GetAttributeGeneration ();
+}
 
 bool
 TypeId::LookupAttributeByName (std::string name, struct TypeId::AttributeInformation *info) const
 {
   NS_LOG_FUNCTION (this << name << info);
-  TypeId tid;
-  TypeId nextTid = *this;
-  do
+  uint16_t owner;
+  std::size_t i;
+  if (!IidManager::Get ()->LookupAttribute (m_tid, name, &owner, &i))
     {
-      tid = nextTid;
-      for (std::size_t i = 0; i < tid.GetAttributeN (); i++)
-        {
-          struct TypeId::AttributeInformation tmp = tid.GetAttribute (i);
-          if (tmp.name == name)
-            {
-              if (tmp.supportLevel == TypeId::SUPPORTED)
-                {
-                  *info = tmp;
-                  return true;
-                }
-              else if (tmp.supportLevel == TypeId::DEPRECATED)
-                {
-                  std::cerr << "Attribute '" << name << "' is deprecated: "
-                            << tmp.supportMsg << std::endl;
-                  *info = tmp;
-                  return true;
-                }
-              else if (tmp.supportLevel == TypeId::OBSOLETE)
-                {
-                  NS_FATAL_ERROR ("Attribute '" << name <<
-                                  "' is obsolete, with no fallback: " <<
-                                  tmp.supportMsg);
-                }
-            }
-        }
-      nextTid = tid.GetParent ();
+      return false;
+    }
+  struct TypeId::AttributeInformation tmp = IidManager::Get ()->GetAttribute (owner, i);
+  if (tmp.supportLevel == TypeId::DEPRECATED)
+    {
+      std::cerr << "Attribute '" << name << "' is deprecated: "
+                << tmp.supportMsg << std::endl;
     }
-  while (nextTid != tid);
-  return false;
+  else if (tmp.supportLevel == TypeId::OBSOLETE)
+    {
+      NS_FATAL_ERROR ("Attribute '" << name <<
+                      "' is obsolete, with no fallback: " <<
+                      tmp.supportMsg);
+    }
+  *info = tmp;
+  return true;
 }
 
 TypeId
@@ -1137,41 +1234,26 @@ TypeId::LookupTraceSourceByName (std::string name,
                                  struct TraceSourceInformation *info) const
 {
   NS_LOG_FUNCTION (this << name);
-  TypeId tid;
-  TypeId nextTid = *this;
-  struct TypeId::TraceSourceInformation tmp;
-  do
+  uint16_t owner;
+  std::size_t i;
+  if (!IidManager::Get ()->LookupTraceSource (m_tid, name, &owner, &i))
     {
-      tid = nextTid;
-      for (std::size_t i = 0; i < tid.GetTraceSourceN (); i++)
-        {
-          tmp = tid.GetTraceSource (i);
-          if (tmp.name == name)
-            {
-              if (tmp.supportLevel == TypeId::SUPPORTED)
-                {
-                  *info = tmp;
-                  return tmp.accessor;
-                }
-              else if (tmp.supportLevel == TypeId::DEPRECATED)
-                {
-                  std::cerr << "TraceSource '" << name << "' is deprecated: "
-                            << tmp.supportMsg << std::endl;
-                  *info = tmp;
-                  return tmp.accessor;
-                }
-              else if (tmp.supportLevel == TypeId::OBSOLETE)
-                {
-                  NS_FATAL_ERROR ("TraceSource '" << name <<
-                                  "' is obsolete, with no fallback: " <<
-                                  tmp.supportMsg);
-                }
-            }
-        }
-      nextTid = tid.GetParent ();
+      return 0;
+    }
+  struct TypeId::TraceSourceInformation tmp = IidManager::Get ()->GetTraceSource (owner, i);
+  if (tmp.supportLevel == TypeId::DEPRECATED)
+    {
+      std::cerr << "TraceSource '" << name << "' is deprecated: "
+                << tmp.supportMsg << std::endl;
+    }
+  else if (tmp.supportLevel == TypeId::OBSOLETE)
+    {
+      NS_FATAL_ERROR ("TraceSource '" << name <<
+                      "' is obsolete, with no fallback: " <<
+                      tmp.supportMsg);
     }
-  while (nextTid != tid);
-  return 0;
+  *info = tmp;
+  return tmp.accessor;
 }
 
 Ptr<const TraceSourceAccessor>
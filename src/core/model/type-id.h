@@ -167,6 +167,17 @@ public:
    * \returns The TypeId instance whose index is \c i.
    */
   static TypeId GetRegistered (uint16_t i);
+  /**
+   * Get the attribute generation counter.
+   *
+   * The counter is incremented whenever an attribute is registered
+   * or the initial value of an attribute is changed, so callers caching
+   * resolved attribute information (such as ObjectFactory) can detect
+   * when their cache has become stale.
+   *
+   * \returns The current attribute generation.
+   */
+  static uint32_t GetAttributeGeneration (void);
 
   /**
    * Constructor.
@@ -17,11 +17,12 @@
  */
 
 
-#include <ctime>       // clock_t
+#include <ctime>       // clock_t, clock_gettime
 #include <sys/time.h>  // gettimeofday
                        // clock_getres: glibc < 2.17, link with librt
 
 #include "log.h"
+#include "boolean.h"
 #include "system-condition.h"
 
 #include "wall-clock-synchronizer.h"
@@ -44,6 +45,13 @@ WallClockSynchronizer::GetTypeId (void)
   static TypeId tid = TypeId ("ns3::WallClockSynchronizer")
     .SetParent<Synchronizer> ()
     .SetGroupName ("Core")
+    .AddAttribute ("BusyPoll",
+                   "Busy-wait on the clock for every delay instead of "
+                   "sleeping, for the lowest wake-up jitter at the cost "
+                   "of a fully loaded core.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&WallClockSynchronizer::m_busyPoll),
+                   MakeBooleanChecker ())
   ;
   return tid;
 }
@@ -225,7 +233,7 @@ WallClockSynchronizer::DoSynchronize (uint64_t nsCurrent, uint64_t nsDelay)
 //
 // \todo Hardcoded tunable parameter below.
 //
-  if (numberJiffies > 3)
+  if (!m_busyPoll && numberJiffies > 3)
     {
       NS_LOG_INFO ("SleepWait for " << numberJiffies * m_jiffy << " ns");
       NS_LOG_INFO ("SleepWait until " << nsCurrent + numberJiffies * m_jiffy
@@ -287,7 +295,14 @@ WallClockSynchronizer::DoSignal (void)
   NS_LOG_FUNCTION (this);
 
   m_condition.SetCondition (true);
-  m_condition.Signal ();
+//
+// A busy-polling synchronizer never sleeps on the condition, it sees the
+// flag on its next spin; so don't pay for waking up a sleeper.
+//
+  if (!m_busyPoll)
+    {
+      m_condition.Signal ();
+    }
 }
 
 void
@@ -374,9 +389,15 @@ uint64_t
 WallClockSynchronizer::GetRealtime (void)
 {
   NS_LOG_FUNCTION (this);
+#ifdef CLOCK_REALTIME
+  struct timespec tsNow;
+  clock_gettime (CLOCK_REALTIME, &tsNow);
+  return tsNow.tv_sec * NS_PER_SEC + tsNow.tv_nsec;
+#else
   struct timeval tvNow;
   gettimeofday (&tvNow, NULL);
   return TimevalToNs (&tvNow);
+#endif
 }
 
 uint64_t
@@ -60,6 +60,11 @@ namespace ns3 {
  * to use the function @c clock_nanosleep() to sleep until a simulation Time
  * specified by the caller.
  *
+ * When the events are only a few microseconds apart, as in emulation at
+ * line rate, even the wake-up latency of the sleep is too much.  Setting
+ * the @c BusyPoll attribute keeps the synchronizer spinning on the clock
+ * for every wait instead, trading a fully busy core for low jitter.
+ *
  * @todo Add more on jiffies, sleep, processes, etc.
  *
  * @internal
@@ -196,6 +201,9 @@ protected:
 
   /** Thread synchronizer. */
   SystemCondition m_condition;
+
+  /** Spin on the clock instead of sleeping on #m_condition. */
+  bool m_busyPoll;
 };
 
 } // namespace ns3
@@ -0,0 +1,114 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2021
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// Only the error and warning levels are compiled in this file,
+// whatever the --logs-compiled configure option
+#undef NS_LOG_STATIC_MASK
+#define NS_LOG_STATIC_MASK ns3::LOG_LEVEL_WARN
+
+#include "ns3/log.h"
+#include "ns3/test.h"
+
+#include <sstream>
+
+/**
+ * \file
+ * \ingroup core-tests
+ * \ingroup logging
+ * \ingroup log-tests
+ * Logging macros test suite.
+ */
+
+/**
+ * \ingroup core-tests
+ * \defgroup log-tests Logging macros test suite
+ */
+
+namespace ns3 {
+
+namespace tests {
+
+NS_LOG_COMPONENT_DEFINE ("LogTestSuite");
+
+/**
+ * \ingroup log-tests
+ * Check that the log messages are only evaluated when their level is
+ * compiled in and enabled.
+ */
+class LogStaticMaskTestCase : public TestCase
+{
+public:
+  LogStaticMaskTestCase ();
+  virtual ~LogStaticMaskTestCase ()
+  {}
+
+private:
+  virtual void DoRun (void);
+};
+
+LogStaticMaskTestCase::LogStaticMaskTestCase (void)
+  : TestCase ("Check the log levels compiled in")
+{}
+
+void
+LogStaticMaskTestCase::DoRun (void)
+{
+  int evaluations = 0;
+  std::ostringstream os;
+  std::streambuf *clogBuf = std::clog.rdbuf (os.rdbuf ());
+
+  LogComponentEnable ("LogTestSuite", LOG_LEVEL_ALL);
+  NS_LOG_FUNCTION (++evaluations);
+  NS_LOG_INFO ("info " << ++evaluations);
+  NS_LOG_WARN ("warn " << ++evaluations);
+  LogComponentDisable ("LogTestSuite", LOG_WARN);
+  NS_LOG_WARN ("warn " << ++evaluations);
+  LogComponentDisable ("LogTestSuite", LOG_LEVEL_ALL);
+
+  std::clog.rdbuf (clogBuf);
+
+#ifdef NS3_LOG_ENABLE
+  NS_TEST_EXPECT_MSG_EQ (evaluations, 1, "Only the enabled warning must be evaluated");
+  NS_TEST_EXPECT_MSG_EQ (os.str (), "warn 1\n", "Wrong log output");
+#else
+  NS_TEST_EXPECT_MSG_EQ (evaluations, 0, "No message must be evaluated");
+  NS_TEST_EXPECT_MSG_EQ (os.str (), "", "Wrong log output");
+#endif
+}
+
+/**
+ * \ingroup log-tests
+ * Logging macros test suite
+ */
+class LogTestSuite : public TestSuite
+{
+public:
+  LogTestSuite ();
+};
+
+LogTestSuite::LogTestSuite ()
+  : TestSuite ("log", UNIT)
+{
+  AddTestCase (new LogStaticMaskTestCase);
+}
+
+static LogTestSuite g_logTestSuite; //!< Static variable for test initialization
+
+}  // namespace tests
+
+}  // namespace ns3
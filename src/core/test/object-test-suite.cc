@@ -22,6 +22,12 @@
 #include "ns3/object.h"
 #include "ns3/object-factory.h"
 #include "ns3/assert.h"
+#include "ns3/config.h"
+#include "ns3/uinteger.h"
+#include "ns3/pointer.h"
+#include "ns3/string.h"
+#include "ns3/random-variable-stream.h"
+#include <sstream>
 
 /**
  * \file
@@ -151,10 +157,52 @@ protected:
   }
 };
 
+/**
+ * \ingroup object-tests
+ * Class with attributes, derived from BaseA.
+ */
+class AttributedA : public BaseA
+{
+public:
+  /**
+   * Register this type.
+   * \return The TypeId.
+   */
+  static ns3::TypeId GetTypeId (void)
+  {
+    static ns3::TypeId tid = ns3::TypeId ("ObjectTest:AttributedA")
+      .SetParent<BaseA> ()
+      .SetGroupName ("Core")
+      .HideFromDocumentation ()
+      .AddConstructor<AttributedA> ()
+      .AddAttribute ("First", "A first value.",
+                     ns3::UintegerValue (1),
+                     ns3::MakeUintegerAccessor (&AttributedA::m_first),
+                     ns3::MakeUintegerChecker<uint32_t> ())
+      .AddAttribute ("Second", "A second value.",
+                     ns3::UintegerValue (2),
+                     ns3::MakeUintegerAccessor (&AttributedA::m_second),
+                     ns3::MakeUintegerChecker<uint32_t> ())
+      .AddAttribute ("Random", "A random variable.",
+                     ns3::StringValue ("ns3::ConstantRandomVariable[Constant=1.0]"),
+                     ns3::MakePointerAccessor (&AttributedA::m_random),
+                     ns3::MakePointerChecker<ns3::RandomVariableStream> ());
+    return tid;
+  }
+  /** Constructor. */
+  AttributedA ()
+  {}
+
+  uint32_t m_first;   //!< First attribute.
+  uint32_t m_second;  //!< Second attribute.
+  ns3::Ptr<ns3::RandomVariableStream> m_random;  //!< Random variable attribute.
+};
+
 NS_OBJECT_ENSURE_REGISTERED (BaseA);
 NS_OBJECT_ENSURE_REGISTERED (DerivedA);
 NS_OBJECT_ENSURE_REGISTERED (BaseB);
 NS_OBJECT_ENSURE_REGISTERED (DerivedB);
+NS_OBJECT_ENSURE_REGISTERED (AttributedA);
 
 }  // unnamed namespace
 
@@ -475,6 +523,125 @@ ObjectFactoryTestCase::DoRun (void)
   NS_TEST_ASSERT_MSG_NE (a->GetObject<DerivedA> (), 0, "Unexpectedly able to work around C++ type system");
 }
 
+/**
+ * \ingroup object-tests
+ * Test the results of repeated GetObject calls as aggregates change.
+ */
+class GetObjectCacheTestCase : public TestCase
+{
+public:
+  /** Constructor. */
+  GetObjectCacheTestCase ();
+  /** Destructor. */
+  virtual ~GetObjectCacheTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+GetObjectCacheTestCase::GetObjectCacheTestCase ()
+  : TestCase ("Check GetObject results across aggregations")
+{}
+
+GetObjectCacheTestCase::~GetObjectCacheTestCase ()
+{}
+
+void
+GetObjectCacheTestCase::DoRun (void)
+{
+  Object::ResetGetObjectStatistics ();
+  Object::EnableGetObjectStatistics (true);
+
+  Ptr<BaseA> baseA = CreateObject<BaseA> ();
+  Ptr<DerivedB> derivedB = CreateObject<DerivedB> ();
+
+  //
+  // A miss must not be remembered once a matching Object is aggregated
+  //
+  NS_TEST_ASSERT_MSG_EQ (baseA->GetObject<BaseB> (), 0, "Unexpectedly found BaseB");
+  NS_TEST_ASSERT_MSG_EQ (baseA->GetObject<BaseB> (), 0, "Unexpectedly found BaseB");
+  baseA->AggregateObject (derivedB);
+
+  //
+  // Queries for a parent TypeId find the aggregated subclass, repeatedly
+  //
+  for (uint32_t i = 0; i < 3; ++i)
+    {
+      NS_TEST_ASSERT_MSG_EQ (baseA->GetObject<BaseB> (), derivedB, "BaseB query does not find DerivedB");
+      NS_TEST_ASSERT_MSG_EQ (baseA->GetObject<DerivedB> (), derivedB, "DerivedB query does not find DerivedB");
+      NS_TEST_ASSERT_MSG_EQ (derivedB->GetObject<BaseA> (), baseA, "BaseA query does not find BaseA");
+      NS_TEST_ASSERT_MSG_EQ (baseA->GetObject<DerivedA> (), 0, "Unexpectedly found DerivedA");
+    }
+
+  Object::EnableGetObjectStatistics (false);
+  std::ostringstream oss;
+  Object::PrintGetObjectStatistics (oss);
+  NS_TEST_ASSERT_MSG_NE (oss.str ().find ("ObjectTest:DerivedA lookups=3 cacheHits=2"), std::string::npos,
+                         "Unexpected GetObject statistics: " << oss.str ());
+  Object::ResetGetObjectStatistics ();
+}
+
+/**
+ * \ingroup object-tests
+ * Test an Object factory replays its attributes correctly
+ * across repeated calls to Create.
+ */
+class ObjectFactoryAttributesTestCase : public TestCase
+{
+public:
+  /** Constructor. */
+  ObjectFactoryAttributesTestCase ();
+  /** Destructor. */
+  virtual ~ObjectFactoryAttributesTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+ObjectFactoryAttributesTestCase::ObjectFactoryAttributesTestCase ()
+  : TestCase ("Check ObjectFactory attributes on repeated Create")
+{}
+
+ObjectFactoryAttributesTestCase::~ObjectFactoryAttributesTestCase ()
+{}
+
+void
+ObjectFactoryAttributesTestCase::DoRun (void)
+{
+  ObjectFactory factory;
+  factory.SetTypeId (AttributedA::GetTypeId ());
+  factory.Set ("First", UintegerValue (10));
+
+  for (uint32_t i = 0; i < 3; ++i)
+    {
+      Ptr<AttributedA> a = factory.Create<AttributedA> ();
+      NS_TEST_ASSERT_MSG_EQ (a->m_first, 10, "Factory value not applied");
+      NS_TEST_ASSERT_MSG_EQ (a->m_second, 2, "Initial value not applied");
+    }
+
+  //
+  // Changing a default after the first Create must be honored
+  //
+  Config::SetDefault ("ObjectTest:AttributedA::Second", UintegerValue (20));
+  Ptr<AttributedA> a = factory.Create<AttributedA> ();
+  NS_TEST_ASSERT_MSG_EQ (a->m_second, 20, "Changed default value not applied");
+  Config::SetDefault ("ObjectTest:AttributedA::Second", UintegerValue (2));
+
+  //
+  // Changing the factory configuration must be honored
+  //
+  factory.Set ("First", UintegerValue (11));
+  a = factory.Create<AttributedA> ();
+  NS_TEST_ASSERT_MSG_EQ (a->m_first, 11, "Changed factory value not applied");
+
+  //
+  // Values converted from a string create a new instance for each object
+  //
+  Ptr<AttributedA> b = factory.Create<AttributedA> ();
+  NS_TEST_ASSERT_MSG_NE (a->m_random, 0, "Random variable not created");
+  NS_TEST_ASSERT_MSG_NE (a->m_random, b->m_random, "Random variable shared between objects");
+}
+
 /**
  * \ingroup object-tests
  * The Test Suite that glues the Test Cases together.
@@ -492,6 +659,8 @@ ObjectTestSuite::ObjectTestSuite ()
   AddTestCase (new CreateObjectTestCase);
   AddTestCase (new AggregateObjectTestCase);
   AddTestCase (new ObjectFactoryTestCase);
+  AddTestCase (new ObjectFactoryAttributesTestCase);
+  AddTestCase (new GetObjectCacheTestCase);
 }
 
 /**
@@ -2436,6 +2436,59 @@ NormalCachingTestCase::DoRun (void)
   NS_TEST_ASSERT_MSG_GT (v2, 0, "Incorrect value returned, expected > 0");
 }
 
+/**
+ * Test case for saving and restoring the RngStream state.
+ */
+class RngStateTestCase : public TestCaseBase
+{
+public:
+  // Constructor
+  RngStateTestCase ();
+
+private:
+  // Inherited
+  virtual void DoRun (void);
+};
+
+RngStateTestCase::RngStateTestCase ()
+  : TestCaseBase ("RandomVariableStream save and restore of RngStream state")
+{}
+
+void
+RngStateTestCase::DoRun (void)
+{
+  NS_LOG_FUNCTION (this);
+  SetTestSuiteSeed ();
+
+  Ptr<UniformRandomVariable> u = CreateObject<UniformRandomVariable> ();
+  for (uint32_t i = 0; i < 100; ++i)
+    {
+      u->GetValue ();
+    }
+
+  std::vector<double> state = u->GetRngState ();
+  std::vector<double> expected;
+  for (uint32_t i = 0; i < 100; ++i)
+    {
+      expected.push_back (u->GetValue ());
+    }
+
+  // Resuming the same stream replays the values drawn after the checkpoint.
+  u->SetRngState (state);
+  for (uint32_t i = 0; i < 100; ++i)
+    {
+      NS_TEST_ASSERT_MSG_EQ (u->GetValue (), expected[i], "Value " << i << " differs after restore");
+    }
+
+  // The state can also be transplanted into a freshly created stream.
+  Ptr<UniformRandomVariable> v = CreateObject<UniformRandomVariable> ();
+  v->SetRngState (state);
+  for (uint32_t i = 0; i < 100; ++i)
+    {
+      NS_TEST_ASSERT_MSG_EQ (v->GetValue (), expected[i], "Value " << i << " differs in new stream");
+    }
+}
+
 /**
  * RandomVariableStream test suite, covering all random number variable
  * stream generator types.
@@ -2487,6 +2540,7 @@ RandomVariableSuite::RandomVariableSuite ()
   AddTestCase (new EmpiricalAntitheticTestCase);
   /// Issue #302:  NormalRandomVariable produces stale values
   AddTestCase (new NormalCachingTestCase);
+  AddTestCase (new RngStateTestCase);
 }
 
 static RandomVariableSuite randomVariableSuite;
@@ -24,6 +24,11 @@
 #include "ns3/map-scheduler.h"
 #include "ns3/calendar-scheduler.h"
 #include "ns3/priority-queue-scheduler.h"
+#include "ns3/realtime-simulator-impl.h"
+#include "ns3/config.h"
+#include "ns3/string.h"
+#include "ns3/boolean.h"
+#include "ns3/enum.h"
 
 using namespace ns3;
 
@@ -465,6 +470,86 @@ SimulatorTemplateTestCase::DoRun (void)
   Simulator::Destroy ();
 }
 
+class RealtimeLatenessTestCase : public TestCase
+{
+public:
+  RealtimeLatenessTestCase ();
+  virtual void DoSetup (void);
+  virtual void DoRun (void);
+  virtual void DoTeardown (void);
+  void Event (void);
+  uint32_t m_count;
+};
+
+RealtimeLatenessTestCase::RealtimeLatenessTestCase ()
+  : TestCase ("Check the realtime simulator busy-poll mode and lateness statistics")
+{}
+
+void
+RealtimeLatenessTestCase::DoSetup (void)
+{
+  Config::SetGlobal ("SimulatorImplementationType",
+                     StringValue ("ns3::RealtimeSimulatorImpl"));
+  Config::SetDefault ("ns3::WallClockSynchronizer::BusyPoll", BooleanValue (true));
+  Config::SetDefault ("ns3::RealtimeSimulatorImpl::SynchronizationMode",
+                      EnumValue (RealtimeSimulatorImpl::SYNC_HARD_LIMIT));
+  Config::SetDefault ("ns3::RealtimeSimulatorImpl::HardLimitPolicy",
+                      EnumValue (RealtimeSimulatorImpl::HARD_LIMIT_COUNT));
+  Config::SetDefault ("ns3::RealtimeSimulatorImpl::HardLimit", TimeValue (NanoSeconds (1)));
+}
+
+void
+RealtimeLatenessTestCase::DoTeardown (void)
+{
+  Config::SetDefault ("ns3::WallClockSynchronizer::BusyPoll", BooleanValue (false));
+  Config::SetDefault ("ns3::RealtimeSimulatorImpl::SynchronizationMode",
+                      EnumValue (RealtimeSimulatorImpl::SYNC_BEST_EFFORT));
+  Config::SetDefault ("ns3::RealtimeSimulatorImpl::HardLimitPolicy",
+                      EnumValue (RealtimeSimulatorImpl::HARD_LIMIT_FATAL));
+  Config::SetDefault ("ns3::RealtimeSimulatorImpl::HardLimit", TimeValue (Seconds (0.1)));
+  Config::SetGlobal ("SimulatorImplementationType",
+                     StringValue ("ns3::DefaultSimulatorImpl"));
+}
+
+void
+RealtimeLatenessTestCase::Event (void)
+{
+  m_count++;
+}
+
+void
+RealtimeLatenessTestCase::DoRun (void)
+{
+  m_count = 0;
+  // A burst of events all due at once, then a few paced ones.
+  for (uint32_t i = 0; i < 1000; i++)
+    {
+      Simulator::Schedule (MicroSeconds (10), &RealtimeLatenessTestCase::Event, this);
+    }
+  for (uint32_t i = 1; i <= 10; i++)
+    {
+      Simulator::Schedule (MicroSeconds (100 * i), &RealtimeLatenessTestCase::Event, this);
+    }
+  // The realtime simulator does not stop on an empty event list.
+  Simulator::Stop (MilliSeconds (2));
+  Simulator::Run ();
+
+  Ptr<RealtimeSimulatorImpl> impl =
+    DynamicCast<RealtimeSimulatorImpl> (Simulator::GetImplementation ());
+  NS_TEST_ASSERT_MSG_NE (impl, 0, "Not running the realtime simulator");
+  RealtimeSimulatorImpl::LatenessStatistics stats = impl->GetLatenessStatistics ();
+  Simulator::Destroy ();
+
+  NS_TEST_EXPECT_MSG_EQ (m_count, 1010, "Not all events ran");
+  // The statistics also account for the Stop event.
+  NS_TEST_EXPECT_MSG_EQ (stats.events, 1011, "Wrong number of events in the statistics");
+  NS_TEST_EXPECT_MSG_LT_OR_EQ (stats.totalLateness, stats.maxLateness * 1011,
+                               "Total lateness larger than the maximum allows");
+  // The burst cannot all run within 1 ns of its due time, but must not abort.
+  NS_TEST_EXPECT_MSG_GT (stats.hardLimitViolations, 0, "Hard limit violations not counted");
+  NS_TEST_EXPECT_MSG_LT_OR_EQ (stats.hardLimitViolations, stats.events, "Too many violations");
+}
+
 class SimulatorTestSuite : public TestSuite
 {
 public:
@@ -483,5 +568,6 @@ public:
     AddTestCase (new SimulatorEventsTestCase (factory), TestCase::QUICK);
     factory.SetTypeId (PriorityQueueScheduler::GetTypeId ());
     AddTestCase (new SimulatorEventsTestCase (factory), TestCase::QUICK);
+    AddTestCase (new RealtimeLatenessTestCase (), TestCase::QUICK);
   }
 } g_simulatorTestSuite;
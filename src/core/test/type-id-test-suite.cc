@@ -334,6 +334,92 @@ DeprecatedAttributeTestCase::DoRun (void)
 }
 
 
+//----------------------------
+//
+// Inherited Attribute test
+
+class DerivedAttribute : public DeprecatedAttribute
+{
+private:
+  int m_derivedAttr;
+  TracedValue<double> m_derivedTrace;
+
+public:
+  DerivedAttribute ()
+    : m_derivedAttr (0)
+  {
+    NS_UNUSED (m_derivedAttr);
+  }
+  virtual ~DerivedAttribute ()
+  {}
+
+  // Register a type adding an Attribute and TraceSource to its parent's
+  static TypeId GetTypeId (void)
+  {
+    static TypeId tid = TypeId ("DerivedAttribute")
+      .SetParent<DeprecatedAttribute> ()
+      .AddAttribute ("derivedAttribute",
+                     "the derived Attribute",
+                     IntegerValue (2),
+                     MakeIntegerAccessor (&DerivedAttribute::m_derivedAttr),
+                     MakeIntegerChecker<int> ())
+      .AddTraceSource ("derivedTrace",
+                       "the derived TraceSource",
+                       MakeTraceSourceAccessor (&DerivedAttribute::m_derivedTrace),
+                       "ns3::TracedValueCallback::Double");
+    return tid;
+  }
+
+};
+
+
+class InheritedAttributeTestCase : public TestCase
+{
+public:
+  InheritedAttributeTestCase ();
+  virtual ~InheritedAttributeTestCase ();
+
+private:
+  virtual void DoRun (void);
+
+};
+
+InheritedAttributeTestCase::InheritedAttributeTestCase ()
+  : TestCase ("Check lookup of inherited Attributes and TraceSources")
+{}
+
+InheritedAttributeTestCase::~InheritedAttributeTestCase ()
+{}
+
+void
+InheritedAttributeTestCase::DoRun (void)
+{
+  TypeId tid = DerivedAttribute::GetTypeId ();
+
+  struct TypeId::AttributeInformation ainfo;
+  NS_TEST_ASSERT_MSG_EQ (tid.LookupAttributeByName ("derivedAttribute", &ainfo), true,
+                         "lookup own attribute");
+  NS_TEST_ASSERT_MSG_EQ (ainfo.name, "derivedAttribute", "wrong attribute found");
+  NS_TEST_ASSERT_MSG_EQ (tid.LookupAttributeByName ("attribute", &ainfo), true,
+                         "lookup inherited attribute");
+  NS_TEST_ASSERT_MSG_EQ (ainfo.name, "attribute", "wrong attribute found");
+  NS_TEST_ASSERT_MSG_EQ (tid.LookupAttributeByName ("missingAttribute", &ainfo), false,
+                         "lookup missing attribute");
+  NS_TEST_ASSERT_MSG_EQ (DeprecatedAttribute::GetTypeId ().LookupAttributeByName ("derivedAttribute", &ainfo),
+                         false, "lookup child attribute from parent");
+
+  struct TypeId::TraceSourceInformation tinfo;
+  NS_TEST_ASSERT_MSG_NE (tid.LookupTraceSourceByName ("derivedTrace", &tinfo), 0,
+                         "lookup own trace source");
+  NS_TEST_ASSERT_MSG_EQ (tinfo.name, "derivedTrace", "wrong trace source found");
+  NS_TEST_ASSERT_MSG_NE (tid.LookupTraceSourceByName ("trace", &tinfo), 0,
+                         "lookup inherited trace source");
+  NS_TEST_ASSERT_MSG_EQ (tinfo.name, "trace", "wrong trace source found");
+  NS_TEST_ASSERT_MSG_EQ (tid.LookupTraceSourceByName ("missingTrace"), 0,
+                         "lookup missing trace source");
+}
+
+
 //----------------------------
 //
 // Performance test
@@ -394,6 +480,19 @@ LookupTimeTestCase::DoRun (void)
   stop = clock ();
   Report ("hash", stop - start);
 
+  start = clock ();
+  for (uint32_t j = 0; j < REPETITIONS; ++j)
+    {
+      for (uint16_t i = 0; i < nids; ++i)
+        {
+          const TypeId tid = TypeId::GetRegistered (i);
+          struct TypeId::AttributeInformation info;
+          tid.LookupAttributeByName ("NoSuchAttribute", &info);
+        }
+    }
+  stop = clock ();
+  Report ("attribute name", stop - start);
+
 }
 
 void
@@ -447,6 +546,7 @@ TypeIdTestSuite::TypeIdTestSuite ()
   AddTestCase (new UniqueTypeIdTestCase, QUICK);
   AddTestCase (new CollisionTestCase, QUICK);
   AddTestCase (new DeprecatedAttributeTestCase, QUICK);
+  AddTestCase (new InheritedAttributeTestCase, QUICK);
 }
 
 static TypeIdTestSuite g_TypeIdTestSuite;
@@ -73,6 +73,24 @@ bool CompareRoutesExpire (const DsrRouteCacheEntry &a, const DsrRouteCacheEntry
   return a.GetExpireTime () > b.GetExpireTime ();
 }
 
+/**
+ * \brief Order of the nodes visited by DsrRouteCache::RebuildBestRouteTable:
+ * the node with the lowest shortest-path estimate, and then with the highest
+ * address, is on top of the queue.
+ */
+struct CompareDijkstraNodes
+{
+  /**
+   * \param a a node and its estimate
+   * \param b another node and its estimate
+   * \return true if b is to be visited before a
+   */
+  bool operator () (const std::pair<uint32_t, Ipv4Address> &a, const std::pair<uint32_t, Ipv4Address> &b) const
+  {
+    return a.first > b.first || (a.first == b.first && a.second < b.second);
+  }
+};
+
 void Link::Print () const
 {
   NS_LOG_DEBUG (m_low << "----" << m_high);
@@ -178,7 +196,7 @@ bool
 DsrRouteCache::UpdateRouteEntry (Ipv4Address dst)
 {
   NS_LOG_FUNCTION (this << dst);
-  std::map<Ipv4Address, std::list<DsrRouteCacheEntry> >::const_iterator i =
+  std::map<Ipv4Address, std::list<DsrRouteCacheEntry> >::iterator i =
     m_sortedRoutes.find (dst);
   if (i == m_sortedRoutes.end ())
     {
@@ -187,19 +205,14 @@ DsrRouteCache::UpdateRouteEntry (Ipv4Address dst)
     }
   else
     {
-      std::list<DsrRouteCacheEntry> rtVector = i->second;
+      std::list<DsrRouteCacheEntry> &rtVector = i->second;
       DsrRouteCacheEntry successEntry = rtVector.front ();
       successEntry.SetExpireTime (RouteCacheTimeout);
       rtVector.pop_front ();
       rtVector.push_back (successEntry);
-      rtVector.sort (CompareRoutesExpire);      // sort the route vector first
-      m_sortedRoutes.erase (dst);               // erase the entry first
-      /*
-       * Save the new route cache along with the destination address in map
-       */
-      std::pair<std::map<Ipv4Address, std::list<DsrRouteCacheEntry> >::iterator, bool> result =
-        m_sortedRoutes.insert (std::make_pair (dst, rtVector));
-      return result.second;
+      rtVector.sort (CompareRoutesExpire);      // sort the route vector
+      AddRouteExpiry (dst, successEntry);
+      return true;
     }
   return false;
 }
@@ -224,51 +237,44 @@ DsrRouteCache::LookupRoute (Ipv4Address id, DsrRouteCacheEntry & rt)
       if (i == m_sortedRoutes.end ())
         {
           NS_LOG_LOGIC ("No Direct Route to " << id << " found");
+          // The sub-route to add in the route cache, if any: the last one found is kept
+          const DsrRouteCacheEntry *subRoute = 0;
+          std::size_t subRouteSize = 0;
           for (std::map<Ipv4Address, std::list<DsrRouteCacheEntry> >::const_iterator j =
                  m_sortedRoutes.begin (); j != m_sortedRoutes.end (); ++j)
             {
-              std::list<DsrRouteCacheEntry> rtVector = j->second; // The route cache vector linked with destination address
               /*
                * Loop through the possibly multiple routes within the route vector
                */
-              for (std::list<DsrRouteCacheEntry>::const_iterator k = rtVector.begin (); k != rtVector.end (); ++k)
+              for (std::list<DsrRouteCacheEntry>::const_iterator k = j->second.begin (); k != j->second.end (); ++k)
                 {
-                  // return the first route in the route vector
-                  DsrRouteCacheEntry::IP_VECTOR routeVector = k->GetVector ();
-                  DsrRouteCacheEntry::IP_VECTOR changeVector;
-
-                  for (DsrRouteCacheEntry::IP_VECTOR::iterator l = routeVector.begin (); l != routeVector.end (); ++l)
-                    {
-                      if (*l != id)
-                        {
-                          changeVector.push_back (*l);
-                        }
-                      else
-                        {
-                          changeVector.push_back (*l);
-                          break;
-                        }
-                    }
+                  const DsrRouteCacheEntry::IP_VECTOR &routeVector = k->GetVector ();
+                  DsrRouteCacheEntry::IP_VECTOR::const_iterator l = std::find (routeVector.begin (), routeVector.end (), id);
                   /*
-                   * When the changed vector is smaller in size and larger than 1, which means we have found a route with the destination
-                   * address we are looking for
+                   * When the route goes through the destination address we are looking
+                   * for, and neither starts nor ends with it, we have found a sub-route
                    */
-                  if ((changeVector.size () < routeVector.size ())  && (changeVector.size () > 1))
+                  if (l != routeVector.end () && l != routeVector.begin () && l + 1 != routeVector.end ())
                     {
-                      DsrRouteCacheEntry changeEntry; // Create the route entry
-                      changeEntry.SetVector (changeVector);
-                      changeEntry.SetDestination (id);
-                      // Use the expire time from original route entry
-                      changeEntry.SetExpireTime (k->GetExpireTime ());
-                      // We need to add new route entry here
-                      std::list<DsrRouteCacheEntry> newVector;
-                      newVector.push_back (changeEntry);
-                      newVector.sort (CompareRoutesExpire);  // sort the route vector first
-                      m_sortedRoutes[id] = newVector;   // Only get the first sub route and add it in route cache
-                      NS_LOG_INFO ("We have a sub-route to " << id << " add it in route cache");
+                      subRoute = &(*k);
+                      subRouteSize = (l - routeVector.begin ()) + 1;
                     }
                 }
             }
+          if (subRoute != 0)
+            {
+              DsrRouteCacheEntry changeEntry; // Create the route entry
+              changeEntry.SetVector (DsrRouteCacheEntry::IP_VECTOR (subRoute->GetVector ().begin (),
+                                                                    subRoute->GetVector ().begin () + subRouteSize));
+              changeEntry.SetDestination (id);
+              // Use the expire time from original route entry
+              changeEntry.SetExpireTime (subRoute->GetExpireTime ());
+              std::list<DsrRouteCacheEntry> newVector;
+              newVector.push_back (changeEntry);
+              m_sortedRoutes[id] = newVector;   // Only get the first sub route and add it in route cache
+              AddRouteExpiry (id, changeEntry);
+              NS_LOG_INFO ("We have a sub-route to " << id << " add it in route cache");
+            }
         }
       NS_LOG_INFO ("Here we check the route cache again after updated the sub routes");
       std::map<Ipv4Address, std::list<DsrRouteCacheEntry> >::const_iterator m = m_sortedRoutes.find (id);
@@ -280,9 +286,8 @@ DsrRouteCache::LookupRoute (Ipv4Address id, DsrRouteCacheEntry & rt)
       /*
        * We have a direct route to the destination address
        */
-      std::list<DsrRouteCacheEntry> rtVector = m->second;
-      rt = rtVector.front ();  // use the first entry in the route vector
-      NS_LOG_LOGIC ("Route to " << id << " with route size " << rtVector.size ());
+      rt = m->second.front ();  // use the first entry in the route vector
+      NS_LOG_LOGIC ("Route to " << id << " with route size " << m->second.size ());
       return true;
     }
 }
@@ -340,63 +345,74 @@ DsrRouteCache::RebuildBestRouteTable (Ipv4Address source)
   d[source] = 0;
   /**
    * \brief The following is the core of Dijkstra algorithm
+   *
+   * The nodes are visited by increasing shortest-path estimate, and by
+   * decreasing address among the nodes with the same estimate. The nodes
+   * that cannot be reached are not visited, since they cannot improve the
+   * estimate of any other node.
    */
   // the node set which shortest distance has been calculated, if true calculated
   std::map<Ipv4Address, bool> s;
-  double temp = MAXWEIGHT;
-  Ipv4Address tempip = Ipv4Address ("255.255.255.255");
-  for (uint32_t i = 0; i < m_netGraph.size (); i++)
+  // the nodes to visit, with their estimate when they were queued
+  std::priority_queue<std::pair<uint32_t, Ipv4Address>,
+                      std::vector<std::pair<uint32_t, Ipv4Address> >,
+                      CompareDijkstraNodes> queue;
+  // only the source and its neighbors have a finite estimate so far
+  queue.push (std::make_pair (d[source], source));
+  for (std::map<Ipv4Address, Ipv4Address>::const_iterator i = pre.begin (); i != pre.end (); ++i)
     {
-      temp = MAXWEIGHT;
-      for (std::map<Ipv4Address,uint32_t>::const_iterator j = d.begin (); j != d.end (); ++j)
+      if (i->second == source && i->first != source)
         {
-          Ipv4Address ip = j->first;
-          if (s.find (ip) == s.end ())
-            {
-              /*
-               * \brief The followings are for comparison
-               */
-              if (j->second <= temp)
-                {
-                  temp = j->second;
-                  tempip = ip;
-                }
-            }
+          queue.push (std::make_pair (d[i->first], i->first));
+        }
+    }
+  while (!queue.empty ())
+    {
+      Ipv4Address tempip = queue.top ().second;
+      uint32_t tempd = queue.top ().first;
+      queue.pop ();
+      if (s.find (tempip) != s.end () || d[tempip] != tempd)
+        {
+          // already visited, or queued again with a lower estimate
+          continue;
         }
-      if (!tempip.IsBroadcast ())
+      s[tempip] = true;
+      std::map<Ipv4Address, std::map<Ipv4Address, uint32_t> >::const_iterator neighbors = m_netGraph.find (tempip);
+      if (neighbors == m_netGraph.end ())
         {
-          s[tempip] = true;
-          for (std::map<Ipv4Address, uint32_t>::const_iterator k = m_netGraph[tempip].begin (); k != m_netGraph[tempip].end (); ++k)
+          continue;
+        }
+      for (std::map<Ipv4Address, uint32_t>::const_iterator k = neighbors->second.begin (); k != neighbors->second.end (); ++k)
+        {
+          if (s.find (k->first) == s.end () && d[k->first] > d[tempip] + k->second)
             {
-              if (s.find (k->first) == s.end () && d[k->first] > d[tempip] + k->second)
-                {
-                  d[k->first] = d[tempip] + k->second;
-                  pre[k->first] = tempip;
-                }
-              /*
-               *  Selects the shortest-length route that has the longest expected lifetime
-               *  (highest minimum timeout of any link in the route)
-               *  For the computation overhead and complexity
-               *  Here I just implement kind of greedy strategy to select link with the longest expected lifetime when there is two options
-               */
-              else if (d[k->first] == d[tempip] + k->second)
+              d[k->first] = d[tempip] + k->second;
+              pre[k->first] = tempip;
+              queue.push (std::make_pair (d[k->first], k->first));
+            }
+          /*
+           *  Selects the shortest-length route that has the longest expected lifetime
+           *  (highest minimum timeout of any link in the route)
+           *  For the computation overhead and complexity
+           *  Here I just implement kind of greedy strategy to select link with the longest expected lifetime when there is two options
+           */
+          else if (d[k->first] == d[tempip] + k->second)
+            {
+              std::map<Link, DsrLinkStab>::iterator oldlink = m_linkCache.find (Link (k->first, pre[k->first]));
+              std::map<Link, DsrLinkStab>::iterator newlink = m_linkCache.find (Link (k->first, tempip));
+              if (oldlink != m_linkCache.end () && newlink != m_linkCache.end ())
                 {
-                  std::map<Link, DsrLinkStab>::iterator oldlink = m_linkCache.find (Link (k->first, pre[k->first]));
-                  std::map<Link, DsrLinkStab>::iterator newlink = m_linkCache.find (Link (k->first, tempip));
-                  if (oldlink != m_linkCache.end () && newlink != m_linkCache.end ())
-                    {
-                      if (oldlink->second.GetLinkStability () < newlink->second.GetLinkStability ())
-                        {
-                          NS_LOG_INFO ("Select the link with longest expected lifetime");
-                          d[k->first] = d[tempip] + k->second;
-                          pre[k->first] = tempip;
-                        }
-                    }
-                  else
+                  if (oldlink->second.GetLinkStability () < newlink->second.GetLinkStability ())
                     {
-                      NS_LOG_INFO ("Link Stability Info Corrupt");
+                      NS_LOG_INFO ("Select the link with longest expected lifetime");
+                      d[k->first] = d[tempip] + k->second;
+                      pre[k->first] = tempip;
                     }
                 }
+              else
+                {
+                  NS_LOG_INFO ("Link Stability Info Corrupt");
+                }
             }
         }
     }
@@ -465,33 +481,27 @@ void
 DsrRouteCache::PurgeLinkNode ()
 {
   NS_LOG_FUNCTION (this);
-  for (std::map<Link, DsrLinkStab>::iterator i = m_linkCache.begin (); i != m_linkCache.end (); )
+  Time now = Simulator::Now ();
+  while (!m_linkExpiries.empty () && m_linkExpiries.top ().first <= now)
     {
-      NS_LOG_DEBUG ("The link stability " << i->second.GetLinkStability ().As (Time::S));
-      std::map<Link, DsrLinkStab>::iterator itmp = i;
-      if (i->second.GetLinkStability () <= Seconds (0))
-        {
-          ++i;
-          m_linkCache.erase (itmp);
-        }
-      else
+      std::map<Link, DsrLinkStab>::iterator i = m_linkCache.find (m_linkExpiries.top ().second);
+      m_linkExpiries.pop ();
+      // the link may have been erased, or its stability extended, since
+      if (i != m_linkCache.end () && i->second.GetLinkStability () <= Seconds (0))
         {
-          ++i;
+          NS_LOG_DEBUG ("The link stability " << i->second.GetLinkStability ().As (Time::S));
+          m_linkCache.erase (i);
         }
     }
   /// may need to remove them after verify
-  for (std::map<Ipv4Address, DsrNodeStab>::iterator i = m_nodeCache.begin (); i != m_nodeCache.end (); )
+  while (!m_nodeExpiries.empty () && m_nodeExpiries.top ().first <= now)
     {
-      NS_LOG_DEBUG ("The node stability " << i->second.GetNodeStability ().As (Time::S));
-      std::map<Ipv4Address, DsrNodeStab>::iterator itmp = i;
-      if (i->second.GetNodeStability () <= Seconds (0))
-        {
-          ++i;
-          m_nodeCache.erase (itmp);
-        }
-      else
+      std::map<Ipv4Address, DsrNodeStab>::iterator i = m_nodeCache.find (m_nodeExpiries.top ().second);
+      m_nodeExpiries.pop ();
+      if (i != m_nodeCache.end () && i->second.GetNodeStability () <= Seconds (0))
         {
-          ++i;
+          NS_LOG_DEBUG ("The node stability " << i->second.GetNodeStability ().As (Time::S));
+          m_nodeCache.erase (i);
         }
     }
 }
@@ -520,7 +530,7 @@ DsrRouteCache::IncStability (Ipv4Address node)
     {
       NS_LOG_INFO ("The initial stability " << m_initStability.As (Time::S));
       DsrNodeStab ns (m_initStability);
-      m_nodeCache[node] = ns;
+      SetNodeStab (node, ns);
       return false;
     }
   else
@@ -529,7 +539,7 @@ DsrRouteCache::IncStability (Ipv4Address node)
       NS_LOG_INFO ("The node stability " << i->second.GetNodeStability ().As (Time::S));
       NS_LOG_INFO ("The stability here " << Time (i->second.GetNodeStability () * m_stabilityIncrFactor).As (Time::S));
       DsrNodeStab ns (Time (i->second.GetNodeStability () * m_stabilityIncrFactor));
-      m_nodeCache[node] = ns;
+      SetNodeStab (node, ns);
       return true;
     }
   return false;
@@ -543,7 +553,7 @@ DsrRouteCache::DecStability (Ipv4Address node)
   if (i == m_nodeCache.end ())
     {
       DsrNodeStab ns (m_initStability);
-      m_nodeCache[node] = ns;
+      SetNodeStab (node, ns);
       return false;
     }
   else
@@ -552,7 +562,7 @@ DsrRouteCache::DecStability (Ipv4Address node)
       NS_LOG_INFO ("The stability here " << i->second.GetNodeStability ().As (Time::S));
       NS_LOG_INFO ("The stability here " << Time (i->second.GetNodeStability () / m_stabilityDecrFactor).As (Time::S));
       DsrNodeStab ns (Time (i->second.GetNodeStability () / m_stabilityDecrFactor));
-      m_nodeCache[node] = ns;
+      SetNodeStab (node, ns);
       return true;
     }
   return false;
@@ -572,11 +582,11 @@ DsrRouteCache::AddRoute_Link (DsrRouteCacheEntry::IP_VECTOR nodelist, Ipv4Addres
 
       if (m_nodeCache.find (nodelist[i]) == m_nodeCache.end ())
         {
-          m_nodeCache[nodelist[i]] = ns;
+          SetNodeStab (nodelist[i], ns);
         }
       if (m_nodeCache.find (nodelist[i + 1]) == m_nodeCache.end ())
         {
-          m_nodeCache[nodelist[i + 1]] = ns;
+          SetNodeStab (nodelist[i + 1], ns);
         }
       Link link (nodelist[i], nodelist[i + 1]);         /// Link represent the one link for the route
       DsrLinkStab stab;                /// Link stability
@@ -596,7 +606,7 @@ DsrRouteCache::AddRoute_Link (DsrRouteCacheEntry::IP_VECTOR nodelist, Ipv4Addres
           /// Set the link stability as the m)minLifeTime, default is 1 second
           stab.SetLinkStability (m_minLifeTime);
         }
-      m_linkCache[link] = stab;
+      SetLinkStab (link, stab);
       NS_LOG_DEBUG ("Add a new link");
       link.Print ();
       NS_LOG_DEBUG ("Link Info");
@@ -621,13 +631,15 @@ DsrRouteCache::UseExtends (DsrRouteCacheEntry::IP_VECTOR rt)
   for (DsrRouteCacheEntry::IP_VECTOR::iterator i = rt.begin (); i != rt.end () - 1; ++i)
     {
       Link link (*i, *(i + 1));
-      if (m_linkCache.find (link) != m_linkCache.end ())
+      std::map<Link, DsrLinkStab>::iterator linkStab = m_linkCache.find (link);
+      if (linkStab != m_linkCache.end ())
         {
-          if (m_linkCache[link].GetLinkStability () < m_useExtends)
+          if (linkStab->second.GetLinkStability () < m_useExtends)
             {
-              m_linkCache[link].SetLinkStability (m_useExtends);
+              linkStab->second.SetLinkStability (m_useExtends);
+              m_linkExpiries.push (std::make_pair (Simulator::Now () + m_useExtends, link));
               /// \todo remove after debug
-              NS_LOG_INFO ("The time of the link " << m_linkCache[link].GetLinkStability ().As (Time::S));
+              NS_LOG_INFO ("The time of the link " << linkStab->second.GetLinkStability ().As (Time::S));
             }
         }
       else
@@ -669,12 +681,12 @@ DsrRouteCache::AddRoute (DsrRouteCacheEntry & rt)
   if (i == m_sortedRoutes.end ())
     {
       rtVector.push_back (rt);
-      m_sortedRoutes.erase (dst);   // Erase the route entries for dst first
       /**
        * Save the new route cache along with the destination address in map
        */
       std::pair<std::map<Ipv4Address, std::list<DsrRouteCacheEntry> >::iterator, bool> result =
         m_sortedRoutes.insert (std::make_pair (dst, rtVector));
+      AddRouteExpiry (dst, rt);
       return result.second;
     }
   else
@@ -713,6 +725,7 @@ DsrRouteCache::AddRoute (DsrRouteCacheEntry & rt)
                */
               std::pair<std::map<Ipv4Address, std::list<DsrRouteCacheEntry> >::iterator, bool> result =
                 m_sortedRoutes.insert (std::make_pair (dst, rtVector));
+              AddRouteExpiry (dst, rt);
               return result.second;
             }
           else
@@ -729,11 +742,7 @@ bool DsrRouteCache::FindSameRoute (DsrRouteCacheEntry & rt, std::list<DsrRouteCa
   NS_LOG_FUNCTION (this);
   for (std::list<DsrRouteCacheEntry>::iterator i = rtVector.begin (); i != rtVector.end (); ++i)
     {
-      // return the first route in the route vector
-      DsrRouteCacheEntry::IP_VECTOR routeVector = i->GetVector ();
-      DsrRouteCacheEntry::IP_VECTOR newVector = rt.GetVector ();
-
-      if (routeVector == newVector)
+      if (i->GetVector () == rt.GetVector ())
         {
           NS_LOG_DEBUG ("Found same routes in the route cache with the vector size "
                         << rt.GetDestination () << " " << rtVector.size ());
@@ -742,6 +751,7 @@ bool DsrRouteCache::FindSameRoute (DsrRouteCacheEntry & rt, std::list<DsrRouteCa
           if (rt.GetExpireTime () > i->GetExpireTime ())
             {
               i->SetExpireTime (rt.GetExpireTime ());
+              AddRouteExpiry (rt.GetDestination (), *i);
             }
           m_sortedRoutes.erase (rt.GetDestination ()); // erase the entry first
           rtVector.sort (CompareRoutesExpire);  // sort the route vector first
@@ -830,21 +840,19 @@ DsrRouteCache::DeleteAllRoutesIncludeLink (Ipv4Address errorSrc, Ipv4Address unr
       for (std::map<Ipv4Address, std::list<DsrRouteCacheEntry> >::iterator j =
              m_sortedRoutes.begin (); j != m_sortedRoutes.end (); )
         {
-          std::map<Ipv4Address, std::list<DsrRouteCacheEntry> >::iterator jtmp = j;
-          Ipv4Address address = j->first;
-          std::list<DsrRouteCacheEntry> rtVector = j->second;
+          std::list<DsrRouteCacheEntry> & rtVector = j->second;
           /*
            * Loop all the routes for a single destination
            */
           for (std::list<DsrRouteCacheEntry>::iterator k = rtVector.begin (); k != rtVector.end (); )
             {
               // return the first route in the route vector
-              DsrRouteCacheEntry::IP_VECTOR routeVector = k->GetVector ();
+              const DsrRouteCacheEntry::IP_VECTOR & routeVector = k->GetVector ();
               DsrRouteCacheEntry::IP_VECTOR changeVector;
               /*
                * Loop the ip addresses within a single route entry
                */
-              for (DsrRouteCacheEntry::IP_VECTOR::iterator i = routeVector.begin (); i != routeVector.end (); ++i)
+              for (DsrRouteCacheEntry::IP_VECTOR::const_iterator i = routeVector.begin (); i != routeVector.end (); ++i)
                 {
                   if (*i != errorSrc)
                     {
@@ -852,7 +860,7 @@ DsrRouteCache::DeleteAllRoutesIncludeLink (Ipv4Address errorSrc, Ipv4Address unr
                     }
                   else
                     {
-                      if (*(i + 1) == unreachNode)
+                      if (i + 1 != routeVector.end () && *(i + 1) == unreachNode)
                         {
                           changeVector.push_back (*i);
                           break;
@@ -907,22 +915,15 @@ DsrRouteCache::DeleteAllRoutesIncludeLink (Ipv4Address errorSrc, Ipv4Address unr
                   k = rtVector.erase (k);
                 }
             }
-          ++j;
-          if (!IsLinkCache ())
-            {
-              m_sortedRoutes.erase (jtmp);
-            }
           if (rtVector.size ())
             {
-              /*
-               * Save the new route cache along with the destination address in map
-               */
               rtVector.sort (CompareRoutesExpire);
-              m_sortedRoutes[address] = rtVector;
+              ++j;
             }
           else
             {
-              NS_LOG_DEBUG ("There is no route left for that destination " << address);
+              NS_LOG_DEBUG ("There is no route left for that destination " << j->first);
+              m_sortedRoutes.erase (j++);
             }
         }
     }
@@ -971,63 +972,69 @@ DsrRouteCache::Purge ()
       NS_LOG_DEBUG ("The route cache is empty");
       return;
     }
-  for (std::map<Ipv4Address, std::list<DsrRouteCacheEntry> >::iterator i =
-         m_sortedRoutes.begin (); i != m_sortedRoutes.end (); )
+  /*
+   * Only visit the destinations with a route whose expire time has passed
+   */
+  Time now = Simulator::Now ();
+  while (!m_routeExpiries.empty () && m_routeExpiries.top ().first <= now)
     {
-      // Loop of route cache entry with the route size
-      std::map<Ipv4Address, std::list<DsrRouteCacheEntry> >::iterator itmp = i;
-      /*
-       * The route cache entry vector
-       */
-      Ipv4Address dst = i->first;
-      std::list<DsrRouteCacheEntry> rtVector = i->second;
+      Ipv4Address dst = m_routeExpiries.top ().second;
+      m_routeExpiries.pop ();
+      std::map<Ipv4Address, std::list<DsrRouteCacheEntry> >::iterator i = m_sortedRoutes.find (dst);
+      if (i == m_sortedRoutes.end ())
+        {
+          continue;
+        }
+      std::list<DsrRouteCacheEntry> & rtVector = i->second;
       NS_LOG_DEBUG ("The route vector size of 1 " << dst << " " << rtVector.size ());
-      if (rtVector.size ())
+      for (std::list<DsrRouteCacheEntry>::iterator j = rtVector.begin (); j != rtVector.end (); )
         {
-          for (std::list<DsrRouteCacheEntry>::iterator j = rtVector.begin (); j != rtVector.end (); )
-            {
-              NS_LOG_DEBUG ("The expire time of every entry with expire time " << j->GetExpireTime ());
-              /*
-               * First verify if the route has expired or not
-               */
-              if (j->GetExpireTime () <= Seconds (0))
-                {
-                  /*
-                   * When the expire time has passed, erase the certain route
-                   */
-                  NS_LOG_DEBUG ("Erase the expired route for " << dst << " with expire time " << j->GetExpireTime ());
-                  j = rtVector.erase (j);
-                }
-              else
-                {
-                  ++j;
-                }
-            }
-          NS_LOG_DEBUG ("The route vector size of 2 " << dst << " " << rtVector.size ());
-          if (rtVector.size ())
+          NS_LOG_DEBUG ("The expire time of every entry with expire time " << j->GetExpireTime ());
+          /*
+           * First verify if the route has expired or not
+           */
+          if (j->GetExpireTime () <= Seconds (0))
             {
-              ++i;
-              m_sortedRoutes.erase (itmp); // erase the entry first
               /*
-               * Save the new route cache along with the destination address in map
+               * When the expire time has passed, erase the certain route
                */
-              m_sortedRoutes.insert (std::make_pair (dst, rtVector));
+              NS_LOG_DEBUG ("Erase the expired route for " << dst << " with expire time " << j->GetExpireTime ());
+              j = rtVector.erase (j);
             }
           else
             {
-              ++i;
-              m_sortedRoutes.erase (itmp);
+              ++j;
             }
         }
-      else
+      NS_LOG_DEBUG ("The route vector size of 2 " << dst << " " << rtVector.size ());
+      if (rtVector.empty ())
         {
-          ++i;
-          m_sortedRoutes.erase (itmp);
+          m_sortedRoutes.erase (i);
         }
     }
   return;
 }
 
+void
+DsrRouteCache::AddRouteExpiry (Ipv4Address dst, const DsrRouteCacheEntry & rt)
+{
+  m_routeExpiries.push (std::make_pair (Simulator::Now () + rt.GetExpireTime (), dst));
+}
+
+void
+DsrRouteCache::SetNodeStab (Ipv4Address node, const DsrNodeStab & stab)
+{
+  m_nodeCache[node] = stab;
+  m_nodeExpiries.push (std::make_pair (Simulator::Now () + stab.GetNodeStability (), node));
+}
+
+void
+DsrRouteCache::SetLinkStab (const Link & link, const DsrLinkStab & stab)
+{
+  m_linkCache[link] = stab;
+  m_linkExpiries.push (std::make_pair (Simulator::Now () + stab.GetLinkStability (), link));
+}
+
 void
 DsrRouteCache::Print (std::ostream &os)
 {
@@ -34,6 +34,9 @@
 #define DSR_RCACHE_H
 
 #include <map>
+#include <queue>
+#include <functional>
+#include <utility>
 #include <stdint.h>
 #include <cassert>
 #include <sys/types.h>
@@ -290,7 +293,7 @@ public:
    * Get the IP vector
    * \returns the IP vector
    */
-  IP_VECTOR GetVector () const
+  const IP_VECTOR & GetVector () const
   {
     return m_path;
   }
@@ -782,6 +785,44 @@ private:
   std::map<Ipv4Address, DsrRouteCacheEntry::IP_VECTOR> m_bestRoutesTable_link;     ///< for link route cache
   std::map<Link, DsrLinkStab> m_linkCache;                                         ///< The data structure to store link info
   std::map<Ipv4Address, DsrNodeStab> m_nodeCache;                                  ///< The data structure to store node info
+
+  /// An expiration time and the address it applies to
+  typedef std::pair<Time, Ipv4Address> AddressExpiry;
+  /// Queue of expiration times of addresses, the earliest on top
+  typedef std::priority_queue<AddressExpiry, std::vector<AddressExpiry>, std::greater<AddressExpiry> > AddressExpiryQueue;
+  /// An expiration time and the link it applies to
+  typedef std::pair<Time, Link> LinkExpiry;
+  /// Queue of expiration times of links, the earliest on top
+  typedef std::priority_queue<LinkExpiry, std::vector<LinkExpiry>, std::greater<LinkExpiry> > LinkExpiryQueue;
+  /*
+   * The expiration times of the entries of m_sortedRoutes (by destination),
+   * m_nodeCache and m_linkCache, pushed whenever they are set, so that Purge
+   * and PurgeLinkNode only look at the entries that may have expired. The
+   * times of the entries that were updated or erased since are left in the
+   * queues, and ignored when popped.
+   */
+  AddressExpiryQueue m_routeExpiries; ///< expiration times of the routes in m_sortedRoutes
+  AddressExpiryQueue m_nodeExpiries;  ///< expiration times of the nodes in m_nodeCache
+  LinkExpiryQueue m_linkExpiries;     ///< expiration times of the links in m_linkCache
+
+  /**
+   * \brief Record the expiration time of a route entry stored in m_sortedRoutes
+   * \param dst the destination the entry is stored for
+   * \param rt the route entry
+   */
+  void AddRouteExpiry (Ipv4Address dst, const DsrRouteCacheEntry & rt);
+  /**
+   * \brief Store the stability of a node in m_nodeCache
+   * \param node the node
+   * \param stab the stability of the node
+   */
+  void SetNodeStab (Ipv4Address node, const DsrNodeStab & stab);
+  /**
+   * \brief Store the stability of a link in m_linkCache
+   * \param link the link
+   * \param stab the stability of the link
+   */
+  void SetLinkStab (const Link & link, const DsrLinkStab & stab);
   /**
    * \brief used by LookupRoute when LinkCache
    * \param id the ip address we are looking for
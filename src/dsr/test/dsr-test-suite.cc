@@ -438,6 +438,106 @@ DsrCacheEntryTest::DoRun ()
   NS_TEST_EXPECT_MSG_EQ (rcache->DeleteRoute (Ipv4Address ("1.1.1.1")), false, "trivial");
 }
 // -----------------------------------------------------------------------------
+/**
+ * \ingroup dsr-test
+ * \ingroup tests
+ *
+ * \class DsrRouteCacheExpiryTest
+ * \brief Unit test for the expiration of routes, links and nodes in the DSR route cache
+ */
+class DsrRouteCacheExpiryTest : public TestCase
+{
+public:
+  DsrRouteCacheExpiryTest ();
+  ~DsrRouteCacheExpiryTest ();
+  virtual void
+  DoRun (void);
+  /// Check the path cache after the first route has expired
+  void CheckPathCacheExpiry ();
+  /// Check the path cache after the second route has been refreshed
+  void CheckPathCacheRefresh ();
+  /// Check the link cache after the first links have expired
+  void CheckLinkCacheExpiry ();
+
+  Ptr<dsr::DsrRouteCache> m_pathCache; ///< path cache
+  Ptr<dsr::DsrRouteCache> m_linkCache; ///< link cache
+};
+DsrRouteCacheExpiryTest::DsrRouteCacheExpiryTest ()
+  : TestCase ("DSR route cache expiry")
+{
+}
+DsrRouteCacheExpiryTest::~DsrRouteCacheExpiryTest ()
+{
+}
+void
+DsrRouteCacheExpiryTest::DoRun ()
+{
+  m_pathCache = CreateObject<dsr::DsrRouteCache> ();
+  m_pathCache->SetCacheType ("PathCache");
+  m_pathCache->SetCacheTimeout (Seconds (20));
+  std::vector<Ipv4Address> ip1;
+  ip1.push_back (Ipv4Address ("10.0.0.1"));
+  ip1.push_back (Ipv4Address ("10.0.0.2"));
+  dsr::DsrRouteCacheEntry entry1 (ip1, Ipv4Address ("10.0.0.2"), Seconds (1));
+  NS_TEST_EXPECT_MSG_EQ (m_pathCache->AddRoute (entry1), true, "trivial");
+  std::vector<Ipv4Address> ip2;
+  ip2.push_back (Ipv4Address ("10.0.0.1"));
+  ip2.push_back (Ipv4Address ("10.0.0.3"));
+  dsr::DsrRouteCacheEntry entry2 (ip2, Ipv4Address ("10.0.0.3"), Seconds (10));
+  NS_TEST_EXPECT_MSG_EQ (m_pathCache->AddRoute (entry2), true, "trivial");
+
+  m_linkCache = CreateObject<dsr::DsrRouteCache> ();
+  m_linkCache->SetCacheType ("LinkCache");
+  m_linkCache->SetCacheTimeout (Seconds (20));
+  m_linkCache->SetInitStability (Seconds (5));
+  m_linkCache->SetMinLifeTime (Seconds (1));
+  std::vector<Ipv4Address> nodes;
+  nodes.push_back (Ipv4Address ("10.0.0.1"));
+  nodes.push_back (Ipv4Address ("10.0.0.2"));
+  nodes.push_back (Ipv4Address ("10.0.0.3"));
+  NS_TEST_EXPECT_MSG_EQ (m_linkCache->AddRoute_Link (nodes, Ipv4Address ("10.0.0.1")), true, "trivial");
+  dsr::DsrRouteCacheEntry rt;
+  NS_TEST_EXPECT_MSG_EQ (m_linkCache->LookupRoute (Ipv4Address ("10.0.0.3"), rt), true, "Route through the link cache");
+  NS_TEST_EXPECT_MSG_EQ (rt.GetVector ().size (), 3, "Route through the link cache");
+
+  Simulator::Schedule (Seconds (2), &DsrRouteCacheExpiryTest::CheckPathCacheExpiry, this);
+  Simulator::Schedule (Seconds (12), &DsrRouteCacheExpiryTest::CheckPathCacheRefresh, this);
+  Simulator::Schedule (Seconds (6), &DsrRouteCacheExpiryTest::CheckLinkCacheExpiry, this);
+
+  Simulator::Run ();
+  Simulator::Destroy ();
+  m_pathCache = 0;
+  m_linkCache = 0;
+}
+void
+DsrRouteCacheExpiryTest::CheckPathCacheExpiry ()
+{
+  dsr::DsrRouteCacheEntry rt;
+  NS_TEST_EXPECT_MSG_EQ (m_pathCache->LookupRoute (Ipv4Address ("10.0.0.2"), rt), false, "Route must have expired");
+  NS_TEST_EXPECT_MSG_EQ (m_pathCache->LookupRoute (Ipv4Address ("10.0.0.3"), rt), true, "Route must not have expired");
+  // refresh the route, it now expires after the cache timeout
+  NS_TEST_EXPECT_MSG_EQ (m_pathCache->UpdateRouteEntry (Ipv4Address ("10.0.0.3")), true, "trivial");
+}
+void
+DsrRouteCacheExpiryTest::CheckPathCacheRefresh ()
+{
+  dsr::DsrRouteCacheEntry rt;
+  NS_TEST_EXPECT_MSG_EQ (m_pathCache->LookupRoute (Ipv4Address ("10.0.0.3"), rt), true, "Refreshed route must not have expired");
+  NS_TEST_EXPECT_MSG_EQ (rt.GetExpireTime (), Seconds (10), "Unexpected expire time of the refreshed route");
+}
+void
+DsrRouteCacheExpiryTest::CheckLinkCacheExpiry ()
+{
+  // adding a new link purges the expired links and nodes and rebuilds the routes
+  std::vector<Ipv4Address> nodes;
+  nodes.push_back (Ipv4Address ("10.0.0.1"));
+  nodes.push_back (Ipv4Address ("10.0.0.4"));
+  NS_TEST_EXPECT_MSG_EQ (m_linkCache->AddRoute_Link (nodes, Ipv4Address ("10.0.0.1")), true, "trivial");
+  dsr::DsrRouteCacheEntry rt;
+  NS_TEST_EXPECT_MSG_EQ (m_linkCache->LookupRoute (Ipv4Address ("10.0.0.3"), rt), false, "Links must have expired");
+  NS_TEST_EXPECT_MSG_EQ (m_linkCache->LookupRoute (Ipv4Address ("10.0.0.4"), rt), true, "Link must not have expired");
+}
+// -----------------------------------------------------------------------------
 /**
  * \ingroup dsr-test
  * \ingroup tests
@@ -591,6 +691,7 @@ public:
     AddTestCase (new DsrAckReqHeaderTest, TestCase::QUICK);
     AddTestCase (new DsrAckHeaderTest, TestCase::QUICK);
     AddTestCase (new DsrCacheEntryTest, TestCase::QUICK);
+    AddTestCase (new DsrRouteCacheExpiryTest, TestCase::QUICK);
     AddTestCase (new DsrSendBuffTest, TestCase::QUICK);
   }
 } g_dsrTestSuite;
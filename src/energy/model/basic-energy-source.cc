@@ -22,9 +22,13 @@
 #include "ns3/log.h"
 #include "ns3/assert.h"
 #include "ns3/double.h"
+#include "ns3/boolean.h"
 #include "ns3/trace-source-accessor.h"
 #include "ns3/simulator.h"
 
+#include <algorithm>
+#include <cmath>
+
 namespace ns3 {
 
 NS_LOG_COMPONENT_DEFINE ("BasicEnergySource");
@@ -66,6 +70,16 @@ BasicEnergySource::GetTypeId (void)
                    MakeTimeAccessor (&BasicEnergySource::SetEnergyUpdateInterval,
                                      &BasicEnergySource::GetEnergyUpdateInterval),
                    MakeTimeChecker ())
+    .AddAttribute ("LazyEnergyUpdate",
+                   "Whether to update the remaining energy only when it is accessed "
+                   "(by a device energy model, an energy harvester or the user) "
+                   "and at the time when a battery threshold is crossed, instead of "
+                   "every PeriodicEnergyUpdateInterval. The RemainingEnergy trace "
+                   "is then only updated at those times.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&BasicEnergySource::SetLazyEnergyUpdate,
+                                        &BasicEnergySource::GetLazyEnergyUpdate),
+                   MakeBooleanChecker ())
     .AddTraceSource ("RemainingEnergy",
                      "Remaining energy at BasicEnergySource.",
                      MakeTraceSourceAccessor (&BasicEnergySource::m_remainingEnergyJ),
@@ -79,6 +93,7 @@ BasicEnergySource::BasicEnergySource ()
   NS_LOG_FUNCTION (this);
   m_lastUpdateTime = Seconds (0.0);
   m_depleted = false;
+  m_lazyUpdate = false;
 }
 
 BasicEnergySource::~BasicEnergySource ()
@@ -116,6 +131,20 @@ BasicEnergySource::GetEnergyUpdateInterval (void) const
   return m_energyUpdateInterval;
 }
 
+void
+BasicEnergySource::SetLazyEnergyUpdate (bool lazyUpdate)
+{
+  NS_LOG_FUNCTION (this << lazyUpdate);
+  m_lazyUpdate = lazyUpdate;
+}
+
+bool
+BasicEnergySource::GetLazyEnergyUpdate (void) const
+{
+  NS_LOG_FUNCTION (this);
+  return m_lazyUpdate;
+}
+
 double
 BasicEnergySource::GetSupplyVoltage (void) const
 {
@@ -174,7 +203,20 @@ BasicEnergySource::UpdateEnergySource (void)
       NotifyEnergyChanged ();
     }
 
-  if (m_energyUpdateEvent.IsExpired ())
+  if (m_lazyUpdate)
+    {
+      /*
+       * The device energy models notify the source before changing their
+       * current, hence the threshold crossing is computed once all the
+       * events of the current time have been executed.
+       */
+      if (!m_thresholdCrossingEvent.IsRunning ())
+        {
+          m_thresholdCrossingEvent = Simulator::ScheduleNow (&BasicEnergySource::ScheduleThresholdCrossing,
+                                                             this);
+        }
+    }
+  else if (m_energyUpdateEvent.IsExpired ())
     {
       m_energyUpdateEvent = Simulator::Schedule (m_energyUpdateInterval,
                                                  &BasicEnergySource::UpdateEnergySource,
@@ -197,6 +239,8 @@ void
 BasicEnergySource::DoDispose (void)
 {
   NS_LOG_FUNCTION (this);
+  m_energyUpdateEvent.Cancel ();
+  m_thresholdCrossingEvent.Cancel ();
   BreakDeviceEnergyModelRefCycle ();  // break reference cycle
 }
 
@@ -230,4 +274,44 @@ BasicEnergySource::CalculateRemainingEnergy (void)
   NS_LOG_DEBUG ("BasicEnergySource:Remaining energy = " << m_remainingEnergyJ);
 }
 
+void
+BasicEnergySource::ScheduleThresholdCrossing (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_energyUpdateEvent.Cancel ();
+  // energy drained per second, negative when the source is being recharged
+  double powerW = CalculateTotalCurrent () * m_supplyVoltageV;
+  double energyToThresholdJ;
+  if (!m_depleted && powerW > 0)
+    {
+      energyToThresholdJ = m_remainingEnergyJ - m_lowBatteryTh * m_initialEnergyJ;
+    }
+  else if (m_depleted && powerW < 0)
+    {
+      energyToThresholdJ = m_highBatteryTh * m_initialEnergyJ - m_remainingEnergyJ;
+    }
+  else
+    {
+      NS_LOG_DEBUG ("BasicEnergySource:No threshold crossing at the current rate");
+      return;
+    }
+  /*
+   * The energy to decrease is computed with the resolution of Time (see
+   * CalculateRemainingEnergy), hence the update is delayed by the time needed
+   * to drain (or recharge) two more steps of energy, so that the threshold
+   * has been crossed when the event expires.
+   */
+  energyToThresholdJ = std::max (energyToThresholdJ, 0.0)
+    + 2 * TimeStep (1).GetSeconds () * std::abs (powerW);
+  double delayS = energyToThresholdJ / std::abs (powerW);
+  if (delayS >= (Simulator::GetMaximumSimulationTime () - Simulator::Now ()).GetSeconds () / 2)
+    {
+      NS_LOG_DEBUG ("BasicEnergySource:No threshold crossing in the simulation time");
+      return;
+    }
+  Time delay = Seconds (delayS) + TimeStep (1);
+  NS_LOG_DEBUG ("BasicEnergySource:Threshold crossed in " << delay.As (Time::S));
+  m_energyUpdateEvent = Simulator::Schedule (delay, &BasicEnergySource::UpdateEnergySource, this);
+}
+
 } // namespace ns3
@@ -33,6 +33,12 @@ namespace ns3 {
  * BasicEnergySource decreases/increases remaining energy stored in itself in
  * linearly.
  *
+ * By default, the remaining energy is updated every
+ * PeriodicEnergyUpdateInterval. When the LazyEnergyUpdate attribute is true,
+ * the remaining energy is only updated when a device energy model, an energy
+ * harvester or a user accesses the source, and a single event is scheduled
+ * at the time when the remaining energy, drained or recharged at the current
+ * rate, crosses the low or high battery threshold.
  */
 class BasicEnergySource : public EnergySource
 {
@@ -102,6 +108,19 @@ public:
    */
   Time GetEnergyUpdateInterval (void) const;
 
+  /**
+   * \param lazyUpdate whether to update the remaining energy only when needed
+   *
+   * When true, the remaining energy is not updated periodically; the only
+   * scheduled event is the crossing of the low or high battery threshold.
+   */
+  void SetLazyEnergyUpdate (bool lazyUpdate);
+
+  /**
+   * \returns whether the remaining energy is only updated when needed
+   */
+  bool GetLazyEnergyUpdate (void) const;
+
 
 private:
   /// Defined in ns3::Object
@@ -135,6 +154,14 @@ private:
    */
   void CalculateRemainingEnergy (void);
 
+  /**
+   * Schedules the update of the energy source at the time when the low
+   * (or high, once depleted) battery threshold is crossed, given the current
+   * drawn from the source at the current time. This is used in lazy update
+   * mode, after the devices had the opportunity to change their current.
+   */
+  void ScheduleThresholdCrossing (void);
+
 private:
   double m_initialEnergyJ;                // initial energy, in Joules
   double m_supplyVoltageV;                // supply voltage, in Volts
@@ -144,6 +171,8 @@ private:
                                           // set to false again when the remaining energy exceeds the high threshold
   TracedValue<double> m_remainingEnergyJ; // remaining energy, in Joules
   EventId m_energyUpdateEvent;            // energy update event
+  EventId m_thresholdCrossingEvent;       // event computing the next threshold crossing, in lazy update mode
+  bool m_lazyUpdate;                      // whether the remaining energy is only updated when needed
   Time m_lastUpdateTime;                  // last update time
   Time m_energyUpdateInterval;            // energy update interval
 
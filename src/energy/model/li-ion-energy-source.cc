@@ -22,9 +22,11 @@
 #include "ns3/log.h"
 #include "ns3/assert.h"
 #include "ns3/double.h"
+#include "ns3/boolean.h"
 #include "ns3/trace-source-accessor.h"
 #include "ns3/simulator.h"
 
+#include <algorithm>
 #include <cmath>
 
 namespace ns3 {
@@ -103,6 +105,16 @@ LiIonEnergySource::GetTypeId (void)
                    MakeTimeAccessor (&LiIonEnergySource::SetEnergyUpdateInterval,
                                      &LiIonEnergySource::GetEnergyUpdateInterval),
                    MakeTimeChecker ())
+    .AddAttribute ("LazyEnergyUpdate",
+                   "Whether to update the remaining energy only when it is accessed "
+                   "(by a device energy model, an energy harvester or the user) "
+                   "and at the time when the low battery threshold is crossed, instead "
+                   "of every PeriodicEnergyUpdateInterval. The RemainingEnergy trace "
+                   "is then only updated at those times.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&LiIonEnergySource::SetLazyEnergyUpdate,
+                                        &LiIonEnergySource::GetLazyEnergyUpdate),
+                   MakeBooleanChecker ())
     .AddTraceSource ("RemainingEnergy",
                      "Remaining energy at BasicEnergySource.",
                      MakeTraceSourceAccessor (&LiIonEnergySource::m_remainingEnergyJ),
@@ -113,7 +125,9 @@ LiIonEnergySource::GetTypeId (void)
 
 LiIonEnergySource::LiIonEnergySource ()
   : m_drainedCapacity (0.0),
-    m_lastUpdateTime (Seconds (0.0))
+    m_lazyUpdate (false),
+    m_lastUpdateTime (Seconds (0.0)),
+    m_computingVoltage (false)
 {
   NS_LOG_FUNCTION (this);
 }
@@ -152,6 +166,18 @@ double
 LiIonEnergySource::GetSupplyVoltage (void) const
 {
   NS_LOG_FUNCTION (this);
+  if (m_lazyUpdate && !m_computingVoltage && Simulator::Now () > m_lastUpdateTime)
+    {
+      // the energy source is not updated by this getter, which only computes
+      // the voltage an update would yield. The total current includes the
+      // current from the harvesters, which is computed at the supply voltage
+      // of the last update, as in CalculateRemainingEnergy
+      m_computingVoltage = true;
+      double totalCurrentA = const_cast<LiIonEnergySource *> (this)->CalculateTotalCurrent ();
+      m_computingVoltage = false;
+      Time duration = Simulator::Now () - m_lastUpdateTime;
+      return GetVoltage (totalCurrentA, m_drainedCapacity + (totalCurrentA * duration).GetHours ());
+    }
   return m_supplyVoltageV;
 }
 
@@ -169,6 +195,20 @@ LiIonEnergySource::GetEnergyUpdateInterval (void) const
   return m_energyUpdateInterval;
 }
 
+void
+LiIonEnergySource::SetLazyEnergyUpdate (bool lazyUpdate)
+{
+  NS_LOG_FUNCTION (this << lazyUpdate);
+  m_lazyUpdate = lazyUpdate;
+}
+
+bool
+LiIonEnergySource::GetLazyEnergyUpdate (void) const
+{
+  NS_LOG_FUNCTION (this);
+  return m_lazyUpdate;
+}
+
 double
 LiIonEnergySource::GetRemainingEnergy (void)
 {
@@ -219,6 +259,12 @@ LiIonEnergySource::UpdateEnergySource (void)
   // do not update if simulation has finished
   if (Simulator::IsFinished ())
     {
+      if (m_lazyUpdate && Simulator::Now () > m_lastUpdateTime)
+        {
+          // bring the source up to date with the end of the simulation
+          CalculateRemainingEnergy ();
+          m_lastUpdateTime = Simulator::Now ();
+        }
       return;
     }
 
@@ -234,6 +280,21 @@ LiIonEnergySource::UpdateEnergySource (void)
       return; // stop periodic update
     }
 
+  if (m_lazyUpdate)
+    {
+      /*
+       * The device energy models notify the source before changing their
+       * current, hence the threshold crossing is computed once all the
+       * events of the current time have been executed.
+       */
+      if (!m_thresholdCrossingEvent.IsRunning ())
+        {
+          m_thresholdCrossingEvent = Simulator::ScheduleNow (&LiIonEnergySource::ScheduleThresholdCrossing,
+                                                             this);
+        }
+      return;
+    }
+
   m_energyUpdateEvent = Simulator::Schedule (m_energyUpdateInterval,
                                              &LiIonEnergySource::UpdateEnergySource,
                                              this);
@@ -253,6 +314,8 @@ void
 LiIonEnergySource::DoDispose (void)
 {
   NS_LOG_FUNCTION (this);
+  m_energyUpdateEvent.Cancel ();
+  m_thresholdCrossingEvent.Cancel ();
   BreakDeviceEnergyModelRefCycle ();  // break reference cycle
 }
 
@@ -271,9 +334,12 @@ void
 LiIonEnergySource::CalculateRemainingEnergy (void)
 {
   NS_LOG_FUNCTION (this);
-  double totalCurrentA = CalculateTotalCurrent ();
   Time duration = Simulator::Now () - m_lastUpdateTime;
   NS_ASSERT (duration.GetSeconds () >= 0);
+  // the total current is computed at the supply voltage of the last update,
+  // which GetSupplyVoltage must not update again in lazy update mode
+  m_lastUpdateTime = Simulator::Now ();
+  double totalCurrentA = CalculateTotalCurrent ();
   // energy = current * voltage * time
   double energyToDecreaseJ = totalCurrentA * m_supplyVoltageV * duration.GetSeconds ();
 
@@ -288,17 +354,17 @@ LiIonEnergySource::CalculateRemainingEnergy (void)
 
   m_drainedCapacity += (totalCurrentA * duration).GetHours ();
   // update the supply voltage
-  m_supplyVoltageV = GetVoltage (totalCurrentA);
+  m_supplyVoltageV = GetVoltage (totalCurrentA, m_drainedCapacity);
   NS_LOG_DEBUG ("LiIonEnergySource:Remaining energy = " << m_remainingEnergyJ);
 }
 
 double
-LiIonEnergySource::GetVoltage (double i) const
+LiIonEnergySource::GetVoltage (double i, double drainedCapacity) const
 {
-  NS_LOG_FUNCTION (this << i);
+  NS_LOG_FUNCTION (this << i << drainedCapacity);
 
   // integral of i in dt, drained capacity in Ah
-  double it = m_drainedCapacity;
+  double it = drainedCapacity;
 
   // empirical factors
   double A = m_eFull - m_eExp;
@@ -320,4 +386,29 @@ LiIonEnergySource::GetVoltage (double i) const
   return V;
 }
 
+void
+LiIonEnergySource::ScheduleThresholdCrossing (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_energyUpdateEvent.Cancel ();
+  // energy drained per second, at the voltage of the last update
+  double powerW = CalculateTotalCurrent () * m_supplyVoltageV;
+  if (powerW <= 0)
+    {
+      NS_LOG_DEBUG ("LiIonEnergySource:No threshold crossing at the current rate");
+      return;
+    }
+  double energyToThresholdJ = m_remainingEnergyJ - m_lowBatteryTh * m_initialEnergyJ;
+  double delayS = std::max (energyToThresholdJ, 0.0) / powerW;
+  if (delayS >= (Simulator::GetMaximumSimulationTime () - Simulator::Now ()).GetSeconds () / 2)
+    {
+      NS_LOG_DEBUG ("LiIonEnergySource:No threshold crossing in the simulation time");
+      return;
+    }
+  // round up, so that the threshold has been crossed when the event expires
+  Time delay = Seconds (delayS) + TimeStep (1);
+  NS_LOG_DEBUG ("LiIonEnergySource:Threshold crossed in " << delay.As (Time::S));
+  m_energyUpdateEvent = Simulator::Schedule (delay, &LiIonEnergySource::UpdateEnergySource, this);
+}
+
 } // namespace ns3
@@ -58,6 +58,13 @@ namespace ns3 {
  * - ThresholdVoltage, minimum threshold voltage below which the cell is considered
  *   depleted
  *
+ * When the LazyEnergyUpdate attribute is true, the remaining energy is not
+ * updated every PeriodicEnergyUpdateInterval but only when the source is
+ * accessed, and a single event is scheduled at the time when the remaining
+ * energy crosses the low battery threshold. The cell voltage computed at an
+ * update is then used until the next one, which may be further apart than
+ * with periodic updates.
+ *
  * For a complete reference of the energy source model and model's fitting please refer
  * to <a href="http://www.nsnam.org/wiki/GSOC2010UANFramework">UAN Framework</a>
  * page and <a href="http://www.nsnam.org/wiki/Li-Ion_model_fitting">Li-Ion model
@@ -94,7 +101,8 @@ public:
   /**
    * \returns Supply voltage at the energy source.
    *
-   * Implements GetSupplyVoltage.
+   * Implements GetSupplyVoltage. In lazy update mode, the voltage the cell
+   * would have if it were updated now is returned, without updating it.
    */
   virtual double GetSupplyVoltage (void) const;
 
@@ -150,6 +158,19 @@ public:
    * \returns The interval between each energy update.
    */
   Time GetEnergyUpdateInterval (void) const;
+
+  /**
+   * \param lazyUpdate whether to update the remaining energy only when needed
+   *
+   * When true, the remaining energy is not updated periodically; the only
+   * scheduled event is the crossing of the low battery threshold.
+   */
+  void SetLazyEnergyUpdate (bool lazyUpdate);
+
+  /**
+   * \returns whether the remaining energy is only updated when needed
+   */
+  bool GetLazyEnergyUpdate (void) const;
 private:
   void DoInitialize (void);
   void DoDispose (void);
@@ -173,12 +194,21 @@ private:
 
   /**
    *  \param current the actual discharge current value.
+   *  \param drainedCapacity the capacity drained from the cell, in Ah.
    *
    *  Get the cell voltage in function of the discharge current.
    *  It consider different discharge curves for different discharge currents
    *  and the remaining energy of the cell.
    */
-  double GetVoltage (double current) const;
+  double GetVoltage (double current, double drainedCapacity) const;
+
+  /**
+   * Schedules the update of the energy source at the time when the low
+   * battery threshold is crossed, given the current drawn from the source at
+   * the current time. This is used in lazy update mode, after the devices
+   * had the opportunity to change their current.
+   */
+  void ScheduleThresholdCrossing (void);
 
 private:
   double m_initialEnergyJ;                // initial energy, in Joules
@@ -187,7 +217,10 @@ private:
   double m_supplyVoltageV;                // actual voltage of the cell
   double m_lowBatteryTh;                  // low battery threshold, as a fraction of the initial energy
   EventId m_energyUpdateEvent;            // energy update event
+  EventId m_thresholdCrossingEvent;       // event computing the next threshold crossing, in lazy update mode
+  bool m_lazyUpdate;                      // whether the remaining energy is only updated when needed
   Time m_lastUpdateTime;                  // last update time
+  mutable bool m_computingVoltage;        // whether GetSupplyVoltage is computing the voltage in lazy update mode
   Time m_energyUpdateInterval;            // energy update interval
   double m_eFull;                         // initial voltage of the cell, in Volts
   double m_eNom;                          // nominal voltage of the cell, in Volts
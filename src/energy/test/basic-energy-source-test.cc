@@ -0,0 +1,171 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2021
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/log.h"
+#include "ns3/test.h"
+#include "ns3/node.h"
+#include "ns3/simulator.h"
+#include "ns3/double.h"
+#include "ns3/string.h"
+#include "ns3/basic-energy-source.h"
+#include "ns3/basic-energy-harvester.h"
+#include "ns3/simple-device-energy-model.h"
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE ("BasicEnergySourceTestSuite");
+
+/**
+ * \ingroup energy
+ * \ingroup tests
+ *
+ * \brief Device energy model recording the times when the energy source is
+ * depleted and recharged, and switching the device off when it is depleted.
+ */
+class SwitchOffDeviceEnergyModel : public SimpleDeviceEnergyModel
+{
+public:
+  virtual void HandleEnergyDepletion (void)
+  {
+    m_depletionTimes.push_back (Simulator::Now ());
+    SetCurrentA (0);
+  }
+  virtual void HandleEnergyRecharged (void)
+  {
+    m_rechargeTimes.push_back (Simulator::Now ());
+  }
+
+  std::vector<Time> m_depletionTimes;  //!< times when the energy was depleted
+  std::vector<Time> m_rechargeTimes;   //!< times when the energy was recharged
+};
+
+/**
+ * \ingroup energy
+ * \ingroup tests
+ *
+ * \brief Test case checking the times when a BasicEnergySource is depleted
+ * and recharged, with periodic and lazy energy updates.
+ */
+class BasicEnergySourceTestCase : public TestCase
+{
+public:
+  /**
+   * Constructor
+   *
+   * \param lazyUpdate the LazyEnergyUpdate attribute
+   */
+  BasicEnergySourceTestCase (bool lazyUpdate);
+  virtual ~BasicEnergySourceTestCase ();
+
+private:
+  virtual void DoRun (void);
+
+  bool m_lazyUpdate; //!< the LazyEnergyUpdate attribute
+};
+
+BasicEnergySourceTestCase::BasicEnergySourceTestCase (bool lazyUpdate)
+  : TestCase (lazyUpdate ? "Basic energy source with lazy updates"
+                         : "Basic energy source with periodic updates"),
+    m_lazyUpdate (lazyUpdate)
+{
+}
+
+BasicEnergySourceTestCase::~BasicEnergySourceTestCase ()
+{
+}
+
+void
+BasicEnergySourceTestCase::DoRun ()
+{
+  Ptr<Node> node = CreateObject<Node> ();
+  Ptr<BasicEnergySource> source = CreateObject<BasicEnergySource> ();
+  source->SetInitialEnergy (10);
+  source->SetSupplyVoltage (3);
+  source->SetLazyEnergyUpdate (m_lazyUpdate);
+  source->SetNode (node);
+  node->AggregateObject (source);
+
+  Ptr<SwitchOffDeviceEnergyModel> device = CreateObject<SwitchOffDeviceEnergyModel> ();
+  device->SetEnergySource (source);
+  source->AppendDeviceEnergyModel (device);
+
+  // the harvester provides 0.3 W for the whole simulation
+  Ptr<BasicEnergyHarvester> harvester = CreateObject<BasicEnergyHarvester> ();
+  harvester->SetAttribute ("HarvestablePower", StringValue ("ns3::ConstantRandomVariable[Constant=0.3]"));
+  harvester->SetHarvestedPowerUpdateInterval (Seconds (1000));
+  harvester->SetNode (node);
+  harvester->SetEnergySource (source);
+  source->ConnectEnergyHarvester (harvester);
+  harvester->Initialize ();
+
+  // the device draws 0.6 W, the net drain of 0.3 W depletes the 9 J above the
+  // low threshold in 30 s; the device is then switched off and the harvester
+  // recharges the 0.5 J up to the high threshold in 5/3 s
+  device->SetCurrentA (0.2);
+
+  Simulator::Stop (Seconds (100));
+  Simulator::Run ();
+  uint64_t eventCount = Simulator::GetEventCount ();
+  double remainingEnergy = source->GetRemainingEnergy ();
+  Simulator::Destroy ();
+
+  NS_TEST_ASSERT_MSG_EQ (device->m_depletionTimes.size (), 1, "The energy must be depleted once");
+  NS_TEST_ASSERT_MSG_EQ (device->m_rechargeTimes.size (), 1, "The energy must be recharged once");
+  if (m_lazyUpdate)
+    {
+      NS_TEST_EXPECT_MSG_EQ_TOL (device->m_depletionTimes[0].GetSeconds (), 30, 1e-6,
+                                 "Wrong depletion time");
+      NS_TEST_EXPECT_MSG_EQ_TOL (device->m_rechargeTimes[0].GetSeconds (), 30 + 5.0 / 3, 1e-6,
+                                 "Wrong recharge time");
+      NS_TEST_EXPECT_MSG_LT (eventCount, 20, "Too many events with lazy updates");
+    }
+  else
+    {
+      // the thresholds are checked every second
+      NS_TEST_EXPECT_MSG_EQ_TOL (device->m_depletionTimes[0].GetSeconds (), 30, 1e-6,
+                                 "Wrong depletion time");
+      NS_TEST_EXPECT_MSG_EQ_TOL (device->m_rechargeTimes[0].GetSeconds (), 32, 1e-6,
+                                 "Wrong recharge time");
+      NS_TEST_EXPECT_MSG_GT (eventCount, 100, "Periodic updates expected");
+    }
+  // the device is off since the depletion, and the harvester recharges the source
+  double expectedEnergy = 1 + 0.3 * (100 - device->m_depletionTimes[0].GetSeconds ());
+  NS_TEST_EXPECT_MSG_EQ_TOL (remainingEnergy, expectedEnergy, 1e-6, "Wrong remaining energy");
+}
+
+/**
+ * \ingroup energy
+ * \ingroup tests
+ *
+ * \brief Test suite for the basic energy source.
+ */
+class BasicEnergySourceTestSuite : public TestSuite
+{
+public:
+  BasicEnergySourceTestSuite ();
+};
+
+BasicEnergySourceTestSuite::BasicEnergySourceTestSuite ()
+  : TestSuite ("basic-energy-source", UNIT)
+{
+  AddTestCase (new BasicEnergySourceTestCase (false), TestCase::QUICK);
+  AddTestCase (new BasicEnergySourceTestCase (true), TestCase::QUICK);
+}
+
+// create an instance of the test suite
+static BasicEnergySourceTestSuite g_basicEnergySourceTestSuite;
@@ -32,16 +32,19 @@ NS_LOG_COMPONENT_DEFINE ("LiIonEnergySourceTestSuite");
 class LiIonEnergyTestCase : public TestCase
 {
 public:
-  LiIonEnergyTestCase ();
+  LiIonEnergyTestCase (bool lazyUpdate = false);
   ~LiIonEnergyTestCase ();
 
   void DoRun (void);
 
   Ptr<Node> m_node;
+  bool m_lazyUpdate;
 };
 
-LiIonEnergyTestCase::LiIonEnergyTestCase ()
-  : TestCase ("Li-Ion energy source test case")
+LiIonEnergyTestCase::LiIonEnergyTestCase (bool lazyUpdate)
+  : TestCase (lazyUpdate ? "Li-Ion energy source test case with lazy updates"
+                         : "Li-Ion energy source test case"),
+    m_lazyUpdate (lazyUpdate)
 {
 }
 
@@ -57,6 +60,7 @@ LiIonEnergyTestCase::DoRun ()
 
   Ptr<SimpleDeviceEnergyModel> sem = CreateObject<SimpleDeviceEnergyModel> ();
   Ptr<LiIonEnergySource> es = CreateObject<LiIonEnergySource> ();
+  es->SetLazyEnergyUpdate (m_lazyUpdate);
 
   es->SetNode (m_node);
   sem->SetEnergySource (es);
@@ -71,9 +75,12 @@ LiIonEnergyTestCase::DoRun ()
 
   Simulator::Stop (now);
   Simulator::Run ();
+  // in lazy update mode, the voltage is computed when it is requested, which
+  // must happen before Simulator::Destroy resets the simulation time
+  double lazyVoltage = es->GetSupplyVoltage ();
   Simulator::Destroy ();
 
-  NS_TEST_ASSERT_MSG_EQ_TOL (es->GetSupplyVoltage (), 3.6, 1.0e-3,
+  NS_TEST_ASSERT_MSG_EQ_TOL (m_lazyUpdate ? lazyVoltage : es->GetSupplyVoltage (), 3.6, 1.0e-3,
                              "Incorrect consumed energy!");
 }
 
@@ -87,6 +94,7 @@ LiIonEnergySourceTestSuite::LiIonEnergySourceTestSuite ()
   : TestSuite ("li-ion-energy-source", UNIT)
 {
   AddTestCase (new LiIonEnergyTestCase, TestCase::QUICK);
+  AddTestCase (new LiIonEnergyTestCase (true), TestCase::QUICK);
 }
 
 // create an instance of the test suite
@@ -36,10 +36,23 @@
 #include <ns3/simulator.h>
 #include <ns3/node.h>
 #include <ns3/buildings-helper.h>
+#include <ns3/building-list.h>
 #include <ns3/lte-spectrum-value-helper.h>
+#include <ns3/lte-spectrum-signal-parameters.h>
+#include <ns3/propagation-loss-model.h>
+#include <ns3/spectrum-propagation-loss-model.h>
+#include <ns3/spectrum-converter.h>
+#include <ns3/antenna-model.h>
+#include <ns3/angles.h>
+
+#ifdef HAVE_PTHREAD_H
+#include <ns3/system-thread.h>
+#endif
 
 #include <fstream>
 #include <limits>
+#include <algorithm>
+#include <cmath>
 
 namespace ns3 {
 
@@ -48,6 +61,11 @@ NS_LOG_COMPONENT_DEFINE ("RadioEnvironmentMapHelper");
 NS_OBJECT_ENSURE_REGISTERED (RadioEnvironmentMapHelper);
 
 RadioEnvironmentMapHelper::RadioEnvironmentMapHelper ()
+  : m_maxLossDb (std::numeric_limits<double>::max ()),
+    m_hasBuildings (false),
+    m_nextWorker (0),
+    m_nextRow (0),
+    m_nextRowToWrite (0)
 {
 }
 
@@ -62,6 +80,11 @@ void
 RadioEnvironmentMapHelper::DoDispose ()
 {
   NS_LOG_FUNCTION (this);
+  m_recordedTxs.clear ();
+  m_directTxs.clear ();
+  m_directWorkers.clear ();
+  m_propagationLoss = 0;
+  m_spectrumPropagationLoss = 0;
 }
 
 TypeId
@@ -144,6 +167,20 @@ RadioEnvironmentMapHelper::GetTypeId (void)
                    IntegerValue (-1),
                    MakeIntegerAccessor (&RadioEnvironmentMapHelper::m_rbId),
                    MakeIntegerChecker<int32_t> ())
+    .AddAttribute ("DirectEvaluation",
+                   "If true, the SINR of each point is computed by calling the propagation "
+                   "models of the channel directly, from the last frame sent by each "
+                   "transmitter, instead of deploying listeners and running the simulator",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&RadioEnvironmentMapHelper::m_directEvaluation),
+                   MakeBooleanChecker ())
+    .AddAttribute ("NumThreads",
+                   "Number of threads evaluating the map when DirectEvaluation is true. "
+                   "Values greater than 1 require propagation models that are safe to "
+                   "call concurrently, and are ignored without thread support",
+                   UintegerValue (1),
+                   MakeUintegerAccessor (&RadioEnvironmentMapHelper::m_numThreads),
+                   MakeUintegerChecker<uint32_t> (1, std::numeric_limits<uint16_t>::max ()))
   ;
   return tid;
 }
@@ -200,6 +237,12 @@ RadioEnvironmentMapHelper::Install ()
       return;
     }
   
+  if (m_directEvaluation)
+    {
+      m_channel->TraceConnectWithoutContext ("TxSigParams",
+                                             MakeCallback (&RadioEnvironmentMapHelper::RecordTx, this));
+    }
+
   double startDelay = 0.0026;
 
   if (m_useDataChannel)
@@ -220,6 +263,15 @@ RadioEnvironmentMapHelper::DelayedInstall ()
   NS_LOG_FUNCTION (this);
   m_xStep = (m_xMax - m_xMin)/(m_xRes-1);
   m_yStep = (m_yMax - m_yMin)/(m_yRes-1);
+
+  if (m_directEvaluation)
+    {
+      m_channel->TraceDisconnectWithoutContext ("TxSigParams",
+                                                MakeCallback (&RadioEnvironmentMapHelper::RecordTx, this));
+      EvaluateDirectly ();
+      Finalize ();
+      return;
+    }
   
   if ((double)m_xRes * (double) m_yRes < (double) m_maxPointsPerIteration)
     {
@@ -341,6 +393,236 @@ RadioEnvironmentMapHelper::PrintAndReset ()
     }
 }
 
+void
+RadioEnvironmentMapHelper::RecordTx (Ptr<SpectrumSignalParameters> params)
+{
+  bool isDlFrame = m_useDataChannel
+    ? (DynamicCast<LteSpectrumSignalParametersDataFrame> (params) != 0)
+    : (DynamicCast<LteSpectrumSignalParametersDlCtrlFrame> (params) != 0);
+  if (isDlFrame)
+    {
+      m_recordedTxs[PeekPointer (params->txPhy)] = params;
+    }
+}
+
+void
+RadioEnvironmentMapHelper::EvaluateDirectly ()
+{
+  NS_LOG_FUNCTION (this << m_recordedTxs.size ());
+
+  // the same coordinates as in DelayedInstall
+  for (double x = m_xMin; x < m_xMax + 0.5*m_xStep; x += m_xStep)
+    {
+      m_xs.push_back (x);
+    }
+  for (double y = m_yMin; y < m_yMax + 0.5*m_yStep; y += m_yStep)
+    {
+      m_ys.push_back (y);
+    }
+
+  DoubleValue maxLossDb;
+  m_channel->GetAttribute ("MaxLossDb", maxLossDb);
+  m_maxLossDb = maxLossDb.Get ();
+  m_propagationLoss = m_channel->GetPropagationLossModel ();
+  m_spectrumPropagationLoss = m_channel->GetSpectrumPropagationLossModel ();
+  // locating a point in the buildings is not thread-safe
+  m_hasBuildings = (BuildingList::GetNBuildings () > 0);
+
+  Ptr<const SpectrumModel> remModel = LteSpectrumValueHelper::GetSpectrumModel (m_earfcn, m_bandwidth);
+  for (std::map<const SpectrumPhy *, Ptr<SpectrumSignalParameters> >::const_iterator it = m_recordedTxs.begin ();
+       it != m_recordedTxs.end ();
+       ++it)
+    {
+      Ptr<SpectrumSignalParameters> params = it->second;
+      Ptr<MobilityModel> txMobility = params->txPhy->GetMobility ();
+      if (txMobility == 0)
+        {
+          NS_LOG_WARN ("ignoring transmitter " << params->txPhy << " without a mobility model");
+          continue;
+        }
+      Ptr<const SpectrumModel> txModel = params->psd->GetSpectrumModel ();
+      DirectTx tx;
+      if (txModel->GetUid () == remModel->GetUid ())
+        {
+          tx.psd = Copy<SpectrumValue> (params->psd);
+        }
+      else if (!txModel->IsOrthogonal (*remModel))
+        {
+          SpectrumConverter converter (txModel, remModel);
+          tx.psd = converter.Convert (params->psd);
+        }
+      else
+        {
+          continue;
+        }
+      tx.position = txMobility->GetPosition ();
+      tx.antenna = params->txAntenna;
+      tx.power = (m_rbId >= 0) ? (*tx.psd)[m_rbId] * 180000 : Integral (*tx.psd);
+      m_directTxs.push_back (tx);
+    }
+  m_recordedTxs.clear ();
+
+  uint32_t numThreads = 1;
+#ifdef HAVE_PTHREAD_H
+  if (!m_hasBuildings)
+    {
+      numThreads = std::min<uint32_t> (m_numThreads, m_xs.size ());
+    }
+#endif
+  // each thread gets its own copies of the objects used by the
+  // propagation models, created here by the main thread
+  m_directWorkers.resize (numThreads);
+  for (uint32_t i = 0; i < numThreads; i++)
+    {
+      DirectWorker &worker = m_directWorkers[i];
+      for (std::vector<DirectTx>::const_iterator tx = m_directTxs.begin (); tx != m_directTxs.end (); ++tx)
+        {
+          Ptr<MobilityModel> txMobility = CreateObject<ConstantPositionMobilityModel> ();
+          Ptr<MobilityBuildingInfo> buildingInfo = CreateObject<MobilityBuildingInfo> ();
+          txMobility->AggregateObject (buildingInfo);
+          txMobility->SetPosition (tx->position);
+          if (m_hasBuildings)
+            {
+              buildingInfo->MakeConsistent (txMobility);
+            }
+          worker.txMobility.push_back (txMobility);
+          worker.txPsd.push_back (Copy<SpectrumValue> (tx->psd));
+        }
+      worker.rxMobility = CreateObject<ConstantPositionMobilityModel> ();
+      worker.rxMobility->AggregateObject (CreateObject<MobilityBuildingInfo> ());
+    }
+
+  m_nextWorker = 0;
+  m_nextRow = 0;
+  m_nextRowToWrite = 0;
+  if (numThreads == 1)
+    {
+      EvaluateRows ();
+    }
+#ifdef HAVE_PTHREAD_H
+  else
+    {
+      std::vector<Ptr<SystemThread> > threads;
+      for (uint32_t i = 0; i < numThreads; i++)
+        {
+          threads.push_back (Create<SystemThread> (MakeCallback (&RadioEnvironmentMapHelper::EvaluateRows, this)));
+          threads.back ()->Start ();
+        }
+      for (uint32_t i = 0; i < numThreads; i++)
+        {
+          threads[i]->Join ();
+        }
+    }
+#endif
+  NS_ASSERT (m_nextRowToWrite == m_xs.size ());
+  m_directWorkers.clear ();
+  m_directTxs.clear ();
+}
+
+void
+RadioEnvironmentMapHelper::EvaluateRows ()
+{
+  DirectWorker *worker;
+  {
+#ifdef HAVE_PTHREAD_H
+    CriticalSection cs (m_directMutex);
+#endif
+    worker = &m_directWorkers[m_nextWorker++];
+  }
+  // the objects shared by the threads are only accessed through the
+  // members holding them, so that their reference count is not modified
+  Ptr<MobilityBuildingInfo> rxBuildingInfo = worker->rxMobility->GetObject<MobilityBuildingInfo> ();
+
+  while (true)
+    {
+      uint32_t row;
+      {
+#ifdef HAVE_PTHREAD_H
+        CriticalSection cs (m_directMutex);
+#endif
+        if (m_nextRow == m_xs.size ())
+          {
+            break;
+          }
+        row = m_nextRow++;
+      }
+
+      std::vector<double> sinrs;
+      sinrs.reserve (m_ys.size ());
+      for (std::vector<double>::const_iterator y = m_ys.begin (); y != m_ys.end (); ++y)
+        {
+          Vector rxPosition (m_xs[row], *y, m_z);
+          worker->rxMobility->SetPosition (rxPosition);
+          if (m_hasBuildings)
+            {
+              rxBuildingInfo->MakeConsistent (worker->rxMobility);
+            }
+          // same as RemSpectrumPhy, with the losses of MultiModelSpectrumChannel
+          double sumPower = 0;
+          double referenceSignalPower = 0;
+          for (std::size_t i = 0; i < m_directTxs.size (); i++)
+            {
+              const DirectTx &tx = m_directTxs[i];
+              double pathLossDb = 0;
+              if (tx.antenna != 0)
+                {
+                  pathLossDb -= tx.antenna->GetGainDb (Angles (rxPosition, tx.position));
+                }
+              if (m_propagationLoss != 0)
+                {
+                  pathLossDb -= m_propagationLoss->CalcRxPower (0, worker->txMobility[i], worker->rxMobility);
+                }
+              if (pathLossDb > m_maxLossDb)
+                {
+                  continue;
+                }
+              double pathGainLinear = std::pow (10.0, (-pathLossDb) / 10.0);
+              double power;
+              if (m_spectrumPropagationLoss != 0)
+                {
+                  Ptr<SpectrumValue> rxPsd = Copy<SpectrumValue> (worker->txPsd[i]);
+                  *rxPsd *= pathGainLinear;
+                  rxPsd = m_spectrumPropagationLoss->CalcRxPowerSpectralDensity (rxPsd, worker->txMobility[i], worker->rxMobility);
+                  power = (m_rbId >= 0) ? (*rxPsd)[m_rbId] * 180000 : Integral (*rxPsd);
+                }
+              else
+                {
+                  power = tx.power * pathGainLinear;
+                }
+              sumPower += power;
+              if (power > referenceSignalPower)
+                {
+                  referenceSignalPower = power;
+                }
+            }
+          sinrs.push_back (referenceSignalPower / (sumPower - referenceSignalPower + m_noisePower));
+        }
+
+      {
+#ifdef HAVE_PTHREAD_H
+        CriticalSection cs (m_directMutex);
+#endif
+        m_completedRows[row].swap (sinrs);
+        // stream the rows in order, as soon as the previous ones are done
+        while (!m_completedRows.empty () && m_completedRows.begin ()->first == m_nextRowToWrite)
+          {
+            const std::vector<double> &completed = m_completedRows.begin ()->second;
+            for (std::size_t j = 0; j < completed.size (); j++)
+              {
+                m_outFile << m_xs[m_nextRowToWrite] << "\t"
+                          << m_ys[j] << "\t"
+                          << m_z << "\t"
+                          << completed[j]
+                          << "\n";
+              }
+            m_outFile.flush ();
+            m_completedRows.erase (m_completedRows.begin ());
+            m_nextRowToWrite++;
+          }
+      }
+    }
+}
+
 void 
 RadioEnvironmentMapHelper::Finalize ()
 {
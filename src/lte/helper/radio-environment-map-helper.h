@@ -24,7 +24,15 @@
 
 
 #include <ns3/object.h>
+#include <ns3/core-config.h>
+#include <ns3/vector.h>
 #include <fstream>
+#include <map>
+#include <vector>
+
+#ifdef HAVE_PTHREAD_H
+#include <ns3/system-mutex.h>
+#endif
 
 
 namespace ns3 {
@@ -33,6 +41,12 @@ class RemSpectrumPhy;
 class Node;
 class NetDevice;
 class SpectrumChannel;
+class SpectrumValue;
+class SpectrumPhy;
+class PropagationLossModel;
+class SpectrumPropagationLossModel;
+class AntennaModel;
+struct SpectrumSignalParameters;
 //class BuildingsMobilityModel;
 class MobilityModel;
 
@@ -42,6 +56,23 @@ class MobilityModel;
  * Generates a 2D map of the SINR from the strongest transmitter in the
  * downlink of an LTE FDD system. For instructions on usage, please refer to
  * the User Documentation.
+ *
+ * By default, the map is generated by deploying RemSpectrumPhy listeners,
+ * MaxPointsPerIteration at a time, and letting the simulator deliver the
+ * signals of the eNBs to them. When the DirectEvaluation attribute is
+ * true, the helper instead records the last frame sent by each eNB on the
+ * channel, and computes the SINR of every point by calling the
+ * propagation loss models of the channel directly, with the same
+ * formulas. The rows of the map (points with the same x coordinate) are
+ * then evaluated by NumThreads threads, and written to the output file in
+ * order as soon as they are complete.
+ *
+ * \warning With NumThreads greater than 1, the propagation loss models of
+ * the channel are called concurrently. This is only safe for the models
+ * that compute the loss from the positions alone (e.g., Friis, LogDistance,
+ * Cost231, OkumuraHata), not for the models that keep per-link state or
+ * draw random variables, such as the buildings-aware or the fading models.
+ * When there are buildings, the map is always evaluated by a single thread.
  */
 class RadioEnvironmentMapHelper : public Object
 {
@@ -108,6 +139,49 @@ private:
   /// Called when the map generation procedure has been completed.
   void Finalize ();
 
+  /**
+   * Record the last DL frame (control or data, according to
+   * `UseDataChannel`) sent by each transmitter on the channel, for the
+   * direct evaluation of the map.
+   *
+   * \param params the parameters of the transmitted signal
+   */
+  void RecordTx (Ptr<SpectrumSignalParameters> params);
+
+  /**
+   * Generate the whole map from the frames recorded by RecordTx, without
+   * running the simulator.
+   */
+  void EvaluateDirectly ();
+
+  /**
+   * Evaluate the rows of the map not taken by another thread yet, and
+   * write them to the output file in order. Run by each thread started by
+   * EvaluateDirectly, or by the main thread if there is only one.
+   */
+  void EvaluateRows ();
+
+  /// A transmitter, for the direct evaluation of the map.
+  struct DirectTx
+  {
+    Vector position;             ///< Position of the transmitter.
+    Ptr<AntennaModel> antenna;   ///< Transmit antenna, if any.
+    Ptr<SpectrumValue> psd;      ///< Transmitted PSD, in the spectrum model of the map.
+    double power;                ///< Transmitted power over the RBs of the map.
+  };
+
+  /**
+   * The objects owned by one thread of the direct evaluation, so that the
+   * threads do not share reference-counted objects, which are not
+   * thread-safe.
+   */
+  struct DirectWorker
+  {
+    std::vector<Ptr<MobilityModel> > txMobility;  ///< Copies of the mobility of the transmitters.
+    std::vector<Ptr<SpectrumValue> > txPsd;       ///< Copies of the PSD of the transmitters.
+    Ptr<MobilityModel> rxMobility;                ///< Position of the current point.
+  };
+
   /// A complete Radio Environment Map is composed of many of this structure.
   struct RemPoint 
   {
@@ -152,6 +226,28 @@ private:
   bool m_useDataChannel;  ///< The `UseDataChannel` attribute.
   int32_t m_rbId;         ///< The `RbId` attribute.
 
+  bool m_directEvaluation;  ///< The `DirectEvaluation` attribute.
+  uint32_t m_numThreads;    ///< The `NumThreads` attribute.
+
+  /// Last frame sent by each transmitter, recorded by RecordTx.
+  std::map<const SpectrumPhy *, Ptr<SpectrumSignalParameters> > m_recordedTxs;
+  std::vector<DirectTx> m_directTxs;          ///< Transmitters of the direct evaluation.
+  std::vector<DirectWorker> m_directWorkers;  ///< Objects of each thread of the direct evaluation.
+  std::vector<double> m_xs;                   ///< X coordinates of the rows of the map.
+  std::vector<double> m_ys;                   ///< Y coordinates of the points of a row.
+  double m_maxLossDb;                         ///< The `MaxLossDb` of the channel.
+  Ptr<PropagationLossModel> m_propagationLoss;                  ///< The propagation loss model of the channel.
+  Ptr<SpectrumPropagationLossModel> m_spectrumPropagationLoss;  ///< The spectrum propagation loss model of the channel.
+  bool m_hasBuildings;                        ///< Whether the points must be located in the buildings.
+  uint32_t m_nextWorker;                      ///< Index of the next thread to start.
+  uint32_t m_nextRow;                         ///< Index of the next row to evaluate.
+  uint32_t m_nextRowToWrite;                  ///< Index of the next row to write.
+  /// Evaluated rows waiting for the previous ones to be written.
+  std::map<uint32_t, std::vector<double> > m_completedRows;
+#ifdef HAVE_PTHREAD_H
+  SystemMutex m_directMutex;  ///< Protects the state shared by the threads.
+#endif
+
 }; // end of `class RadioEnvironmentMapHelper`
 
 
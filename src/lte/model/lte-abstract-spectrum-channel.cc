@@ -0,0 +1,461 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2021
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <ns3/simulator.h>
+#include <ns3/log.h>
+#include <ns3/boolean.h>
+#include <ns3/net-device.h>
+#include <ns3/node.h>
+#include <ns3/mobility-model.h>
+#include <ns3/spectrum-phy.h>
+#include <ns3/spectrum-propagation-loss-model.h>
+#include <ns3/propagation-loss-model.h>
+#include <ns3/propagation-delay-model.h>
+#include <ns3/antenna-model.h>
+#include <ns3/angles.h>
+#include "lte-spectrum-phy.h"
+#include "lte-spectrum-signal-parameters.h"
+#include "lte-abstract-spectrum-channel.h"
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("LteAbstractSpectrumChannel");
+
+NS_OBJECT_ENSURE_REGISTERED (LteAbstractSpectrumChannel);
+
+LteAbstractSpectrumChannel::LteAbstractSpectrumChannel ()
+  : m_fullLoadEpoch (0),
+    m_cacheLinkGains (true)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+LteAbstractSpectrumChannel::DoDispose ()
+{
+  NS_LOG_FUNCTION (this);
+  m_rxs.clear ();
+  m_fullLoadTxs.clear ();
+  m_linkGains.clear ();
+  m_converters.clear ();
+  m_orthogonalModels.clear ();
+  m_pendingInterference.clear ();
+  m_deliverInterferenceEvent.Cancel ();
+  SpectrumChannel::DoDispose ();
+}
+
+TypeId
+LteAbstractSpectrumChannel::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::LteAbstractSpectrumChannel")
+    .SetParent<SpectrumChannel> ()
+    .SetGroupName ("Lte")
+    .AddConstructor<LteAbstractSpectrumChannel> ()
+    .AddAttribute ("CacheLinkGains",
+                   "If true, the gain of a link is only computed again when "
+                   "one of its ends moves. Set to false if the propagation "
+                   "loss model is stochastic or time-varying, so that the "
+                   "gains and the interference are computed for each signal.",
+                   BooleanValue (true),
+                   MakeBooleanAccessor (&LteAbstractSpectrumChannel::m_cacheLinkGains),
+                   MakeBooleanChecker ())
+  ;
+  return tid;
+}
+
+void
+LteAbstractSpectrumChannel::AddRx (Ptr<SpectrumPhy> phy)
+{
+  NS_LOG_FUNCTION (this << phy);
+  for (std::vector<RxInfo>::iterator it = m_rxs.begin (); it != m_rxs.end (); ++it)
+    {
+      if (it->phy == phy)
+        {
+          // the spectrum model of the receiver is looked up for each
+          // signal, so there is nothing to update
+          return;
+        }
+    }
+  RxInfo rx;
+  rx.phy = phy;
+  rx.ltePhy = DynamicCast<LteSpectrumPhy> (phy);
+  rx.interferenceModel = 0;
+  rx.interferenceEpoch = 0;
+  rx.interferenceCellId = 0;
+  rx.interferenceValid = false;
+  m_rxs.push_back (rx);
+}
+
+void
+LteAbstractSpectrumChannel::UpdateFullLoadTx (Ptr<SpectrumSignalParameters> params, uint16_t cellId,
+                                              Ptr<MobilityModel> txMobility)
+{
+  Vector position = txMobility ? txMobility->GetPosition () : Vector ();
+  std::map<const SpectrumPhy *, FullLoadTx>::iterator it = m_fullLoadTxs.find (PeekPointer (params->txPhy));
+  if (it != m_fullLoadTxs.end ())
+    {
+      FullLoadTx &tx = it->second;
+      if (tx.cellId == cellId && tx.position == position && tx.antenna == params->txAntenna
+          && tx.psd->GetSpectrumModelUid () == params->psd->GetSpectrumModelUid ()
+          && std::equal (tx.psd->ConstValuesBegin (), tx.psd->ConstValuesEnd (),
+                         params->psd->ConstValuesBegin ()))
+        {
+          return;
+        }
+    }
+  NS_LOG_LOGIC ("updating eNB of cell " << cellId);
+  FullLoadTx &tx = m_fullLoadTxs[PeekPointer (params->txPhy)];
+  tx.phy = params->txPhy;
+  tx.antenna = params->txAntenna;
+  tx.psd = Copy<SpectrumValue> (params->psd);
+  tx.position = position;
+  tx.cellId = cellId;
+  m_fullLoadEpoch++;
+}
+
+Ptr<const SpectrumValue>
+LteAbstractSpectrumChannel::Convert (Ptr<const SpectrumValue> psd,
+                                     Ptr<const SpectrumModel> rxModel)
+{
+  SpectrumModelUid_t txUid = psd->GetSpectrumModelUid ();
+  SpectrumModelUid_t rxUid = rxModel->GetUid ();
+  if (txUid == rxUid)
+    {
+      return psd;
+    }
+  std::pair<SpectrumModelUid_t, SpectrumModelUid_t> key (txUid, rxUid);
+  ConverterMap_t::const_iterator it = m_converters.find (key);
+  if (it == m_converters.end ())
+    {
+      if (m_orthogonalModels.find (key) != m_orthogonalModels.end ())
+        {
+          return 0;
+        }
+      if (psd->GetSpectrumModel ()->IsOrthogonal (*rxModel))
+        {
+          m_orthogonalModels.insert (key);
+          return 0;
+        }
+      NS_LOG_LOGIC ("Creating converter between SpectrumModelUid " << txUid << " and " << rxUid);
+      it = m_converters.insert (std::make_pair (key, SpectrumConverter (psd->GetSpectrumModel (), rxModel))).first;
+    }
+  return it->second.Convert (psd);
+}
+
+const LteAbstractSpectrumChannel::LinkGain &
+LteAbstractSpectrumChannel::GetLinkGain (Ptr<SpectrumPhy> txPhy, Ptr<AntennaModel> txAntenna,
+                                         Ptr<MobilityModel> txMobility,
+                                         Ptr<SpectrumPhy> rxPhy, Ptr<MobilityModel> rxMobility)
+{
+  Vector txPosition = txMobility->GetPosition ();
+  Vector rxPosition = rxMobility->GetPosition ();
+  std::pair<const SpectrumPhy *, const SpectrumPhy *> key (PeekPointer (txPhy), PeekPointer (rxPhy));
+  LinkGainMap_t::iterator it = m_linkGains.find (key);
+  if (m_cacheLinkGains && it != m_linkGains.end ()
+      && it->second.txPosition == txPosition && it->second.rxPosition == rxPosition)
+    {
+      return it->second;
+    }
+
+  double txAntennaGain = 0;
+  double rxAntennaGain = 0;
+  double propagationGainDb = 0;
+  double pathLossDb = 0;
+  if (txAntenna != 0)
+    {
+      Angles txAngles (rxPosition, txPosition);
+      txAntennaGain = txAntenna->GetGainDb (txAngles);
+      pathLossDb -= txAntennaGain;
+    }
+  Ptr<AntennaModel> rxAntenna = rxPhy->GetRxAntenna ();
+  if (rxAntenna != 0)
+    {
+      Angles rxAngles (txPosition, rxPosition);
+      rxAntennaGain = rxAntenna->GetGainDb (rxAngles);
+      pathLossDb -= rxAntennaGain;
+    }
+  if (m_propagationLoss)
+    {
+      propagationGainDb = m_propagationLoss->CalcRxPower (0, txMobility, rxMobility);
+      pathLossDb -= propagationGainDb;
+    }
+  NS_LOG_LOGIC ("total pathLoss = " << pathLossDb << " dB");
+  m_gainTrace (txMobility, rxMobility, txAntennaGain, rxAntennaGain, propagationGainDb, pathLossDb);
+  m_pathLossTrace (txPhy, rxPhy, pathLossDb);
+
+  LinkGain &link = m_linkGains[key];
+  link.txPosition = txPosition;
+  link.rxPosition = rxPosition;
+  link.gain = std::pow (10.0, (-pathLossDb) / 10.0);
+  link.inRange = (pathLossDb <= m_maxLossDb);
+  return link;
+}
+
+Ptr<const SpectrumValue>
+LteAbstractSpectrumChannel::GetInterference (RxInfo &rx, uint16_t cellId,
+                                             Ptr<const SpectrumModel> rxModel,
+                                             Ptr<MobilityModel> rxMobility)
+{
+  Vector rxPosition = rxMobility ? rxMobility->GetPosition () : Vector ();
+  if (m_cacheLinkGains && rx.interferenceValid && rx.interferenceCellId == cellId
+      && rx.interferenceEpoch == m_fullLoadEpoch
+      && rx.interferenceModel == rxModel->GetUid ()
+      && rx.interferencePosition == rxPosition)
+    {
+      return rx.interference;
+    }
+
+  NS_LOG_LOGIC ("computing the interference of " << rx.phy << " in cell " << cellId);
+  Ptr<SpectrumValue> interference;
+  for (std::map<const SpectrumPhy *, FullLoadTx>::const_iterator it = m_fullLoadTxs.begin ();
+       it != m_fullLoadTxs.end ();
+       ++it)
+    {
+      const FullLoadTx &tx = it->second;
+      if (tx.cellId == cellId || tx.phy == rx.phy)
+        {
+          continue;
+        }
+      Ptr<const SpectrumValue> psd = Convert (tx.psd, rxModel);
+      if (psd == 0)
+        {
+          continue;
+        }
+      Ptr<SpectrumValue> rxPsd = Copy<SpectrumValue> (psd);
+      Ptr<MobilityModel> txMobility = tx.phy->GetMobility ();
+      if (txMobility && rxMobility)
+        {
+          const LinkGain &link = GetLinkGain (tx.phy, tx.antenna, txMobility, rx.phy, rxMobility);
+          if (!link.inRange)
+            {
+              continue;
+            }
+          *rxPsd *= link.gain;
+          if (m_spectrumPropagationLoss)
+            {
+              rxPsd = m_spectrumPropagationLoss->CalcRxPowerSpectralDensity (rxPsd, txMobility, rxMobility);
+            }
+        }
+      if (interference == 0)
+        {
+          interference = rxPsd;
+        }
+      else
+        {
+          *interference += *rxPsd;
+        }
+    }
+
+  rx.interference = interference;
+  rx.interferenceModel = rxModel->GetUid ();
+  rx.interferencePosition = rxPosition;
+  rx.interferenceEpoch = m_fullLoadEpoch;
+  rx.interferenceCellId = cellId;
+  rx.interferenceValid = true;
+  return interference;
+}
+
+void
+LteAbstractSpectrumChannel::StartTx (Ptr<SpectrumSignalParameters> txParams)
+{
+  NS_LOG_FUNCTION (this << txParams);
+
+  NS_ASSERT (txParams->txPhy);
+  NS_ASSERT (txParams->psd);
+  Ptr<SpectrumSignalParameters> txParamsTrace = txParams->Copy (); // copy it since traced value cannot be const (because of potential underlying DynamicCasts)
+  m_txSigParamsTrace (txParamsTrace);
+
+  Ptr<MobilityModel> txMobility = txParams->txPhy->GetMobility ();
+
+  // only the signals of the eNBs, which are the only ones sending control
+  // frames, are abstracted; the other LTE signals are summed at the
+  // receivers of other cells
+  bool lteSignal = false;
+  bool abstracted = false;
+  bool pss = false;
+  uint16_t cellId = 0;
+  Ptr<LteSpectrumSignalParametersDlCtrlFrame> dlCtrlParams = DynamicCast<LteSpectrumSignalParametersDlCtrlFrame> (txParams);
+  Ptr<LteSpectrumSignalParametersDataFrame> dataParams;
+  Ptr<LteSpectrumSignalParametersUlSrsFrame> ulSrsParams;
+  if (dlCtrlParams != 0)
+    {
+      lteSignal = true;
+      abstracted = true;
+      pss = dlCtrlParams->pss;
+      cellId = dlCtrlParams->cellId;
+      UpdateFullLoadTx (txParams, cellId, txMobility);
+    }
+  else if ((dataParams = DynamicCast<LteSpectrumSignalParametersDataFrame> (txParams)) != 0)
+    {
+      lteSignal = true;
+      abstracted = (m_fullLoadTxs.find (PeekPointer (txParams->txPhy)) != m_fullLoadTxs.end ());
+      cellId = dataParams->cellId;
+    }
+  else if ((ulSrsParams = DynamicCast<LteSpectrumSignalParametersUlSrsFrame> (txParams)) != 0)
+    {
+      lteSignal = true;
+      cellId = ulSrsParams->cellId;
+    }
+
+  for (std::size_t rxIndex = 0; rxIndex < m_rxs.size (); rxIndex++)
+    {
+      RxInfo &rx = m_rxs[rxIndex];
+      if (rx.phy == txParams->txPhy)
+        {
+          continue;
+        }
+      bool serving = false;
+      bool interferenceOnly = false;
+      if (lteSignal && rx.ltePhy != 0)
+        {
+          serving = (rx.ltePhy->GetCellId () == cellId);
+          if (abstracted && !serving && !pss)
+            {
+              // accounted for in the interference of the receiver
+              continue;
+            }
+          interferenceOnly = (!abstracted && !serving && !m_propagationDelay);
+        }
+
+      Ptr<const SpectrumModel> rxModel = rx.phy->GetRxSpectrumModel ();
+      Ptr<const SpectrumValue> psd = Convert (txParams->psd, rxModel);
+      if (psd == 0)
+        {
+          continue;
+        }
+      Ptr<SpectrumSignalParameters> rxParams = txParams->Copy ();
+      rxParams->psd = Copy<SpectrumValue> (psd);
+      Time delay = MicroSeconds (0);
+
+      Ptr<MobilityModel> rxMobility = rx.phy->GetMobility ();
+      if (txMobility && rxMobility)
+        {
+          const LinkGain &link = GetLinkGain (txParams->txPhy, txParams->txAntenna, txMobility,
+                                              rx.phy, rxMobility);
+          if (!link.inRange)
+            {
+              continue;
+            }
+          *(rxParams->psd) *= link.gain;
+          if (m_spectrumPropagationLoss)
+            {
+              rxParams->psd = m_spectrumPropagationLoss->CalcRxPowerSpectralDensity (rxParams->psd, txMobility, rxMobility);
+            }
+          if (m_propagationDelay)
+            {
+              delay = m_propagationDelay->GetDelay (txMobility, rxMobility);
+            }
+        }
+
+      if (interferenceOnly)
+        {
+          AddInterference (rxIndex, rxParams->psd, txParams->duration);
+          continue;
+        }
+
+      // in the subframes carrying the PSS, the control frames of all the
+      // cells are delivered, hence they make their own interference
+      if (abstracted && serving && !pss)
+        {
+          Ptr<const SpectrumValue> interference = GetInterference (rx, cellId, rxModel, rxMobility);
+          if (interference != 0)
+            {
+              Ptr<SpectrumSignalParameters> interferenceParams = Create<SpectrumSignalParameters> ();
+              interferenceParams->psd = Copy<SpectrumValue> (interference);
+              interferenceParams->duration = txParams->duration;
+              ScheduleRx (interferenceParams, rx.phy, delay);
+            }
+        }
+      ScheduleRx (rxParams, rx.phy, delay);
+    }
+}
+
+void
+LteAbstractSpectrumChannel::AddInterference (std::size_t rxIndex, Ptr<SpectrumValue> psd, Time duration)
+{
+  std::pair<PendingInterferenceMap_t::iterator, bool> ret;
+  ret = m_pendingInterference.insert (std::make_pair (std::make_pair (rxIndex, duration), psd));
+  if (!ret.second)
+    {
+      *(ret.first->second) += *psd;
+    }
+  if (!m_deliverInterferenceEvent.IsRunning ())
+    {
+      // the signals of a subframe are all sent before this event runs
+      m_deliverInterferenceEvent = Simulator::ScheduleNow (&LteAbstractSpectrumChannel::DeliverInterference, this);
+    }
+}
+
+void
+LteAbstractSpectrumChannel::DeliverInterference (void)
+{
+  NS_LOG_FUNCTION (this << m_pendingInterference.size ());
+  for (PendingInterferenceMap_t::const_iterator it = m_pendingInterference.begin ();
+       it != m_pendingInterference.end ();
+       ++it)
+    {
+      Ptr<SpectrumSignalParameters> params = Create<SpectrumSignalParameters> ();
+      params->psd = it->second;
+      params->duration = it->first.second;
+      ScheduleRx (params, m_rxs[it->first.first].phy, Seconds (0));
+    }
+  m_pendingInterference.clear ();
+}
+
+void
+LteAbstractSpectrumChannel::ScheduleRx (Ptr<SpectrumSignalParameters> params, Ptr<SpectrumPhy> receiver, Time delay)
+{
+  Ptr<NetDevice> netDev = receiver->GetDevice ();
+  if (netDev)
+    {
+      // the receiver has a NetDevice, so we expect that it is attached to a Node
+      uint32_t dstNode =  netDev->GetNode ()->GetId ();
+      Simulator::ScheduleWithContext (dstNode, delay, &LteAbstractSpectrumChannel::StartRx, this,
+                                      params, receiver);
+    }
+  else
+    {
+      // the receiver is not attached to a NetDevice, so we cannot assume that it is attached to a node
+      Simulator::Schedule (delay, &LteAbstractSpectrumChannel::StartRx, this,
+                           params, receiver);
+    }
+}
+
+void
+LteAbstractSpectrumChannel::StartRx (Ptr<SpectrumSignalParameters> params, Ptr<SpectrumPhy> receiver)
+{
+  NS_LOG_FUNCTION (this);
+  receiver->StartRx (params);
+}
+
+std::size_t
+LteAbstractSpectrumChannel::GetNDevices (void) const
+{
+  return m_rxs.size ();
+}
+
+Ptr<NetDevice>
+LteAbstractSpectrumChannel::GetDevice (std::size_t i) const
+{
+  NS_ASSERT (i < m_rxs.size ());
+  return m_rxs[i].phy->GetDevice ();
+}
+
+} // namespace ns3
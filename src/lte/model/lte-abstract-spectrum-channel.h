@@ -0,0 +1,241 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2021
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef LTE_ABSTRACT_SPECTRUM_CHANNEL_H
+#define LTE_ABSTRACT_SPECTRUM_CHANNEL_H
+
+#include <ns3/spectrum-channel.h>
+#include <ns3/spectrum-converter.h>
+#include <ns3/vector.h>
+#include <ns3/event-id.h>
+#include <ns3/nstime.h>
+#include <map>
+#include <set>
+#include <vector>
+
+namespace ns3 {
+
+class LteSpectrumPhy;
+class AntennaModel;
+
+/**
+ * \ingroup lte
+ *
+ * \brief A SpectrumChannel abstracting the inter-cell interference of the
+ * LTE downlink, meant for system-level capacity studies with many cells.
+ *
+ * With a MultiModelSpectrumChannel, every eNB transmission is delivered to
+ * every UE, each of which accumulates all of them in its LteInterference
+ * objects, so that the cost of each TTI grows with the product of the
+ * number of eNBs and of UEs. This channel instead:
+ *
+ *  - delivers the data and control frames of an eNB only to the UEs
+ *    synchronized with its cell, plus the control frames carrying the PSS
+ *    to all the UEs, for the cell search and the UE measurements;
+ *  - delivers to a UE, along with each data and control frame of its
+ *    serving cell, a single signal holding the interference of all the
+ *    other cells, computed assuming that they transmit over their whole
+ *    bandwidth at the power of their control frames (full load);
+ *  - computes the gain of each link (antenna gains and propagation loss)
+ *    once, and again only when one of its ends moves, so that the
+ *    interference of a UE is only recomputed when it changes cell, moves,
+ *    or when an eNB moves or changes its transmission power.
+ *
+ * Caching the link gains assumes that the PropagationLossModel is a
+ * deterministic function of the positions: a stochastic or time-varying
+ * model (e.g., RandomPropagationLossModel or NakagamiPropagationLossModel)
+ * is frozen at its first draw for each link, until one of its ends moves.
+ * Set the CacheLinkGains attribute to false to compute the gains, and
+ * hence the interference, again for each signal with such models.
+ *
+ * The UE PHY then evaluates the SINR, the CQI and the errors of the
+ * transport blocks of its serving cell as usual, using this long-term
+ * interference.
+ *
+ * The uplink signals are not abstracted: instead, the signals of the UEs
+ * of other cells, which an eNB can only see as interference, are summed
+ * into a single signal per eNB and per duration, which gives the same
+ * SINR as delivering them one by one. This is only done when there is no
+ * PropagationDelayModel.
+ *
+ * The PathLoss and Gain traces are fired when the gain of a link is
+ * computed, hence not for each signal when the gains are cached, which is enough to fill a
+ * LteGlobalPathlossDatabase. A SpectrumPropagationLossModel, if any, is
+ * applied to each delivered signal, and when computing the interference of
+ * a UE.
+ *
+ * This channel is selected with
+ * LteHelper::SetSpectrumChannelType ("ns3::LteAbstractSpectrumChannel").
+ */
+class LteAbstractSpectrumChannel : public SpectrumChannel
+{
+public:
+  LteAbstractSpectrumChannel ();
+
+  /**
+   * \brief Get the type ID.
+   * \return the object TypeId
+   */
+  static TypeId GetTypeId (void);
+
+  // inherited from SpectrumChannel
+  virtual void AddRx (Ptr<SpectrumPhy> phy);
+  virtual void StartTx (Ptr<SpectrumSignalParameters> params);
+
+  // inherited from Channel
+  virtual std::size_t GetNDevices (void) const;
+  virtual Ptr<NetDevice> GetDevice (std::size_t i) const;
+
+protected:
+  void DoDispose ();
+
+private:
+  /// The gain of a link, as computed for the given positions of its ends
+  struct LinkGain
+  {
+    Vector txPosition;  //!< the position of the transmitter
+    Vector rxPosition;  //!< the position of the receiver
+    double gain;        //!< the linear gain of the link
+    bool inRange;       //!< whether the loss is below MaxLossDb
+  };
+
+  /// An eNB, which is assumed to transmit over its whole bandwidth
+  struct FullLoadTx
+  {
+    Ptr<SpectrumPhy> phy;               //!< the PHY of the eNB
+    Ptr<AntennaModel> antenna;          //!< the transmit antenna
+    Ptr<const SpectrumValue> psd;       //!< the PSD of its control frames
+    Vector position;                    //!< the position of the eNB
+    uint16_t cellId;                    //!< the cell ID
+  };
+
+  /// A receiver, with the interference it last got from the other cells
+  struct RxInfo
+  {
+    Ptr<SpectrumPhy> phy;                    //!< the receiver
+    Ptr<LteSpectrumPhy> ltePhy;              //!< the receiver, if an LTE PHY
+    Ptr<const SpectrumValue> interference;   //!< the interference, if any
+    SpectrumModelUid_t interferenceModel;    //!< the model it was computed for
+    Vector interferencePosition;             //!< the position it was computed at
+    uint32_t interferenceEpoch;              //!< the m_fullLoadEpoch it was computed at
+    uint16_t interferenceCellId;             //!< the cell it was computed for
+    bool interferenceValid;                  //!< whether it was computed at all
+  };
+
+  /**
+   * Record the PSD and position of the eNB sending a control frame.
+   *
+   * \param params the control frame
+   * \param cellId the cell of the eNB
+   * \param txMobility the mobility model of the eNB, if any
+   */
+  void UpdateFullLoadTx (Ptr<SpectrumSignalParameters> params, uint16_t cellId,
+                         Ptr<MobilityModel> txMobility);
+
+  /**
+   * \param psd a transmitted PSD
+   * \param rxModel the spectrum model of the receiver
+   * \return the PSD converted to the model of the receiver, or zero if the
+   *         two models are orthogonal
+   */
+  Ptr<const SpectrumValue> Convert (Ptr<const SpectrumValue> psd,
+                                    Ptr<const SpectrumModel> rxModel);
+
+  /**
+   * Get the gain of a link, computing it again if one of its ends moved.
+   *
+   * \param txPhy the transmitter
+   * \param txAntenna the transmit antenna, if any
+   * \param txMobility the mobility model of the transmitter
+   * \param rxPhy the receiver
+   * \param rxMobility the mobility model of the receiver
+   * \return the gain of the link
+   */
+  const LinkGain & GetLinkGain (Ptr<SpectrumPhy> txPhy, Ptr<AntennaModel> txAntenna,
+                                Ptr<MobilityModel> txMobility,
+                                Ptr<SpectrumPhy> rxPhy, Ptr<MobilityModel> rxMobility);
+
+  /**
+   * Get the interference received by a UE from the cells other than its
+   * serving cell, computing it again if needed.
+   *
+   * \param rx the receiver
+   * \param cellId the serving cell of the receiver
+   * \param rxModel the spectrum model of the receiver
+   * \param rxMobility the mobility model of the receiver
+   * \return the interference, or zero if there is none
+   */
+  Ptr<const SpectrumValue> GetInterference (RxInfo &rx, uint16_t cellId,
+                                            Ptr<const SpectrumModel> rxModel,
+                                            Ptr<MobilityModel> rxMobility);
+
+  /**
+   * Deliver a signal to a receiver after the given delay.
+   *
+   * \param params the signal parameters
+   * \param receiver the receiver
+   * \param delay the propagation delay
+   */
+  void ScheduleRx (Ptr<SpectrumSignalParameters> params, Ptr<SpectrumPhy> receiver, Time delay);
+
+  /**
+   * Add a signal to the interference a receiver gets from the other cells
+   * during the current time step, to be delivered by DeliverInterference.
+   *
+   * \param rxIndex the index of the receiver in m_rxs
+   * \param psd the received PSD, which is not copied
+   * \param duration the duration of the signal
+   */
+  void AddInterference (std::size_t rxIndex, Ptr<SpectrumValue> psd, Time duration);
+
+  /**
+   * Deliver the interference summed by AddInterference.
+   */
+  void DeliverInterference (void);
+
+  /**
+   * Used internally to reschedule transmission after the propagation delay.
+   *
+   * \param params The signal parameters.
+   * \param receiver A pointer to the receiver SpectrumPhy.
+   */
+  void StartRx (Ptr<SpectrumSignalParameters> params, Ptr<SpectrumPhy> receiver);
+
+  /// Container: (transmitter, receiver), gain of the link
+  typedef std::map<std::pair<const SpectrumPhy *, const SpectrumPhy *>, LinkGain> LinkGainMap_t;
+  /// Container: (TX model, RX model), converter between them
+  typedef std::map<std::pair<SpectrumModelUid_t, SpectrumModelUid_t>, SpectrumConverter> ConverterMap_t;
+
+  std::vector<RxInfo> m_rxs;                                  //!< the receivers
+  std::map<const SpectrumPhy *, FullLoadTx> m_fullLoadTxs;    //!< the eNBs
+  /// Incremented whenever an eNB is added, moves or changes its PSD
+  uint32_t m_fullLoadEpoch;
+  bool m_cacheLinkGains;                                      //!< whether the link gains are cached
+  LinkGainMap_t m_linkGains;                                  //!< the gains of the links
+  ConverterMap_t m_converters;                                //!< the spectrum converters
+  /// The pairs of orthogonal (TX model, RX model)
+  std::set<std::pair<SpectrumModelUid_t, SpectrumModelUid_t> > m_orthogonalModels;
+  /// Container: (receiver index, duration), interference to be delivered
+  typedef std::map<std::pair<std::size_t, Time>, Ptr<SpectrumValue> > PendingInterferenceMap_t;
+  PendingInterferenceMap_t m_pendingInterference;             //!< the interference to be delivered
+  EventId m_deliverInterferenceEvent;                         //!< the DeliverInterference event
+};
+
+} // namespace ns3
+
+#endif /* LTE_ABSTRACT_SPECTRUM_CHANNEL_H */
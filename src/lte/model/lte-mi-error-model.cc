@@ -335,79 +335,63 @@ double
 LteMiErrorModel::Mib (const SpectrumValue& sinr, const std::vector<int>& map, uint8_t mcs)
 {
   NS_LOG_FUNCTION (sinr << &map << (uint32_t) mcs);
-  
+
+  // select the MI map of the modulation of the given MCS once for all the RBs.
+  // Since the values in the axis of each MI map are uniformly spaced, we have
+  // index = ((sinrLin - value[0]) / (value[SIZE-1] - value[0])) * (SIZE-1)
+  // the scaling coefficient is always the same, so we use a static const
+  // to speed up the calculation
+  const double* miMap;
+  const double* miMapAxis;
+  uint16_t miMapSize;
+  double scalingCoeff;
+  if (mcs <= MI_QPSK_MAX_ID) // QPSK
+    {
+      static const double scalingCoeffQpsk = 
+        (MI_MAP_QPSK_SIZE - 1) / (MI_map_qpsk_axis[MI_MAP_QPSK_SIZE-1] - MI_map_qpsk_axis[0]);
+      miMap = MI_map_qpsk;
+      miMapAxis = MI_map_qpsk_axis;
+      miMapSize = MI_MAP_QPSK_SIZE;
+      scalingCoeff = scalingCoeffQpsk;
+    }
+  else if (mcs <= MI_16QAM_MAX_ID) // 16-QAM
+    {
+      static const double scalingCoeff16qam = 
+        (MI_MAP_16QAM_SIZE - 1) / (MI_map_16qam_axis[MI_MAP_16QAM_SIZE-1] - MI_map_16qam_axis[0]);
+      miMap = MI_map_16qam;
+      miMapAxis = MI_map_16qam_axis;
+      miMapSize = MI_MAP_16QAM_SIZE;
+      scalingCoeff = scalingCoeff16qam;
+    }
+  else // 64-QAM
+    {
+      static const double scalingCoeff64qam = 
+        (MI_MAP_64QAM_SIZE - 1) / (MI_map_64qam_axis[MI_MAP_64QAM_SIZE-1] - MI_map_64qam_axis[0]);
+      miMap = MI_map_64qam;
+      miMapAxis = MI_map_64qam_axis;
+      miMapSize = MI_MAP_64QAM_SIZE;
+      scalingCoeff = scalingCoeff64qam;
+    }
+  const double sinrMax = miMapAxis[miMapSize - 1];
+  const double sinrMin = miMapAxis[0];
+
   double MI;
   double MIsum = 0.0;
-  SpectrumValue sinrCopy = sinr;
-  
-  for (uint32_t i = 0; i < map.size (); i++)
+  for (std::vector<int>::const_iterator it = map.begin (); it != map.end (); it++)
     {
-      double sinrLin = sinrCopy[map.at (i)];
-      if (mcs <= MI_QPSK_MAX_ID) // QPSK
+      double sinrLin = sinr[*it];
+      if (sinrLin > sinrMax)
         {
-
-          if (sinrLin > MI_map_qpsk_axis[MI_MAP_QPSK_SIZE-1])
-            {
-              MI = 1;
-            }
-          else 
-            { 
-              // since the values in MI_map_qpsk_axis are uniformly spaced, we have
-              // index = ((sinrLin - value[0]) / (value[SIZE-1] - value[0])) * (SIZE-1)
-              // the scaling coefficient is always the same, so we use a static const
-              // to speed up the calculation
-              static const double scalingCoeffQpsk = 
-                (MI_MAP_QPSK_SIZE - 1) / (MI_map_qpsk_axis[MI_MAP_QPSK_SIZE-1] - MI_map_qpsk_axis[0]);
-              double sinrIndexDouble = (sinrLin -  MI_map_qpsk_axis[0]) * scalingCoeffQpsk + 1;
-              uint32_t sinrIndex = std::max(0.0, std::floor (sinrIndexDouble));
-              NS_ASSERT_MSG (sinrIndex < MI_MAP_QPSK_SIZE, "MI map out of data");
-              MI = MI_map_qpsk[sinrIndex];
-            }
+          MI = 1;
         }
       else
         {
-          if (mcs > MI_QPSK_MAX_ID && mcs <= MI_16QAM_MAX_ID )	// 16-QAM
-            {
-              if (sinrLin > MI_map_16qam_axis[MI_MAP_16QAM_SIZE-1])
-                {
-                  MI = 1;
-                }
-              else 
-                {
-                  // since the values in MI_map_16QAM_axis are uniformly spaced, we have
-                  // index = ((sinrLin - value[0]) / (value[SIZE-1] - value[0])) * (SIZE-1)
-                  // the scaling coefficient is always the same, so we use a static const
-                  // to speed up the calculation
-                  static const double scalingCoeff16qam = 
-                    (MI_MAP_16QAM_SIZE - 1) / (MI_map_16qam_axis[MI_MAP_16QAM_SIZE-1] - MI_map_16qam_axis[0]);
-                  double sinrIndexDouble = (sinrLin -  MI_map_16qam_axis[0]) * scalingCoeff16qam + 1;
-                  uint32_t sinrIndex = std::max(0.0, std::floor (sinrIndexDouble));
-                  NS_ASSERT_MSG (sinrIndex < MI_MAP_16QAM_SIZE, "MI map out of data");
-                  MI = MI_map_16qam[sinrIndex];
-                }
-            }
-          else // 64-QAM
-            {
-              if (sinrLin > MI_map_64qam_axis[MI_MAP_64QAM_SIZE-1])
-                {
-                  MI = 1;
-                }
-              else
-                {
-                  // since the values in MI_map_64QAM_axis are uniformly spaced, we have
-                  // index = ((sinrLin - value[0]) / (value[SIZE-1] - value[0])) * (SIZE-1)
-                  // the scaling coefficient is always the same, so we use a static const
-                  // to speed up the calculation
-                  static const double scalingCoeff64qam = 
-                    (MI_MAP_64QAM_SIZE - 1) / (MI_map_64qam_axis[MI_MAP_64QAM_SIZE-1] - MI_map_64qam_axis[0]);
-                  double sinrIndexDouble = (sinrLin -  MI_map_64qam_axis[0]) * scalingCoeff64qam + 1;
-                  uint32_t sinrIndex = std::max(0.0, std::floor (sinrIndexDouble));
-                  NS_ASSERT_MSG (sinrIndex < MI_MAP_64QAM_SIZE, "MI map out of data");
-                  MI = MI_map_64qam[sinrIndex];
-                }
-            }
+          double sinrIndexDouble = (sinrLin - sinrMin) * scalingCoeff + 1;
+          uint32_t sinrIndex = std::max (0.0, std::floor (sinrIndexDouble));
+          NS_ASSERT_MSG (sinrIndex < miMapSize, "MI map out of data");
+          MI = miMap[sinrIndex];
         }
-      NS_LOG_LOGIC (" RB " << map.at (i) << "Minimum SNR = " << 10 * std::log10 (sinrLin) << " dB, " << sinrLin << " V, MCS = " << (uint16_t)mcs << ", MI = " << MI);
+      NS_LOG_LOGIC (" RB " << *it << "Minimum SNR = " << 10 * std::log10 (sinrLin) << " dB, " << sinrLin << " V, MCS = " << (uint16_t)mcs << ", MI = " << MI);
       MIsum += MI;
     }
   MI = MIsum / map.size ();
@@ -416,12 +400,78 @@ LteMiErrorModel::Mib (const SpectrumValue& sinr, const std::vector<int>& map, ui
 }
 
 
+namespace {
+
+/// The parameters of a BLER curve
+struct BlerCurve
+{
+  double b;        ///< mean of the curve
+  double cSqrt2;   ///< standard deviation of the curve, times sqrt (2)
+};
+
+/**
+ * \brief Table of the BLER curve to use for each CB size and ECR
+ *
+ * The curves missing in bEcrTable and cEcrTable (negative values) are replaced
+ * once for all by those of the lowest larger CB size, instead of searching for
+ * them for each code block.
+ */
+class BlerCurveTable
+{
+public:
+  BlerCurveTable ()
+  {
+    for (int cbIndex = 0; cbIndex < 9; cbIndex++)
+      {
+        for (int ecrId = 0; ecrId <= MI_64QAM_BLER_MAX_ID; ecrId++)
+          {
+            double b = bEcrTable[cbIndex][ecrId];
+            if (b < 0.0)
+              {
+                //take the lowest CB size including this CB for removing CB size
+                //quatization errors
+                int i = cbIndex;
+                while ((i < 9) && (b < 0))
+                  {
+                    b = bEcrTable[i++][ecrId];
+                  }
+              }
+            double c = cEcrTable[cbIndex][ecrId];
+            if (c < 0.0)
+              {
+                int i = cbIndex;
+                while ((i < 9) && (c < 0))
+                  {
+                    c = cEcrTable[i++][ecrId];
+                  }
+              }
+            m_curves[cbIndex][ecrId].b = b;
+            m_curves[cbIndex][ecrId].cSqrt2 = sqrt (2) * c;
+          }
+      }
+  }
+
+  /**
+   * \param cbIndex the index of the CB size in cbMiSizeTable
+   * \param ecrId the ECR ID
+   * \return the BLER curve
+   */
+  const BlerCurve& Get (int cbIndex, uint8_t ecrId) const
+  {
+    return m_curves[cbIndex][ecrId];
+  }
+
+private:
+  BlerCurve m_curves[9][MI_64QAM_BLER_MAX_ID + 1]; ///< the curves
+};
+
+} // anonymous namespace
+
 double 
 LteMiErrorModel::MappingMiBler (double mib, uint8_t ecrId, uint16_t cbSize)
 {
   NS_LOG_FUNCTION (mib << (uint32_t) ecrId << (uint32_t) cbSize);
-  double b = 0;
-  double c = 0;
+  static const BlerCurveTable curves;
 
   NS_ASSERT_MSG (ecrId <= MI_64QAM_BLER_MAX_ID, "ECR out of range [0..37]: " << (uint16_t) ecrId);
   int cbIndex = 1;
@@ -432,31 +482,10 @@ LteMiErrorModel::MappingMiBler (double mib, uint8_t ecrId, uint16_t cbSize)
   cbIndex--;
   NS_LOG_LOGIC (" ECRid " << (uint16_t)ecrId << " ECR " << BlerCurvesEcrMap[ecrId] << " CB size " << cbSize << " CB size curve " << cbMiSizeTable[cbIndex]);
 
-  b = bEcrTable[cbIndex][ecrId];
-  if (b<0.0)
-    {
-      //take the lowest CB size including this CB for removing CB size
-      //quatization errors
-      int i = cbIndex;
-      while ((i<9)&&(b<0))
-        {
-          b = bEcrTable[i++][ecrId];
-        }
-    }
-  c = cEcrTable[cbIndex][ecrId];
-  if (c<0.0)
-    {
-      //take the lowest CB size including this CB for removing CB size
-      //quatization errors
-      int i = cbIndex;
-      while ((i<9)&&(c<0))
-        {
-          c = cEcrTable[i++][ecrId];
-        }
-    }
+  const BlerCurve& curve = curves.Get (cbIndex, ecrId);
   // see IEEE802.16m EMD formula 55 of section 4.3.2.1
-  double bler = 0.5*( 1 - erf((mib-b)/(sqrt(2)*c)) );
-  NS_LOG_LOGIC ("MIB: " << mib << " BLER:" << bler << " b:" << b << " c:" << c);
+  double bler = 0.5*( 1 - erf((mib-curve.b)/curve.cSqrt2) );
+  NS_LOG_LOGIC ("MIB: " << mib << " BLER:" << bler << " b:" << curve.b << " c:" << curve.cSqrt2 / sqrt (2));
   return bler;
 }
 
@@ -554,7 +583,7 @@ LteMiErrorModel::GetPcfichPdcchError (const SpectrumValue& sinr)
 
 
 TbStats_t
-LteMiErrorModel::GetTbDecodificationStats (const SpectrumValue& sinr, const std::vector<int>& map, uint16_t size, uint8_t mcs, HarqProcessInfoList_t miHistory)
+LteMiErrorModel::GetTbDecodificationStats (const SpectrumValue& sinr, const std::vector<int>& map, uint16_t size, uint8_t mcs, const HarqProcessInfoList_t& miHistory)
 {
   NS_LOG_FUNCTION (sinr << &map << (uint32_t) size << (uint32_t) mcs);
 
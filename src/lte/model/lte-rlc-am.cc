@@ -141,7 +141,7 @@ LteRlcAm::DoDispose ()
   m_retxBufferSize = 0;
   m_rxonBuffer.clear ();
   m_sdusBuffer.clear ();
-  m_keepS0 = 0;
+  m_keepS0.Clear ();
   m_controlPduBuffer = 0;
 
   LteRlc::DoDispose ();
@@ -419,7 +419,7 @@ LteRlcAm::DoNotifyTxOpportunity (LteMacSapUser::TxOpportunityParameters txOpPara
   //
   //
 
-  Ptr<Packet> packet = Create<Packet> ();
+  Ptr<Packet> packet;
   LteRlcAmHeader rlcAmHeader;
   rlcAmHeader.SetDataPdu ();
 
@@ -647,14 +647,6 @@ LteRlcAm::DoNotifyTxOpportunity (LteMacSapUser::TxOpportunityParameters txOpPara
 
       NS_ASSERT_MSG ((*it)->PeekPacketTag (tag), "LteRlcSduStatusTag is missing");
       (*it)->RemovePacketTag (tag);
-      if (packet->GetSize () > 0)
-        {
-          packet->AddAtEnd (*it);
-        }
-      else
-        {
-          packet = (*it);
-        }
       it++;
     }
 
@@ -673,6 +665,9 @@ LteRlcAm::DoNotifyTxOpportunity (LteMacSapUser::TxOpportunityParameters txOpPara
   // Set the FramingInfo flag after the calculation
   rlcAmHeader.SetFramingInfo (framingInfo);
 
+  // Concatenate the SDUs and segments of the Data field
+  packet = LteRlcSegmentList::Concatenate (dataField);
+
 
   // Calculate the Polling Bit (5.2.2.1)
   rlcAmHeader.SetPollingBit (LteRlcAmHeader::STATUS_REPORT_NOT_REQUESTED);
@@ -1254,7 +1249,7 @@ LteRlcAm::ReassembleAndDeliver (Ptr<Packet> packet)
                               /**
                               * Keep S0
                               */
-                              m_keepS0 = m_sdusBuffer.front ();
+                              m_keepS0.Start (m_sdusBuffer.front ());
                               m_sdusBuffer.pop_front ();
                       break;
 
@@ -1278,9 +1273,9 @@ LteRlcAm::ReassembleAndDeliver (Ptr<Packet> packet)
                               /**
                               * Deliver (Kept)S0 + SN
                               */
-                              m_keepS0->AddAtEnd (m_sdusBuffer.front ());
+                              m_keepS0.Append (m_sdusBuffer.front ());
                               m_sdusBuffer.pop_front ();
-                              m_rlcSapUser->ReceivePdcpPdu (m_keepS0);
+                              m_rlcSapUser->ReceivePdcpPdu (m_keepS0.Assemble ());
 
                               /**
                                 * Deliver zero, one or multiple PDUs
@@ -1300,7 +1295,7 @@ LteRlcAm::ReassembleAndDeliver (Ptr<Packet> packet)
                               */
                               if ( m_sdusBuffer.size () == 1 )
                                 {
-                                  m_keepS0->AddAtEnd (m_sdusBuffer.front ());
+                                  m_keepS0.Append (m_sdusBuffer.front ());
                                   m_sdusBuffer.pop_front ();
                                 }
                               else // m_sdusBuffer.size () > 1
@@ -1308,9 +1303,9 @@ LteRlcAm::ReassembleAndDeliver (Ptr<Packet> packet)
                                   /**
                                   * Deliver (Kept)S0 + SN
                                   */
-                                  m_keepS0->AddAtEnd (m_sdusBuffer.front ());
+                                  m_keepS0.Append (m_sdusBuffer.front ());
                                   m_sdusBuffer.pop_front ();
-                                  m_rlcSapUser->ReceivePdcpPdu (m_keepS0);
+                                  m_rlcSapUser->ReceivePdcpPdu (m_keepS0.Assemble ());
 
                                   /**
                                   * Deliver zero, one or multiple PDUs
@@ -1324,7 +1319,7 @@ LteRlcAm::ReassembleAndDeliver (Ptr<Packet> packet)
                                   /**
                                   * Keep S0
                                   */
-                                  m_keepS0 = m_sdusBuffer.front ();
+                                  m_keepS0.Start (m_sdusBuffer.front ());
                                   m_sdusBuffer.pop_front ();
                                 }
                       break;
@@ -1380,7 +1375,7 @@ LteRlcAm::ReassembleAndDeliver (Ptr<Packet> packet)
                               /**
                                * Keep S0
                                */
-                              m_keepS0 = m_sdusBuffer.front ();
+                              m_keepS0.Start (m_sdusBuffer.front ());
                               m_sdusBuffer.pop_front ();
                       break;
 
@@ -1431,7 +1426,7 @@ LteRlcAm::ReassembleAndDeliver (Ptr<Packet> packet)
                                   /**
                                   * Keep S0
                                   */
-                                  m_keepS0 = m_sdusBuffer.front ();
+                                  m_keepS0.Start (m_sdusBuffer.front ());
                                   m_sdusBuffer.pop_front ();
                                 }
                       break;
@@ -1454,7 +1449,7 @@ LteRlcAm::ReassembleAndDeliver (Ptr<Packet> packet)
                               /**
                                * Discard S0
                                */
-                              m_keepS0 = 0;
+                              m_keepS0.Clear ();
 
                               /**
                                * Deliver one or multiple PDUs
@@ -1472,7 +1467,7 @@ LteRlcAm::ReassembleAndDeliver (Ptr<Packet> packet)
                               /**
                                * Discard S0
                                */
-                              m_keepS0 = 0;
+                              m_keepS0.Clear ();
 
                               /**
                                * Deliver zero, one or multiple PDUs
@@ -1486,7 +1481,7 @@ LteRlcAm::ReassembleAndDeliver (Ptr<Packet> packet)
                               /**
                                * Keep S0
                                */
-                              m_keepS0 = m_sdusBuffer.front ();
+                              m_keepS0.Start (m_sdusBuffer.front ());
                               m_sdusBuffer.pop_front ();
 
                       break;
@@ -1497,7 +1492,7 @@ LteRlcAm::ReassembleAndDeliver (Ptr<Packet> packet)
                               /**
                                * Discard S0
                                */
-                              m_keepS0 = 0;
+                              m_keepS0.Clear ();
 
                               /**
                                * Discard SI or SN
@@ -1527,7 +1522,7 @@ LteRlcAm::ReassembleAndDeliver (Ptr<Packet> packet)
                               /**
                                * Discard S0
                                */
-                              m_keepS0 = 0;
+                              m_keepS0.Clear ();
 
                               /**
                                * Discard SI or SN
@@ -1548,7 +1543,7 @@ LteRlcAm::ReassembleAndDeliver (Ptr<Packet> packet)
                                   /**
                                    * Keep S0
                                    */
-                                  m_keepS0 = m_sdusBuffer.front ();
+                                  m_keepS0.Start (m_sdusBuffer.front ());
                                   m_sdusBuffer.pop_front ();
                                 }
                       break;
@@ -24,6 +24,7 @@
 #include <ns3/event-id.h>
 #include <ns3/lte-rlc-sequence-number.h>
 #include <ns3/lte-rlc.h>
+#include <ns3/lte-rlc-segment-list.h>
 
 #include <vector>
 #include <map>
@@ -224,7 +225,7 @@ private:
                  WAITING_S0_FULL = 1,
                  WAITING_SI_SF   = 2 } ReassemblingState_t;
   ReassemblingState_t m_reassemblingState; ///< reassembling state
-  Ptr<Packet> m_keepS0; ///< keep S0
+  LteRlcSegmentList m_keepS0; ///< keep S0 and the segments following it
 
   /**
    * Expected Sequence Number
@@ -0,0 +1,81 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2021
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/log.h"
+#include "lte-rlc-segment-list.h"
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("LteRlcSegmentList");
+
+void
+LteRlcSegmentList::Start (Ptr<Packet> segment)
+{
+  NS_LOG_FUNCTION (this << segment);
+  m_segments.clear ();
+  m_segments.push_back (segment);
+}
+
+void
+LteRlcSegmentList::Append (Ptr<Packet> segment)
+{
+  NS_LOG_FUNCTION (this << segment);
+  NS_ASSERT_MSG (!m_segments.empty (), "No SDU being reassembled");
+  m_segments.push_back (segment);
+}
+
+void
+LteRlcSegmentList::Clear (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_segments.clear ();
+}
+
+Ptr<Packet>
+LteRlcSegmentList::Assemble (void)
+{
+  NS_LOG_FUNCTION (this << m_segments.size ());
+  NS_ASSERT_MSG (!m_segments.empty (), "No SDU being reassembled");
+  Ptr<Packet> sdu = Concatenate (m_segments);
+  m_segments.clear ();
+  return sdu;
+}
+
+Ptr<Packet>
+LteRlcSegmentList::Concatenate (std::vector<Ptr<Packet> > &packets)
+{
+  NS_ASSERT (!packets.empty ());
+  // Merge the packets two by two, so that every byte is copied once per
+  // round and there are log2 (n) rounds
+  while (packets.size () > 1)
+    {
+      std::size_t n = 0;
+      for (std::size_t i = 0; i < packets.size (); i += 2)
+        {
+          if (i + 1 < packets.size ())
+            {
+              packets[i]->AddAtEnd (packets[i + 1]);
+            }
+          packets[n++] = packets[i];
+        }
+      packets.resize (n);
+    }
+  return packets.front ();
+}
+
+} // namespace ns3
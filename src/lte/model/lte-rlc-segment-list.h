@@ -0,0 +1,80 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2021
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef LTE_RLC_SEGMENT_LIST_H
+#define LTE_RLC_SEGMENT_LIST_H
+
+#include "ns3/ptr.h"
+#include "ns3/packet.h"
+#include <vector>
+
+namespace ns3 {
+
+/**
+ * \ingroup lte
+ *
+ * \brief The segments of a RLC SDU being reassembled.
+ *
+ * Appending a segment to a packet copies the bytes of the packet built so
+ * far, hence reassembling a SDU by appending each segment to the first one
+ * costs a time quadratic in the number of segments. This list instead keeps
+ * the segments, which share the buffers of the received PDUs, until the SDU
+ * is complete, and concatenates them once. A SDU that is discarded before
+ * completion is never concatenated.
+ */
+class LteRlcSegmentList
+{
+public:
+  /**
+   * Start a new SDU, discarding the segments of the current SDU, if any.
+   *
+   * \param segment the first segment of the SDU
+   */
+  void Start (Ptr<Packet> segment);
+  /**
+   * \param segment the next segment of the SDU
+   */
+  void Append (Ptr<Packet> segment);
+  /**
+   * Discard the segments of the current SDU, if any.
+   */
+  void Clear (void);
+  /**
+   * Concatenate the segments of the current SDU and empty the list.
+   *
+   * \return the SDU made of the segments appended so far
+   */
+  Ptr<Packet> Assemble (void);
+
+  /**
+   * Concatenate packets, copying every byte a number of times logarithmic,
+   * rather than linear, in the number of packets.
+   *
+   * \param packets the (non-empty) list of packets, which is consumed
+   * \return the concatenation of the packets, which is the first packet of
+   *         the list if it holds a single packet
+   */
+  static Ptr<Packet> Concatenate (std::vector<Ptr<Packet> > &packets);
+
+private:
+  std::vector<Ptr<Packet> > m_segments;  //!< the segments of the current SDU
+};
+
+} // namespace ns3
+
+#endif /* LTE_RLC_SEGMENT_LIST_H */
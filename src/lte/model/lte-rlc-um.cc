@@ -135,7 +135,7 @@ LteRlcUm::DoNotifyTxOpportunity (LteMacSapUser::TxOpportunityParameters txOpPara
       return;
     }
 
-  Ptr<Packet> packet = Create<Packet> ();
+  Ptr<Packet> packet;
   LteRlcHeader rlcHeader;
 
   // Build Data field
@@ -352,14 +352,6 @@ LteRlcUm::DoNotifyTxOpportunity (LteMacSapUser::TxOpportunityParameters txOpPara
 
       NS_ASSERT_MSG ((*it)->PeekPacketTag (tag), "LteRlcSduStatusTag is missing");
       (*it)->RemovePacketTag (tag);
-      if (packet->GetSize () > 0)
-        {
-          packet->AddAtEnd (*it);
-        }
-      else
-        {
-          packet = (*it);
-        }
       it++;
     }
 
@@ -377,6 +369,9 @@ LteRlcUm::DoNotifyTxOpportunity (LteMacSapUser::TxOpportunityParameters txOpPara
 
   rlcHeader.SetFramingInfo (framingInfo);
 
+  // Concatenate the SDUs and segments of the Data field
+  packet = LteRlcSegmentList::Concatenate (dataField);
+
   NS_LOG_LOGIC ("RLC header: " << rlcHeader);
   packet->AddHeader (rlcHeader);
 
@@ -696,7 +691,7 @@ LteRlcUm::ReassembleAndDeliver (Ptr<Packet> packet)
                               /**
                               * Keep S0
                               */
-                              m_keepS0 = m_sdusBuffer.front ();
+                              m_keepS0.Start (m_sdusBuffer.front ());
                               m_sdusBuffer.pop_front ();
                       break;
 
@@ -747,7 +742,7 @@ LteRlcUm::ReassembleAndDeliver (Ptr<Packet> packet)
                                   /**
                                    * Keep S0
                                    */
-                                  m_keepS0 = m_sdusBuffer.front ();
+                                  m_keepS0.Start (m_sdusBuffer.front ());
                                   m_sdusBuffer.pop_front ();
                                 }
                       break;
@@ -770,9 +765,9 @@ LteRlcUm::ReassembleAndDeliver (Ptr<Packet> packet)
                               /**
                               * Deliver (Kept)S0 + SN
                               */
-                              m_keepS0->AddAtEnd (m_sdusBuffer.front ());
+                              m_keepS0.Append (m_sdusBuffer.front ());
                               m_sdusBuffer.pop_front ();
-                              m_rlcSapUser->ReceivePdcpPdu (m_keepS0);
+                              m_rlcSapUser->ReceivePdcpPdu (m_keepS0.Assemble ());
 
                               /**
                                 * Deliver zero, one or multiple PDUs
@@ -792,7 +787,7 @@ LteRlcUm::ReassembleAndDeliver (Ptr<Packet> packet)
                               */
                               if ( m_sdusBuffer.size () == 1 )
                                 {
-                                  m_keepS0->AddAtEnd (m_sdusBuffer.front ());
+                                  m_keepS0.Append (m_sdusBuffer.front ());
                                   m_sdusBuffer.pop_front ();
                                 }
                               else // m_sdusBuffer.size () > 1
@@ -800,9 +795,9 @@ LteRlcUm::ReassembleAndDeliver (Ptr<Packet> packet)
                                   /**
                                   * Deliver (Kept)S0 + SN
                                   */
-                                  m_keepS0->AddAtEnd (m_sdusBuffer.front ());
+                                  m_keepS0.Append (m_sdusBuffer.front ());
                                   m_sdusBuffer.pop_front ();
-                                  m_rlcSapUser->ReceivePdcpPdu (m_keepS0);
+                                  m_rlcSapUser->ReceivePdcpPdu (m_keepS0.Assemble ());
 
                                   /**
                                   * Deliver zero, one or multiple PDUs
@@ -816,7 +811,7 @@ LteRlcUm::ReassembleAndDeliver (Ptr<Packet> packet)
                                   /**
                                   * Keep S0
                                   */
-                                  m_keepS0 = m_sdusBuffer.front ();
+                                  m_keepS0.Start (m_sdusBuffer.front ());
                                   m_sdusBuffer.pop_front ();
                                 }
                       break;
@@ -872,7 +867,7 @@ LteRlcUm::ReassembleAndDeliver (Ptr<Packet> packet)
                               /**
                                * Keep S0
                                */
-                              m_keepS0 = m_sdusBuffer.front ();
+                              m_keepS0.Start (m_sdusBuffer.front ());
                               m_sdusBuffer.pop_front ();
                       break;
 
@@ -923,7 +918,7 @@ LteRlcUm::ReassembleAndDeliver (Ptr<Packet> packet)
                                   /**
                                   * Keep S0
                                   */
-                                  m_keepS0 = m_sdusBuffer.front ();
+                                  m_keepS0.Start (m_sdusBuffer.front ());
                                   m_sdusBuffer.pop_front ();
                                 }
                       break;
@@ -946,7 +941,7 @@ LteRlcUm::ReassembleAndDeliver (Ptr<Packet> packet)
                               /**
                                * Discard S0
                                */
-                              m_keepS0 = 0;
+                              m_keepS0.Clear ();
 
                               /**
                                * Deliver one or multiple PDUs
@@ -964,7 +959,7 @@ LteRlcUm::ReassembleAndDeliver (Ptr<Packet> packet)
                               /**
                                * Discard S0
                                */
-                              m_keepS0 = 0;
+                              m_keepS0.Clear ();
 
                               /**
                                * Deliver zero, one or multiple PDUs
@@ -978,7 +973,7 @@ LteRlcUm::ReassembleAndDeliver (Ptr<Packet> packet)
                               /**
                                * Keep S0
                                */
-                              m_keepS0 = m_sdusBuffer.front ();
+                              m_keepS0.Start (m_sdusBuffer.front ());
                               m_sdusBuffer.pop_front ();
 
                       break;
@@ -989,7 +984,7 @@ LteRlcUm::ReassembleAndDeliver (Ptr<Packet> packet)
                               /**
                                * Discard S0
                                */
-                              m_keepS0 = 0;
+                              m_keepS0.Clear ();
 
                               /**
                                * Discard SI or SN
@@ -1019,7 +1014,7 @@ LteRlcUm::ReassembleAndDeliver (Ptr<Packet> packet)
                               /**
                                * Discard S0
                                */
-                              m_keepS0 = 0;
+                              m_keepS0.Clear ();
 
                               /**
                                * Discard SI or SN
@@ -1040,7 +1035,7 @@ LteRlcUm::ReassembleAndDeliver (Ptr<Packet> packet)
                                   /**
                                    * Keep S0
                                    */
-                                  m_keepS0 = m_sdusBuffer.front ();
+                                  m_keepS0.Start (m_sdusBuffer.front ());
                                   m_sdusBuffer.pop_front ();
                                 }
                       break;
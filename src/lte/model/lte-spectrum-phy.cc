@@ -1232,6 +1232,12 @@ LteSpectrumPhy::SetCellId (uint16_t cellId)
   m_cellId = cellId;
 }
 
+uint16_t
+LteSpectrumPhy::GetCellId (void) const
+{
+  return m_cellId;
+}
+
 void
 LteSpectrumPhy::SetComponentCarrierId (uint8_t componentCarrierId)
 {
@@ -333,6 +333,11 @@ public:
    */
   void SetCellId (uint16_t cellId);
 
+  /**
+   * \return the Cell Identifier of the cell this PHY is synchronized with
+   */
+  uint16_t GetCellId (void) const;
+
   /**
    *
    * \param componentCarrierId the component carrier id
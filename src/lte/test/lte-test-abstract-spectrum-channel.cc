@@ -0,0 +1,230 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2021
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/test.h"
+#include "ns3/simulator.h"
+#include "ns3/log.h"
+#include "ns3/string.h"
+#include "ns3/boolean.h"
+#include "ns3/mobility-helper.h"
+#include "ns3/lte-helper.h"
+#include "ns3/lte-ue-phy.h"
+#include "ns3/lte-ue-net-device.h"
+#include "ns3/lte-enb-net-device.h"
+#include "ns3/lte-spectrum-phy.h"
+#include "ns3/lte-chunk-processor.h"
+#include "ns3/lte-global-pathloss-database.h"
+#include <vector>
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE ("LteTestAbstractSpectrumChannel");
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Test case checking that the DL SINR of two UEs, each one served by
+ * a fully loaded eNB and interfered by the other one, and the UL SINR of
+ * the eNBs, are the same with a LteAbstractSpectrumChannel as with a
+ * MultiModelSpectrumChannel.
+ *
+ * The topology is the same as for the lte-interference test suite:
+ *
+ *         d2
+ *  UE1-----------eNB2
+ *   |             |
+ * d1|             |d1
+ *   |     d2      |
+ *  eNB1----------UE2
+ */
+class LteAbstractSpectrumChannelTestCase : public TestCase
+{
+public:
+  /**
+   * Constructor
+   *
+   * \param d1 distance between a UE and its serving eNB
+   * \param d2 distance between a UE and the interfering eNB
+   * \param dlSinr the expected DL SINR (linear)
+   * \param ulSinr the expected UL SINR (linear)
+   */
+  LteAbstractSpectrumChannelTestCase (double d1, double d2, double dlSinr, double ulSinr);
+  virtual ~LteAbstractSpectrumChannelTestCase ();
+
+private:
+  virtual void DoRun (void);
+  /**
+   * Run the scenario.
+   *
+   * \param channelType the type of the spectrum channels
+   * \param pathloss the DL pathloss database to fill
+   * \return the DL SINR of UE1 and UE2, and the UL SINR of eNB1 and eNB2, in dB
+   */
+  std::vector<double> RunScenario (std::string channelType,
+                                   DownlinkLteGlobalPathlossDatabase *pathloss);
+  /**
+   * Check the SINR obtained with a channel type.
+   *
+   * \param sinrDb the DL and UL SINR returned by RunScenario
+   * \param channelType the type of the spectrum channels
+   */
+  void CheckSinr (const std::vector<double> &sinrDb, std::string channelType);
+
+  double m_d1;                //!< distance between a UE and its serving eNB
+  double m_d2;                //!< distance between a UE and the interfering eNB
+  double m_expectedDlSinrDb;  //!< the expected DL SINR in dB
+  double m_expectedUlSinrDb;  //!< the expected UL SINR in dB
+};
+
+LteAbstractSpectrumChannelTestCase::LteAbstractSpectrumChannelTestCase (double d1, double d2, double dlSinr, double ulSinr)
+  : TestCase ("d1=" + std::to_string (d1) + ", d2=" + std::to_string (d2)),
+    m_d1 (d1),
+    m_d2 (d2),
+    m_expectedDlSinrDb (10 * std::log10 (dlSinr)),
+    m_expectedUlSinrDb (10 * std::log10 (ulSinr))
+{
+}
+
+LteAbstractSpectrumChannelTestCase::~LteAbstractSpectrumChannelTestCase ()
+{
+}
+
+std::vector<double>
+LteAbstractSpectrumChannelTestCase::RunScenario (std::string channelType,
+                                                 DownlinkLteGlobalPathlossDatabase *pathloss)
+{
+  Ptr<LteHelper> lteHelper = CreateObject<LteHelper> ();
+  lteHelper->SetSpectrumChannelType (channelType);
+  lteHelper->SetAttribute ("PathlossModel", StringValue ("ns3::FriisPropagationLossModel"));
+  lteHelper->SetAttribute ("UseIdealRrc", BooleanValue (false));
+
+  NodeContainer enbNodes;
+  NodeContainer ueNodes;
+  enbNodes.Create (2);
+  ueNodes.Create (2);
+  Ptr<ListPositionAllocator> positionAlloc = CreateObject<ListPositionAllocator> ();
+  positionAlloc->Add (Vector (0.0, 0.0, 0.0));   // eNB1
+  positionAlloc->Add (Vector (m_d2, m_d1, 0.0)); // eNB2
+  positionAlloc->Add (Vector (0.0, m_d1, 0.0));  // UE1
+  positionAlloc->Add (Vector (m_d2, 0.0, 0.0));  // UE2
+  MobilityHelper mobility;
+  mobility.SetMobilityModel ("ns3::ConstantPositionMobilityModel");
+  mobility.SetPositionAllocator (positionAlloc);
+  mobility.Install (NodeContainer (enbNodes, ueNodes));
+
+  NetDeviceContainer enbDevs = lteHelper->InstallEnbDevice (enbNodes);
+  NetDeviceContainer ueDevs = lteHelper->InstallUeDevice (ueNodes);
+  lteHelper->Attach (ueDevs.Get (0), enbDevs.Get (0));
+  lteHelper->Attach (ueDevs.Get (1), enbDevs.Get (1));
+  EpsBearer bearer (EpsBearer::GBR_CONV_VOICE);
+  lteHelper->ActivateDataRadioBearer (ueDevs, bearer);
+
+  // DL SINR of UE1 and UE2, then UL SINR of eNB1 and eNB2
+  LteSpectrumValueCatcher sinrCatcher[4];
+  for (uint32_t i = 0; i < 2; i++)
+    {
+      Ptr<LtePhy> uePhy = ueDevs.Get (i)->GetObject<LteUeNetDevice> ()->GetPhy ()->GetObject<LtePhy> ();
+      Ptr<LteChunkProcessor> testDlSinr = Create<LteChunkProcessor> ();
+      testDlSinr->AddCallback (MakeCallback (&LteSpectrumValueCatcher::ReportValue, &sinrCatcher[i]));
+      uePhy->GetDownlinkSpectrumPhy ()->AddDataSinrChunkProcessor (testDlSinr);
+
+      Ptr<LtePhy> enbPhy = enbDevs.Get (i)->GetObject<LteEnbNetDevice> ()->GetPhy ()->GetObject<LtePhy> ();
+      Ptr<LteChunkProcessor> testUlSinr = Create<LteChunkProcessor> ();
+      testUlSinr->AddCallback (MakeCallback (&LteSpectrumValueCatcher::ReportValue, &sinrCatcher[2 + i]));
+      enbPhy->GetUplinkSpectrumPhy ()->AddDataSinrChunkProcessor (testUlSinr);
+    }
+  lteHelper->GetDownlinkSpectrumChannel ()->TraceConnect ("PathLoss", "", MakeCallback (&LteGlobalPathlossDatabase::UpdatePathloss, pathloss));
+
+  Simulator::Stop (Seconds (0.100));
+  Simulator::Run ();
+  std::vector<double> sinrDb;
+  for (uint32_t i = 0; i < 4; i++)
+    {
+      NS_TEST_EXPECT_MSG_NE (sinrCatcher[i].GetValue (), 0, "No data received by receiver " << i << " with " << channelType);
+      sinrDb.push_back (sinrCatcher[i].GetValue () ? 10.0 * std::log10 (sinrCatcher[i].GetValue ()->operator[] (0)) : 0.0);
+    }
+  Simulator::Destroy ();
+  return sinrDb;
+}
+
+void
+LteAbstractSpectrumChannelTestCase::CheckSinr (const std::vector<double> &sinrDb, std::string channelType)
+{
+  NS_TEST_ASSERT_MSG_EQ_TOL (sinrDb[0], m_expectedDlSinrDb, 0.01, "Wrong SINR in DL with " << channelType << " (eNB1 --> UE1)");
+  NS_TEST_ASSERT_MSG_EQ_TOL (sinrDb[1], m_expectedDlSinrDb, 0.01, "Wrong SINR in DL with " << channelType << " (eNB2 --> UE2)");
+  NS_TEST_ASSERT_MSG_EQ_TOL (sinrDb[2], m_expectedUlSinrDb, 0.01, "Wrong SINR in UL with " << channelType << " (UE1 --> eNB1)");
+  NS_TEST_ASSERT_MSG_EQ_TOL (sinrDb[3], m_expectedUlSinrDb, 0.01, "Wrong SINR in UL with " << channelType << " (UE2 --> eNB2)");
+}
+
+void
+LteAbstractSpectrumChannelTestCase::DoRun (void)
+{
+  Config::SetDefault ("ns3::LteSpectrumPhy::CtrlErrorModelEnabled", BooleanValue (false));
+  Config::SetDefault ("ns3::LteSpectrumPhy::DataErrorModelEnabled", BooleanValue (false));
+  Config::SetDefault ("ns3::LteUePhy::EnableUplinkPowerControl", BooleanValue (false));
+
+  DownlinkLteGlobalPathlossDatabase pathloss;
+  CheckSinr (RunScenario ("ns3::MultiModelSpectrumChannel", &pathloss), "ns3::MultiModelSpectrumChannel");
+
+  DownlinkLteGlobalPathlossDatabase abstractPathloss;
+  CheckSinr (RunScenario ("ns3::LteAbstractSpectrumChannel", &abstractPathloss), "ns3::LteAbstractSpectrumChannel");
+
+  // the same SINR is obtained when the link gains are computed for each signal
+  Config::SetDefault ("ns3::LteAbstractSpectrumChannel::CacheLinkGains", BooleanValue (false));
+  DownlinkLteGlobalPathlossDatabase uncachedPathloss;
+  CheckSinr (RunScenario ("ns3::LteAbstractSpectrumChannel", &uncachedPathloss),
+             "ns3::LteAbstractSpectrumChannel without cached link gains");
+  Config::SetDefault ("ns3::LteAbstractSpectrumChannel::CacheLinkGains", BooleanValue (true));
+
+  // the pathloss of every link is still reported, although the signals of
+  // the interfering eNB are not delivered
+  for (uint16_t cellId = 1; cellId <= 2; cellId++)
+    {
+      for (uint64_t imsi = 1; imsi <= 2; imsi++)
+        {
+          NS_TEST_ASSERT_MSG_EQ_TOL (abstractPathloss.GetPathloss (cellId, imsi),
+                                     pathloss.GetPathloss (cellId, imsi), 1e-9,
+                                     "Wrong pathloss from cell " << cellId << " to IMSI " << imsi);
+        }
+    }
+}
+
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Test suite for the LteAbstractSpectrumChannel class.
+ */
+class LteAbstractSpectrumChannelTestSuite : public TestSuite
+{
+public:
+  LteAbstractSpectrumChannelTestSuite ();
+};
+
+LteAbstractSpectrumChannelTestSuite::LteAbstractSpectrumChannelTestSuite ()
+  : TestSuite ("lte-abstract-spectrum-channel", SYSTEM)
+{
+  // same scenarios and expected values as in the lte-interference test suite
+  AddTestCase (new LteAbstractSpectrumChannelTestCase (50.0, 50.0, 0.999997, 0.999907), TestCase::QUICK);
+  AddTestCase (new LteAbstractSpectrumChannelTestCase (50.0, 200.0, 15.999282, 15.976339), TestCase::QUICK);
+  AddTestCase (new LteAbstractSpectrumChannelTestCase (3000.0, 6000.0, 3.844681, 1.714583), TestCase::QUICK);
+}
+
+static LteAbstractSpectrumChannelTestSuite g_lteAbstractSpectrumChannelTestSuite; ///< the test suite
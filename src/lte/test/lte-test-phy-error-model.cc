@@ -50,6 +50,8 @@
 #include <ns3/unused.h>
 #include <ns3/ff-mac-scheduler.h>
 #include <ns3/buildings-helper.h>
+#include <ns3/lte-mi-error-model.h>
+#include <ns3/lte-spectrum-value-helper.h>
 
 #include "lte-test-phy-error-model.h"
 
@@ -61,7 +63,8 @@ LenaTestPhyErrorModelSuite::LenaTestPhyErrorModelSuite ()
   : TestSuite ("lte-phy-error-model", SYSTEM)
 {
   NS_LOG_INFO ("creating LenaTestPhyErrorModelTestCase");
-  
+
+  AddTestCase (new LteMiErrorModelTestCase (), TestCase::QUICK);
   
   for (uint32_t rngRun = 1; rngRun <= 3; ++rngRun)
     {
@@ -441,3 +444,73 @@ LenaDlCtrlPhyErrorModelTestCase::DoRun (void)
   
   Simulator::Destroy ();
 }
+
+
+LteMiErrorModelTestCase::LteMiErrorModelTestCase ()
+  : TestCase ("Reference values of the MI error model")
+{
+}
+
+LteMiErrorModelTestCase::~LteMiErrorModelTestCase ()
+{
+}
+
+void
+LteMiErrorModelTestCase::DoRun (void)
+{
+  /// A reference value of the MI error model
+  struct Reference
+  {
+    double sinrScale;  ///< the SINR of the n-th RB is sinrScale * (1 + 0.2 n)
+    uint8_t mcs;       ///< the MCS
+    uint16_t size;     ///< the TB size in bytes
+    double tbler;      ///< the expected BLER of the first transmission
+    double mi;         ///< the expected MI
+    double retxTbler;  ///< the expected BLER of the retransmission
+  };
+
+  static const Reference references[] = {
+    {0.057122000000000013, 0, 5, 0.95943951462748012, 0.11804772222222223, 0.0074047792342161745},
+    {0.074258600000000022, 1, 5, 0.86367808458043838, 0.14908183333333336, 0.50153750522614438},
+    {0.074258600000000022, 2, 20, 0.9423048009076298, 0.14908183333333336, 0.0010778222394152159},
+    {0.096536180000000027, 3, 20, 0.97136810443641841, 0.18718744444444446, 0.012105973994935404},
+    {0.12549703400000004, 3, 5, 0.69536276416361797, 0.23354450000000002, 0.0012410532266001195},
+    {0.78747527713985832, 10, 2000, 0.32754409967152853, 0.39703261111111121, 0},
+    {0.78747527713985832, 11, 1200, 0.44127920473655902, 0.39703261111111121, 0},
+    {1.0237178602818158, 12, 20, 0.31009242503057449, 0.45810294444444444, 0},
+    {1.7300831838762687, 15, 1200, 0.93223250607259145, 0.5882830555555556, 0},
+    {2.9238405807508943, 17, 5, 0.88249614354338801, 0.48689466666666664, 0},
+  };
+
+  Ptr<const SpectrumModel> sm = LteSpectrumValueHelper::GetSpectrumModel (100, 25);
+  std::vector<int> map;
+  for (int rb = 2; rb < 20; rb++)
+    {
+      map.push_back (rb);
+    }
+
+  for (const Reference& ref : references)
+    {
+      SpectrumValue sinr (sm);
+      for (uint32_t rb = 0; rb < 25; rb++)
+        {
+          sinr[rb] = ref.sinrScale * (1 + 0.2 * rb);
+        }
+
+      HarqProcessInfoList_t history;
+      TbStats_t stats = LteMiErrorModel::GetTbDecodificationStats (sinr, map, ref.size, ref.mcs, history);
+      NS_TEST_ASSERT_MSG_EQ_TOL (stats.mi, ref.mi, 1e-12, "Unexpected MI for MCS " << (uint16_t) ref.mcs);
+      NS_TEST_ASSERT_MSG_EQ_TOL (stats.tbler, ref.tbler, 1e-12, "Unexpected BLER for MCS " << (uint16_t) ref.mcs
+                                 << " and TB size " << ref.size);
+
+      HarqProcessInfoElement_t previous;
+      previous.m_mi = 0.3 + 0.02 * ref.mcs;
+      previous.m_rv = 0;
+      previous.m_infoBits = ref.size * 8;
+      previous.m_codeBits = ref.size * 16;
+      history.push_back (previous);
+      stats = LteMiErrorModel::GetTbDecodificationStats (sinr, map, ref.size, ref.mcs, history);
+      NS_TEST_ASSERT_MSG_EQ_TOL (stats.tbler, ref.retxTbler, 1e-12, "Unexpected retransmission BLER for MCS "
+                                 << (uint16_t) ref.mcs << " and TB size " << ref.size);
+    }
+}
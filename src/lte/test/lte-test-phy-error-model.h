@@ -123,6 +123,26 @@ private:
 
 
 
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Check that LteMiErrorModel computes the reference MI and TB BLER
+ * values (for a first transmission and a retransmission) for a set of SINRs,
+ * MCSs and TB sizes.
+ */
+class LteMiErrorModelTestCase : public TestCase
+{
+public:
+  LteMiErrorModelTestCase ();
+  virtual ~LteMiErrorModelTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+
+
 /**
  * \ingroup lte-test
  * \ingroup tests
@@ -0,0 +1,201 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2021
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/test.h"
+#include "ns3/simulator.h"
+#include "ns3/log.h"
+#include "ns3/string.h"
+#include "ns3/double.h"
+#include "ns3/uinteger.h"
+#include "ns3/boolean.h"
+#include "ns3/mobility-helper.h"
+#include "ns3/lte-helper.h"
+#include "ns3/spectrum-channel.h"
+#include "ns3/radio-environment-map-helper.h"
+
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE ("LteTestRadioEnvironmentMap");
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Test case checking that the Radio Environment Map generated with
+ * the DirectEvaluation attribute, by one or more threads, is the same as
+ * the one generated by running the simulator.
+ */
+class LteRadioEnvironmentMapTestCase : public TestCase
+{
+public:
+  /**
+   * Constructor
+   *
+   * \param useDataChannel whether to generate the map for the PDSCH
+   */
+  LteRadioEnvironmentMapTestCase (bool useDataChannel);
+  virtual ~LteRadioEnvironmentMapTestCase ();
+
+private:
+  virtual void DoRun (void);
+
+  /// A point of the map
+  struct RemPoint
+  {
+    double x;     //!< x coordinate
+    double y;     //!< y coordinate
+    double sinr;  //!< SINR
+  };
+
+  /**
+   * Generate a map.
+   *
+   * \param directEvaluation the `DirectEvaluation` attribute
+   * \param numThreads the `NumThreads` attribute
+   * \return the points of the map, in the order of the output file
+   */
+  std::vector<RemPoint> GenerateRem (bool directEvaluation, uint32_t numThreads);
+
+  bool m_useDataChannel;  //!< the `UseDataChannel` attribute
+};
+
+LteRadioEnvironmentMapTestCase::LteRadioEnvironmentMapTestCase (bool useDataChannel)
+  : TestCase (useDataChannel ? "REM of the data channel" : "REM of the control channel"),
+    m_useDataChannel (useDataChannel)
+{
+}
+
+LteRadioEnvironmentMapTestCase::~LteRadioEnvironmentMapTestCase ()
+{
+}
+
+std::vector<LteRadioEnvironmentMapTestCase::RemPoint>
+LteRadioEnvironmentMapTestCase::GenerateRem (bool directEvaluation, uint32_t numThreads)
+{
+  Ptr<LteHelper> lteHelper = CreateObject<LteHelper> ();
+  lteHelper->SetAttribute ("PathlossModel", StringValue ("ns3::FriisPropagationLossModel"));
+  lteHelper->SetEnbAntennaModelType ("ns3::CosineAntennaModel");
+
+  NodeContainer enbNodes;
+  NodeContainer ueNodes;
+  enbNodes.Create (3);
+  ueNodes.Create (3);
+  Ptr<ListPositionAllocator> positionAlloc = CreateObject<ListPositionAllocator> ();
+  positionAlloc->Add (Vector (0.0, 0.0, 30.0));
+  positionAlloc->Add (Vector (500.0, 0.0, 30.0));
+  positionAlloc->Add (Vector (250.0, 400.0, 30.0));
+  positionAlloc->Add (Vector (50.0, 20.0, 1.5));
+  positionAlloc->Add (Vector (450.0, 10.0, 1.5));
+  positionAlloc->Add (Vector (250.0, 350.0, 1.5));
+  MobilityHelper mobility;
+  mobility.SetMobilityModel ("ns3::ConstantPositionMobilityModel");
+  mobility.SetPositionAllocator (positionAlloc);
+  mobility.Install (NodeContainer (enbNodes, ueNodes));
+
+  NetDeviceContainer enbDevs;
+  for (uint32_t i = 0; i < enbNodes.GetN (); i++)
+    {
+      lteHelper->SetEnbAntennaModelAttribute ("Orientation", DoubleValue (120.0 * i));
+      enbDevs.Add (lteHelper->InstallEnbDevice (enbNodes.Get (i)));
+    }
+  NetDeviceContainer ueDevs = lteHelper->InstallUeDevice (ueNodes);
+  for (uint32_t i = 0; i < ueDevs.GetN (); i++)
+    {
+      lteHelper->Attach (ueDevs.Get (i), enbDevs.Get (i));
+    }
+  lteHelper->ActivateDataRadioBearer (ueDevs, EpsBearer (EpsBearer::NGBR_VIDEO_TCP_DEFAULT));
+
+  std::string fileName = CreateTempDirFilename ("rem.out");
+  Ptr<RadioEnvironmentMapHelper> remHelper = CreateObject<RadioEnvironmentMapHelper> ();
+  std::ostringstream channelPath;
+  channelPath << "/ChannelList/" << lteHelper->GetDownlinkSpectrumChannel ()->GetId ();
+  remHelper->SetAttribute ("ChannelPath", StringValue (channelPath.str ()));
+  remHelper->SetAttribute ("OutputFile", StringValue (fileName));
+  remHelper->SetAttribute ("XMin", DoubleValue (-100.0));
+  remHelper->SetAttribute ("XMax", DoubleValue (600.0));
+  remHelper->SetAttribute ("XRes", UintegerValue (15));
+  remHelper->SetAttribute ("YMin", DoubleValue (-100.0));
+  remHelper->SetAttribute ("YMax", DoubleValue (500.0));
+  remHelper->SetAttribute ("YRes", UintegerValue (12));
+  remHelper->SetAttribute ("Z", DoubleValue (1.5));
+  remHelper->SetAttribute ("UseDataChannel", BooleanValue (m_useDataChannel));
+  // several iterations when running the simulator
+  remHelper->SetAttribute ("MaxPointsPerIteration", UintegerValue (50));
+  remHelper->SetAttribute ("DirectEvaluation", BooleanValue (directEvaluation));
+  remHelper->SetAttribute ("NumThreads", UintegerValue (numThreads));
+  remHelper->Install ();
+
+  Simulator::Stop (Seconds (2));
+  Simulator::Run ();
+  Simulator::Destroy ();
+
+  std::vector<RemPoint> points;
+  std::ifstream file (fileName.c_str ());
+  RemPoint p;
+  double z;
+  while (file >> p.x >> p.y >> z >> p.sinr)
+    {
+      points.push_back (p);
+    }
+  return points;
+}
+
+void
+LteRadioEnvironmentMapTestCase::DoRun (void)
+{
+  std::vector<RemPoint> simulated = GenerateRem (false, 1);
+  NS_TEST_ASSERT_MSG_EQ (simulated.size (), 15 * 12, "Unexpected number of points");
+  for (uint32_t numThreads = 1; numThreads <= 4; numThreads *= 2)
+    {
+      std::vector<RemPoint> direct = GenerateRem (true, numThreads);
+      NS_TEST_ASSERT_MSG_EQ (direct.size (), simulated.size (), "Unexpected number of points with " << numThreads << " threads");
+      for (std::size_t i = 0; i < direct.size (); i++)
+        {
+          NS_TEST_ASSERT_MSG_EQ (direct[i].x, simulated[i].x, "Wrong x of point " << i << " with " << numThreads << " threads");
+          NS_TEST_ASSERT_MSG_EQ (direct[i].y, simulated[i].y, "Wrong y of point " << i << " with " << numThreads << " threads");
+          NS_TEST_ASSERT_MSG_EQ_TOL (direct[i].sinr, simulated[i].sinr, simulated[i].sinr * 1e-4,
+                                     "Wrong SINR of point " << i << " with " << numThreads << " threads");
+        }
+    }
+}
+
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Test suite for the direct evaluation of the Radio Environment Map.
+ */
+class LteRadioEnvironmentMapTestSuite : public TestSuite
+{
+public:
+  LteRadioEnvironmentMapTestSuite ();
+};
+
+LteRadioEnvironmentMapTestSuite::LteRadioEnvironmentMapTestSuite ()
+  : TestSuite ("lte-radio-environment-map", SYSTEM)
+{
+  AddTestCase (new LteRadioEnvironmentMapTestCase (false), TestCase::QUICK);
+  AddTestCase (new LteRadioEnvironmentMapTestCase (true), TestCase::QUICK);
+}
+
+static LteRadioEnvironmentMapTestSuite g_lteRadioEnvironmentMapTestSuite; ///< the test suite
@@ -0,0 +1,160 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2021
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/test.h"
+#include "ns3/log.h"
+
+#include "ns3/lte-rlc-segment-list.h"
+#include "ns3/lte-rlc-tag.h"
+#include <vector>
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE ("LteTestRlcSegmentList");
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Test case checking that reassembling the segments of a SDU with a
+ * LteRlcSegmentList gives back the SDU, with its bytes and byte tags.
+ */
+class LteRlcSegmentListTestCase : public TestCase
+{
+public:
+  LteRlcSegmentListTestCase ();
+  virtual ~LteRlcSegmentListTestCase ();
+
+private:
+  virtual void DoRun (void);
+  /**
+   * Check that the given packet has the bytes and the byte tag of the SDU.
+   * \param packet the packet
+   * \param nSegments the number of segments the packet was made of
+   */
+  void CheckSdu (Ptr<const Packet> packet, uint32_t nSegments);
+  /**
+   * Split the SDU into segments of the given size.
+   * \param segmentSize the size of the segments (but the last one)
+   * \return the segments
+   */
+  std::vector<Ptr<Packet> > Split (uint32_t segmentSize);
+
+  std::vector<uint8_t> m_bytes;  //!< the bytes of the SDU
+  Ptr<Packet> m_sdu;             //!< the SDU
+};
+
+LteRlcSegmentListTestCase::LteRlcSegmentListTestCase ()
+  : TestCase ("Reassemble the segments of a SDU")
+{
+}
+
+LteRlcSegmentListTestCase::~LteRlcSegmentListTestCase ()
+{
+}
+
+void
+LteRlcSegmentListTestCase::CheckSdu (Ptr<const Packet> packet, uint32_t nSegments)
+{
+  NS_TEST_ASSERT_MSG_EQ (packet->GetSize (), m_bytes.size (), "Unexpected size with " << nSegments << " segments");
+  std::vector<uint8_t> bytes (packet->GetSize ());
+  packet->CopyData (bytes.data (), bytes.size ());
+  NS_TEST_EXPECT_MSG_EQ ((bytes == m_bytes), true, "Unexpected bytes with " << nSegments << " segments");
+
+  // the byte tag of the SDU must cover all the bytes of the packet
+  uint32_t tagged = 0;
+  ByteTagIterator it = packet->GetByteTagIterator ();
+  while (it.HasNext ())
+    {
+      ByteTagIterator::Item item = it.Next ();
+      NS_TEST_EXPECT_MSG_EQ (item.GetTypeId (), RlcTag::GetTypeId (), "Unexpected byte tag");
+      tagged += item.GetEnd () - item.GetStart ();
+    }
+  NS_TEST_EXPECT_MSG_EQ (tagged, m_bytes.size (), "Unexpected tagged bytes with " << nSegments << " segments");
+}
+
+std::vector<Ptr<Packet> >
+LteRlcSegmentListTestCase::Split (uint32_t segmentSize)
+{
+  std::vector<Ptr<Packet> > segments;
+  Ptr<Packet> remaining = m_sdu->Copy ();
+  while (remaining->GetSize () > segmentSize)
+    {
+      segments.push_back (remaining->CreateFragment (0, segmentSize));
+      remaining->RemoveAtStart (segmentSize);
+    }
+  segments.push_back (remaining);
+  return segments;
+}
+
+void
+LteRlcSegmentListTestCase::DoRun (void)
+{
+  m_bytes.resize (1500);
+  for (uint32_t i = 0; i < m_bytes.size (); i++)
+    {
+      m_bytes[i] = i % 251;
+    }
+  m_sdu = Create<Packet> (m_bytes.data (), m_bytes.size ());
+  m_sdu->AddByteTag (RlcTag (Seconds (1)));
+
+  LteRlcSegmentList list;
+  for (uint32_t segmentSize = 100; segmentSize <= m_bytes.size (); segmentSize += 100)
+    {
+      std::vector<Ptr<Packet> > segments = Split (segmentSize);
+      list.Start (segments[0]);
+      for (uint32_t i = 1; i < segments.size (); i++)
+        {
+          list.Append (segments[i]);
+        }
+      CheckSdu (list.Assemble (), segments.size ());
+
+      segments = Split (segmentSize);
+      uint32_t nSegments = segments.size ();
+      CheckSdu (LteRlcSegmentList::Concatenate (segments), nSegments);
+    }
+
+  // the segments of a discarded SDU are not part of the next one
+  std::vector<Ptr<Packet> > segments = Split (500);
+  list.Start (segments[0]);
+  list.Append (segments[1]);
+  list.Clear ();
+  list.Start (m_sdu->Copy ());
+  CheckSdu (list.Assemble (), 1);
+}
+
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Test suite for the LteRlcSegmentList class.
+ */
+class LteRlcSegmentListTestSuite : public TestSuite
+{
+public:
+  LteRlcSegmentListTestSuite ();
+};
+
+LteRlcSegmentListTestSuite::LteRlcSegmentListTestSuite ()
+  : TestSuite ("lte-rlc-segment-list", UNIT)
+{
+  AddTestCase (new LteRlcSegmentListTestCase (), TestCase::QUICK);
+}
+
+static LteRlcSegmentListTestSuite g_lteRlcSegmentListTestSuite; ///< the test suite
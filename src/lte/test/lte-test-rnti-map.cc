@@ -0,0 +1,192 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2021
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/test.h"
+#include "ns3/log.h"
+
+#include "ns3/rnti-map.h"
+#include <map>
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE ("LteTestRntiMap");
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Test case checking that a RntiMap behaves as a std::map keyed by
+ * RNTI, including when elements are erased while iterating.
+ */
+class LteRntiMapTestCase : public TestCase
+{
+public:
+  LteRntiMapTestCase ();
+  virtual ~LteRntiMapTestCase ();
+
+private:
+  virtual void DoRun (void);
+  /**
+   * Check that the given RntiMap holds the same elements, in the same order,
+   * as the given std::map.
+   * \param map the RntiMap
+   * \param ref the std::map
+   */
+  void CheckEqual (const RntiMap<uint32_t>& map, const std::map<uint16_t, uint32_t>& ref);
+};
+
+LteRntiMapTestCase::LteRntiMapTestCase ()
+  : TestCase ("RntiMap behaves as a std::map keyed by RNTI")
+{
+}
+
+LteRntiMapTestCase::~LteRntiMapTestCase ()
+{
+}
+
+void
+LteRntiMapTestCase::CheckEqual (const RntiMap<uint32_t>& map, const std::map<uint16_t, uint32_t>& ref)
+{
+  NS_TEST_EXPECT_MSG_EQ (map.size (), ref.size (), "Unexpected number of elements");
+  NS_TEST_EXPECT_MSG_EQ (map.empty (), ref.empty (), "Unexpected emptiness");
+  RntiMap<uint32_t>::const_iterator it = map.begin ();
+  for (std::map<uint16_t, uint32_t>::const_iterator refIt = ref.begin (); refIt != ref.end (); refIt++)
+    {
+      NS_TEST_ASSERT_MSG_EQ ((it != map.end ()), true, "Too few elements");
+      NS_TEST_EXPECT_MSG_EQ (it->first, refIt->first, "Unexpected RNTI");
+      NS_TEST_EXPECT_MSG_EQ (it->second, refIt->second, "Unexpected value for RNTI " << refIt->first);
+      NS_TEST_EXPECT_MSG_EQ (map.count (refIt->first), 1, "RNTI " << refIt->first << " not found");
+      it++;
+    }
+  NS_TEST_EXPECT_MSG_EQ ((it == map.end ()), true, "Too many elements");
+}
+
+void
+LteRntiMapTestCase::DoRun (void)
+{
+  RntiMap<uint32_t> map;
+  std::map<uint16_t, uint32_t> ref;
+  CheckEqual (map, ref);
+  NS_TEST_EXPECT_MSG_EQ ((map.begin () == map.end ()), true, "An empty map has no element");
+
+  // insert out of order, across several words of the bitmap
+  uint16_t rntis[] = {7, 1, 200, 64, 63, 65535, 3, 128};
+  for (uint16_t rnti : rntis)
+    {
+      NS_TEST_EXPECT_MSG_EQ (map.insert (std::make_pair (rnti, rnti * 10u)).second, true,
+                             "RNTI " << rnti << " must be inserted");
+      ref.insert (std::make_pair (rnti, rnti * 10u));
+    }
+  CheckEqual (map, ref);
+
+  // an end iterator obtained before the map grows is still the end iterator
+  RntiMap<uint32_t> grown;
+  RntiMap<uint32_t>::iterator end = grown.end ();
+  grown[5] = 1;
+  NS_TEST_EXPECT_MSG_EQ ((grown.find (6) == end), true, "end () must not depend on the map size");
+
+  // inserting an existing RNTI does not change its value
+  std::pair<RntiMap<uint32_t>::iterator, bool> ret = map.insert (std::make_pair (uint16_t (7), 0u));
+  NS_TEST_EXPECT_MSG_EQ (ret.second, false, "RNTI 7 is already present");
+  NS_TEST_EXPECT_MSG_EQ (ret.first->second, 70, "The value of RNTI 7 must not change");
+
+  // find and operator[]
+  NS_TEST_EXPECT_MSG_EQ ((map.find (2) == map.end ()), true, "RNTI 2 is not present");
+  map.find (200)->second = 5;
+  ref[200] = 5;
+  map[2] += 4;
+  ref[2] += 4;
+  CheckEqual (map, ref);
+
+  // erase while iterating, as the schedulers do for expired CQIs
+  for (RntiMap<uint32_t>::iterator it = map.begin (); it != map.end (); )
+    {
+      if (it->first % 2 == 1)
+        {
+          RntiMap<uint32_t>::iterator temp = it;
+          it++;
+          map.erase (temp);
+        }
+      else
+        {
+          it++;
+        }
+    }
+  for (std::map<uint16_t, uint32_t>::iterator it = ref.begin (); it != ref.end (); )
+    {
+      if (it->first % 2 == 1)
+        {
+          ref.erase (it++);
+        }
+      else
+        {
+          it++;
+        }
+    }
+  CheckEqual (map, ref);
+
+  NS_TEST_EXPECT_MSG_EQ (map.erase (64), 1, "RNTI 64 must be erased");
+  NS_TEST_EXPECT_MSG_EQ (map.erase (64), 0, "RNTI 64 was already erased");
+  ref.erase (64);
+  CheckEqual (map, ref);
+
+  // iterate backward from the end
+  RntiMap<uint32_t>::iterator last = map.end ();
+  last--;
+  NS_TEST_EXPECT_MSG_EQ (last->first, ref.rbegin ()->first, "Unexpected last RNTI");
+  RntiMap<uint32_t>::iterator first = map.begin ();
+  first--;
+  NS_TEST_EXPECT_MSG_EQ ((first == map.end ()), true, "Moving back from the first element must give end ()");
+
+  // erasing the highest RNTI removes the slots past the highest RNTI left
+  map[1000] = 1;
+  NS_TEST_EXPECT_MSG_EQ (map.erase (1000), 1, "RNTI 1000 must be erased");
+  CheckEqual (map, ref);
+  last = map.end ();
+  last--;
+  NS_TEST_EXPECT_MSG_EQ (last->first, ref.rbegin ()->first, "Unexpected last RNTI after trimming");
+  NS_TEST_EXPECT_MSG_EQ (map.count (1000), 0, "RNTI 1000 must not be found");
+  map[300] = 3;
+  ref[300] = 3;
+  CheckEqual (map, ref);
+
+  map.clear ();
+  ref.clear ();
+  CheckEqual (map, ref);
+}
+
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Test suite for the RntiMap container.
+ */
+class LteRntiMapTestSuite : public TestSuite
+{
+public:
+  LteRntiMapTestSuite ();
+};
+
+LteRntiMapTestSuite::LteRntiMapTestSuite ()
+  : TestSuite ("lte-rnti-map", UNIT)
+{
+  AddTestCase (new LteRntiMapTestCase (), TestCase::QUICK);
+}
+
+static LteRntiMapTestSuite g_lteRntiMapTestSuite; ///< the test suite
@@ -41,8 +41,12 @@
 #include <fstream>
 #include <sstream>
 #include <map>
+#include <vector>
+#include <limits>
+#include <algorithm>
 #include "ns3/log.h"
 #include "ns3/unused.h"
+#include "ns3/simple-ref-count.h"
 #include "ns3/simulator.h"
 #include "ns3/node-list.h"
 #include "ns3/node.h"
@@ -62,6 +66,7 @@ NS_LOG_COMPONENT_DEFINE ("Ns2MobilityHelper");
 #define  NS2_SET      "set"
 #define  NS2_NODEID   "$node_("
 #define  NS2_NS_SCH   "$ns_"
+#define  NS2_BINARY_MAGIC  "NS2MOB\001\n"  // 8 bytes at the start of a binary trace
 
 
 /**
@@ -101,6 +106,129 @@ struct DestinationPoint
 };
 
 
+/**
+ * A valid statement of a ns-2 mobility trace
+ */
+struct Ns2Statement
+{
+  /// Type of statement
+  enum Type
+  {
+    INITIAL_POS = 0,   //!< line like $node_(0) set X_ 123
+    SCHED_POS = 1,     //!< line like $ns_ at 1 "$node_(0) set X_ 2"
+    SCHED_SETDEST = 2  //!< line like $ns_ at 1 "$node_(0) setdest 2 3 4"
+  };
+  uint8_t type;      //!< the type of statement
+  uint8_t coord;     //!< the coordinate of a position statement (0 for X_, 1 for Y_, 2 for Z_)
+  uint32_t nodeId;   //!< the node ID
+  double at;         //!< the time of a scheduled statement, in seconds
+  double values[3];  //!< the coordinate value, or the x, y and speed of a setdest
+};
+
+/**
+ * Reads the valid statements of a ns-2 mobility trace, in the text format
+ * or in the binary format written by Ns2MobilityHelper::ConvertToBinary.
+ */
+class Ns2TraceReader
+{
+public:
+  /**
+   * Open a trace
+   * \param filename the name of the trace file
+   */
+  Ns2TraceReader (std::string filename);
+  /**
+   * Read the next valid statement of the trace
+   * \param statement the statement read
+   * \return false if there are no more statements
+   */
+  bool Read (Ns2Statement &statement);
+
+private:
+  /**
+   * Read the next valid statement of a text trace
+   * \param statement the statement read
+   * \return false if there are no more statements
+   */
+  bool ReadText (Ns2Statement &statement);
+  /**
+   * Read the next statement of a binary trace
+   * \param statement the statement read
+   * \return false if there are no more statements
+   */
+  bool ReadBinary (Ns2Statement &statement);
+
+  std::ifstream m_file;  //!< the trace file
+  bool m_binary;         //!< whether the trace is in the binary format
+};
+
+/**
+ * Schedules the movements of the statements of a ns-2 mobility trace,
+ * either all at once or time window by time window.
+ */
+class Ns2MobilityLoader : public SimpleRefCount<Ns2MobilityLoader>
+{
+public:
+  /// The state of a node of the trace
+  struct NodeState
+  {
+    Ptr<ConstantVelocityMobilityModel> model;  //!< the mobility model of the node
+    DestinationPoint lastPos;                  //!< the last movement scheduled
+    Vector parsePosition;                      //!< the position set by the last position statement parsed
+    bool hasSchedPos[3];                       //!< whether each coordinate is set by a scheduled statement
+    double lastSchedPos[3];                    //!< the last scheduled value of each coordinate
+    NodeState ()
+    {
+      hasSchedPos[0] = hasSchedPos[1] = hasSchedPos[2] = false;
+      lastSchedPos[0] = lastSchedPos[1] = lastSchedPos[2] = 0;
+    }
+  };
+  /// The nodes of the trace, by node ID
+  typedef std::map<uint32_t, NodeState> NodeMap;
+
+  /**
+   * \param filename the name of the trace file
+   * \param nodes the nodes of the trace
+   * \param window the duration of the time windows, or zero to schedule
+   *        all the statements at once
+   */
+  Ns2MobilityLoader (std::string filename, const NodeMap &nodes, Time window);
+  /**
+   * Schedule all the statements, or those of the first time windows and
+   * the loading of the next ones.
+   */
+  void Start (void);
+
+private:
+  /**
+   * Schedule the statements up to a time
+   * \param end the time of the first statement not to schedule, in seconds
+   *        since the start
+   * \return false if there are no more statements
+   */
+  bool LoadUntil (double end);
+  /**
+   * Schedule the statements up to a time, and the loading of the next window
+   * \param end the time of the first statement not to schedule, in seconds
+   *        since the start
+   */
+  void LoadWindow (double end);
+  /**
+   * Schedule the movement of a scheduled statement
+   * \param statement the statement
+   * \param node the node of the statement
+   */
+  void ScheduleStatement (const Ns2Statement &statement, NodeState &node);
+
+  Ns2TraceReader m_reader;  //!< the trace reader
+  NodeMap m_nodes;          //!< the nodes of the trace
+  Time m_window;            //!< the duration of the time windows, or zero
+  Time m_start;             //!< the time the statement times are relative to
+  Ns2Statement m_next;      //!< the statement read but not scheduled yet
+  bool m_hasNext;           //!< whether m_next holds a statement
+  double m_lastAt;          //!< the time of the last statement scheduled
+};
+
 /**
  * Parses a line of ns2 mobility
  */
@@ -140,11 +268,6 @@ static std::string GetNodeIdFromToken (std::string str);
  */
 static int GetNodeIdInt (ParseResult pr);
 
-/**  
- * Get node id number in string format
- */
-static std::string GetNodeIdString (ParseResult pr);
-
 /**
  * Add one coord to a vector position
  */
@@ -168,7 +291,7 @@ static bool IsSchedMobilityPos (ParseResult pr);
 /**
  * Set waypoints and speed for movement.
  */
-static DestinationPoint SetMovement (Ptr<ConstantVelocityMobilityModel> model, Vector lastPos, double at,
+static DestinationPoint SetMovement (Ptr<ConstantVelocityMobilityModel> model, Vector lastPos, Time offset, double at,
                                      double xFinalPosition, double yFinalPosition, double speed);
 
 /**
@@ -179,23 +302,48 @@ static Vector SetInitialPosition (Ptr<ConstantVelocityMobilityModel> model, std:
 /** 
  * Schedule a set of position for a node
  */
-static Vector SetSchedPosition (Ptr<ConstantVelocityMobilityModel> model, double at, std::string coord, double coordVal);
+static Vector SetSchedPosition (Ptr<ConstantVelocityMobilityModel> model, Vector position, Time offset, double at,
+                                std::string coord, double coordVal);
+
+/**
+ * Get the name of a coordinate
+ */
+static std::string GetCoordName (uint8_t coord);
+
+/**
+ * Get the index of a coordinate from its name
+ */
+static uint8_t GetCoordIndex (const std::string& coord);
+
+/**
+ * Compare the times of two statements, the initial positions being first
+ */
+static bool Ns2StatementTimeLess (const Ns2Statement& a, const Ns2Statement& b);
+
+/**
+ * Write statements in the binary format
+ */
+static void WriteNs2Statements (std::ostream& os, const std::vector<Ns2Statement>& statements);
 
 
 Ns2MobilityHelper::Ns2MobilityHelper (std::string filename)
-  : m_filename (filename)
+  : m_filename (filename),
+    m_streamingWindow (Seconds (0))
 {
   std::ifstream file (m_filename.c_str (), std::ios::in);
   if (!(file.is_open ())) NS_FATAL_ERROR("Could not open trace file " << m_filename.c_str() << " for reading, aborting here \n"); 
 }
 
+void
+Ns2MobilityHelper::SetStreamingWindow (Time window)
+{
+  NS_ABORT_MSG_IF (window.IsStrictlyNegative (), "The streaming window must not be negative");
+  m_streamingWindow = window;
+}
+
 Ptr<ConstantVelocityMobilityModel>
-Ns2MobilityHelper::GetMobilityModel (std::string idString, const ObjectStore &store) const
+Ns2MobilityHelper::GetMobilityModel (uint32_t id, const ObjectStore &store) const
 {
-  std::istringstream iss;
-  iss.str (idString);
-  uint32_t id (0);
-  iss >> id;
   Ptr<Object> object = store.Get (id);
   if (object == 0)
     {
@@ -214,7 +362,7 @@ Ns2MobilityHelper::GetMobilityModel (std::string idString, const ObjectStore &st
 void
 Ns2MobilityHelper::ConfigNodesMovements (const ObjectStore &store) const
 {
-  std::map<int, DestinationPoint> last_pos;    // Stores previous movement scheduled for each node
+  Ns2MobilityLoader::NodeMap nodes;
 
   //*****************************************************************
   // Parse the file the first time to get the initial node positions.
@@ -223,69 +371,64 @@ Ns2MobilityHelper::ConfigNodesMovements (const ObjectStore &store) const
   // Look through the whole the file for the the initial node
   // positions to make this helper robust to handle trace files with
   // the initial node positions at the end.
-  std::ifstream file (m_filename.c_str (), std::ios::in);
-  if (file.is_open ())
+  Ns2TraceReader reader (m_filename);
+  Ns2Statement statement;
+  while (reader.Read (statement))
     {
-      while (!file.eof () )
-        {
-          int         iNodeId = 0;
-          std::string nodeId;
-          std::string line;
-
-          getline (file, line);
-
-          // ignore empty lines
-          if (line.empty ())
-            {
-              continue;
-            }
-
-          ParseResult pr = ParseNs2Line (line); // Parse line and obtain tokens
-
-          // Check if the line corresponds with setting the initial
-          // node positions
-          if (pr.tokens.size () != 4)
-            {
-              continue;
-            }
-
-          // Get the node Id
-          nodeId  = GetNodeIdString (pr);
-          iNodeId = GetNodeIdInt (pr);
-          if (iNodeId == -1)
-            {
-              NS_LOG_ERROR ("Node number couldn't be obtained (corrupted file?): " << line << "\n");
-              continue;
-            }
-
-          // get mobility model of node
-          Ptr<ConstantVelocityMobilityModel> model = GetMobilityModel (nodeId,store);
-
-          // if model not exists, continue
-          if (model == 0)
-            {
-              NS_LOG_ERROR ("Unknown node ID (corrupted file?): " << nodeId << "\n");
-              continue;
-            }
+      // get mobility model of node
+      Ptr<ConstantVelocityMobilityModel> model = GetMobilityModel (statement.nodeId, store);
 
+      // if model not exists, continue
+      if (model == 0)
+        {
+          NS_LOG_ERROR ("Unknown node ID (corrupted file?): " << statement.nodeId << "\n");
+          continue;
+        }
+      Ns2MobilityLoader::NodeState &node = nodes[statement.nodeId];
+      node.model = model;
+
+      /*
+       * In this case a initial position is being seted
+       * line like $node_(0) set X_ 151.05190721688197
+       */
+      if (statement.type == Ns2Statement::INITIAL_POS)
+        {
+          DestinationPoint point;
+          //                                                    coord                              coord value
+          point.m_finalPosition = SetInitialPosition (model, GetCoordName (statement.coord), statement.values[0]);
+          node.lastPos = point;
+
+          // Log new position
+          NS_LOG_DEBUG ("Positions after parse for node " << statement.nodeId <<
+                        " position = " << node.lastPos.m_finalPosition);
+        }
+      else if (statement.type == Ns2Statement::SCHED_POS)
+        {
+          node.hasSchedPos[statement.coord] = true;
+          node.lastSchedPos[statement.coord] = statement.values[0];
+        }
+    }
 
-          /*
-           * In this case a initial position is being seted
-           * line like $node_(0) set X_ 151.05190721688197
-           */
-          if (IsSetInitialPos (pr))
+  for (Ns2MobilityLoader::NodeMap::iterator it = nodes.begin (); it != nodes.end (); ++it)
+    {
+      Ns2MobilityLoader::NodeState &node = it->second;
+      node.parsePosition = node.model->GetPosition ();
+      // The scheduled positions used to be set when they were parsed, so
+      // the nodes are left at the position set by the last ones until
+      // they are scheduled.
+      if (node.hasSchedPos[0] || node.hasSchedPos[1] || node.hasSchedPos[2])
+        {
+          Vector position = node.parsePosition;
+          for (uint8_t coord = 0; coord < 3; coord++)
             {
-              DestinationPoint point;
-              //                                                    coord         coord value
-              point.m_finalPosition = SetInitialPosition (model, pr.tokens[2], pr.dvals[3]);
-              last_pos[iNodeId] = point;
-
-              // Log new position
-              NS_LOG_DEBUG ("Positions after parse for node " << iNodeId << " " << nodeId <<
-                            " position = " << last_pos[iNodeId].m_finalPosition);
+              if (node.hasSchedPos[coord])
+                {
+                  std::string coordName = GetCoordName (coord);
+                  position = SetOneInitialCoord (position, coordName, node.lastSchedPos[coord]);
+                }
             }
+          node.model->SetPosition (position);
         }
-      file.close ();
     }
 
   //*****************************************************************
@@ -294,138 +437,330 @@ Ns2MobilityHelper::ConfigNodesMovements (const ObjectStore &store) const
 
   // The reason the file is parsed again is to make this helper robust
   // to handle trace files with the initial node positions at the end.
-  file.open (m_filename.c_str (), std::ios::in);
-  if (file.is_open ())
+  Ptr<Ns2MobilityLoader> loader = Create<Ns2MobilityLoader> (m_filename, nodes, m_streamingWindow);
+  loader->Start ();
+}
+
+void
+Ns2MobilityHelper::ConvertToBinary (std::string tclFilename, std::string binaryFilename)
+{
+  // Check whether the scheduled statements are already sorted by time,
+  // which is usually the case, so that they can be converted one by one.
+  bool sorted = true;
+  {
+    Ns2TraceReader reader (tclFilename);
+    Ns2Statement statement;
+    double lastAt = 0;
+    while (sorted && reader.Read (statement))
+      {
+        if (statement.type != Ns2Statement::INITIAL_POS)
+          {
+            sorted = (statement.at >= lastAt);
+            lastAt = statement.at;
+          }
+      }
+  }
+
+  std::ofstream file (binaryFilename.c_str (), std::ios::out | std::ios::binary);
+  if (!file.is_open ())
     {
-      while (!file.eof () )
-        {
-          int         iNodeId = 0;
-          std::string nodeId;
-          std::string line;
+      NS_FATAL_ERROR ("Could not open trace file " << binaryFilename << " for writing");
+    }
+  file.write (NS2_BINARY_MAGIC, 8);
 
-          getline (file, line);
+  Ns2TraceReader reader (tclFilename);
+  std::vector<Ns2Statement> statements;
+  Ns2Statement statement;
+  while (reader.Read (statement))
+    {
+      if (sorted)
+        {
+          statements.assign (1, statement);
+        }
+      else
+        {
+          statements.push_back (statement);
+          continue;
+        }
+      WriteNs2Statements (file, statements);
+    }
+  if (!sorted)
+    {
+      std::stable_sort (statements.begin (), statements.end (), Ns2StatementTimeLess);
+      WriteNs2Statements (file, statements);
+    }
+  if (!file)
+    {
+      NS_FATAL_ERROR ("Could not write trace file " << binaryFilename);
+    }
+}
 
-          // ignore empty lines
-          if (line.empty ())
-            {
-              continue;
-            }
+Ns2TraceReader::Ns2TraceReader (std::string filename)
+  : m_file (filename.c_str (), std::ios::in | std::ios::binary),
+    m_binary (false)
+{
+  if (!m_file.is_open ())
+    {
+      NS_FATAL_ERROR ("Could not open trace file " << filename << " for reading");
+    }
+  char magic[8];
+  if (m_file.read (magic, 8) && std::equal (magic, magic + 8, NS2_BINARY_MAGIC))
+    {
+      m_binary = true;
+    }
+  else
+    {
+      m_file.clear ();
+      m_file.seekg (0);
+    }
+}
 
-          ParseResult pr = ParseNs2Line (line); // Parse line and obtain tokens
+bool
+Ns2TraceReader::Read (Ns2Statement &statement)
+{
+  return m_binary ? ReadBinary (statement) : ReadText (statement);
+}
 
-          // Check if the line corresponds with one of the three types of line
-          if (pr.tokens.size () != 4 && pr.tokens.size () != 7 && pr.tokens.size () != 8)
-            {
-              NS_LOG_ERROR ("Line has not correct number of parameters (corrupted file?): " << line << "\n");
-              continue;
-            }
+bool
+Ns2TraceReader::ReadText (Ns2Statement &statement)
+{
+  std::string line;
+  while (std::getline (m_file, line))
+    {
+      // ignore empty lines
+      if (line.empty ())
+        {
+          continue;
+        }
 
-          // Get the node Id
-          nodeId  = GetNodeIdString (pr);
-          iNodeId = GetNodeIdInt (pr);
-          if (iNodeId == -1)
-            {
-              NS_LOG_ERROR ("Node number couldn't be obtained (corrupted file?): " << line << "\n");
-              continue;
-            }
+      ParseResult pr = ParseNs2Line (line); // Parse line and obtain tokens
 
-          // get mobility model of node
-          Ptr<ConstantVelocityMobilityModel> model = GetMobilityModel (nodeId,store);
+      // Check if the line corresponds with one of the three types of line
+      if (pr.tokens.size () != 4 && pr.tokens.size () != 7 && pr.tokens.size () != 8)
+        {
+          NS_LOG_ERROR ("Line has not correct number of parameters (corrupted file?): " << line << "\n");
+          continue;
+        }
 
-          // if model not exists, continue
-          if (model == 0)
-            {
-              NS_LOG_ERROR ("Unknown node ID (corrupted file?): " << nodeId << "\n");
-              continue;
-            }
+      // Get the node Id
+      int iNodeId = GetNodeIdInt (pr);
+      if (iNodeId == -1)
+        {
+          NS_LOG_ERROR ("Node number couldn't be obtained (corrupted file?): " << line << "\n");
+          continue;
+        }
+      statement.nodeId = iNodeId;
 
+      /*
+       * In this case a initial position is being seted
+       * line like $node_(0) set X_ 151.05190721688197
+       */
+      if (IsSetInitialPos (pr))
+        {
+          statement.type = Ns2Statement::INITIAL_POS;
+          statement.coord = GetCoordIndex (pr.tokens[2]);
+          statement.at = 0;
+          statement.values[0] = pr.dvals[3];
+          statement.values[1] = statement.values[2] = 0;
+          return true;
+        }
 
-          /*
-           * In this case a initial position is being seted
-           * line like $node_(0) set X_ 151.05190721688197
-           */
-          if (IsSetInitialPos (pr))
-            {
-              // This is the second time this file has been parsed,
-              // and the initial node positions were already set the
-              // first time.  So, do nothing this time with this line.
-              continue;
-            }
+      // This is a scheduled event, so time at should be present
+      if (!IsNumber (pr.tokens[2]))
+        {
+          NS_LOG_WARN ("Time is not a number: " << pr.tokens[2]);
+          continue;
+        }
 
-          else // NOW EVENTS TO BE SCHEDULED
-            {
+      statement.at = pr.dvals[2]; // set time at
 
-              // This is a scheduled event, so time at should be present
-              double at;
+      if (statement.at < 0)
+        {
+          NS_LOG_WARN ("Time is less than cero: " << statement.at);
+          continue;
+        }
 
-              if (!IsNumber (pr.tokens[2]))
-                {
-                  NS_LOG_WARN ("Time is not a number: " << pr.tokens[2]);
-                  continue;
-                }
+      /*
+       * In this case a new waypoint is added
+       * line like $ns_ at 1 "$node_(0) setdest 2 3 4"
+       */
+      if (IsSchedMobilityPos (pr))
+        {
+          statement.type = Ns2Statement::SCHED_SETDEST;
+          statement.coord = 0;
+          statement.values[0] = pr.dvals[5];
+          statement.values[1] = pr.dvals[6];
+          statement.values[2] = pr.dvals[7];
+          return true;
+        }
 
-              at = pr.dvals[2]; // set time at
+      /*
+       * Scheduled set position
+       * line like $ns_ at 4.634906291962 "$node_(0) set X_ 28.675920486450"
+       */
+      if (IsSchedSetPos (pr))
+        {
+          statement.type = Ns2Statement::SCHED_POS;
+          statement.coord = GetCoordIndex (pr.tokens[5]);
+          statement.values[0] = pr.dvals[6];
+          statement.values[1] = statement.values[2] = 0;
+          return true;
+        }
 
-              if ( at < 0 )
-                {
-                  NS_LOG_WARN ("Time is less than cero: " << at);
-                  continue;
-                }
+      NS_LOG_WARN ("Format Line is not correct: " << line << "\n");
+    }
+  return false;
+}
 
+bool
+Ns2TraceReader::ReadBinary (Ns2Statement &statement)
+{
+  m_file.read (reinterpret_cast<char *> (&statement.type), sizeof (statement.type));
+  m_file.read (reinterpret_cast<char *> (&statement.coord), sizeof (statement.coord));
+  m_file.read (reinterpret_cast<char *> (&statement.nodeId), sizeof (statement.nodeId));
+  m_file.read (reinterpret_cast<char *> (&statement.at), sizeof (statement.at));
+  m_file.read (reinterpret_cast<char *> (statement.values), sizeof (statement.values));
+  if (!m_file)
+    {
+      return false;
+    }
+  if (statement.type > Ns2Statement::SCHED_SETDEST || statement.coord > 2)
+    {
+      NS_FATAL_ERROR ("Corrupted binary trace file");
+    }
+  return true;
+}
 
+Ns2MobilityLoader::Ns2MobilityLoader (std::string filename, const NodeMap &nodes, Time window)
+  : m_reader (filename),
+    m_nodes (nodes),
+    m_window (window),
+    m_hasNext (false),
+    m_lastAt (0)
+{
+}
 
-              /*
-               * In this case a new waypoint is added
-               * line like $ns_ at 1 "$node_(0) setdest 2 3 4"
-               */
-              if (IsSchedMobilityPos (pr))
-                {
-                  if (last_pos[iNodeId].m_targetArrivalTime > at)
-                    {
-                      NS_LOG_LOGIC ("Did not reach a destination! stoptime = " << last_pos[iNodeId].m_targetArrivalTime << ", at = "<<  at);
-                      double actuallytraveled = at - last_pos[iNodeId].m_travelStartTime;
-                      Vector reached = Vector (
-                          last_pos[iNodeId].m_startPosition.x + last_pos[iNodeId].m_speed.x * actuallytraveled,
-                          last_pos[iNodeId].m_startPosition.y + last_pos[iNodeId].m_speed.y * actuallytraveled,
-                          0
-                          );
-                      NS_LOG_LOGIC ("Final point = " << last_pos[iNodeId].m_finalPosition << ", actually reached = " << reached);
-                      last_pos[iNodeId].m_stopEvent.Cancel ();
-                      last_pos[iNodeId].m_finalPosition = reached;
-                    }
-                  //                                     last position     time  X coord     Y coord      velocity
-                  last_pos[iNodeId] = SetMovement (model, last_pos[iNodeId].m_finalPosition, at, pr.dvals[5], pr.dvals[6], pr.dvals[7]);
-
-                  // Log new position
-                  NS_LOG_DEBUG ("Positions after parse for node " << iNodeId << " " << nodeId << " position =" << last_pos[iNodeId].m_finalPosition);
-                }
+void
+Ns2MobilityLoader::Start (void)
+{
+  m_start = Simulator::Now ();
+  if (m_window.IsZero ())
+    {
+      LoadUntil (std::numeric_limits<double>::infinity ());
+      return;
+    }
+  // The statements of a window are scheduled at the start of the previous
+  // one, so that they are always scheduled before their time.
+  if (LoadUntil (2 * m_window.GetSeconds ()))
+    {
+      Simulator::Schedule (m_window, &Ns2MobilityLoader::LoadWindow, Ptr<Ns2MobilityLoader> (this),
+                           3 * m_window.GetSeconds ());
+    }
+}
 
+void
+Ns2MobilityLoader::LoadWindow (double end)
+{
+  if (LoadUntil (end))
+    {
+      Simulator::Schedule (m_window, &Ns2MobilityLoader::LoadWindow, Ptr<Ns2MobilityLoader> (this),
+                           end + m_window.GetSeconds ());
+    }
+}
 
-              /*
-               * Scheduled set position
-               * line like $ns_ at 4.634906291962 "$node_(0) set X_ 28.675920486450"
-               */
-              else if (IsSchedSetPos (pr))
-                {
-                  //                                         time  coordinate   coord value
-                  last_pos[iNodeId].m_finalPosition = SetSchedPosition (model, at, pr.tokens[5], pr.dvals[6]);
-                  if (last_pos[iNodeId].m_targetArrivalTime > at)
-                    {
-                      last_pos[iNodeId].m_stopEvent.Cancel ();
-                    }
-                  last_pos[iNodeId].m_targetArrivalTime = at;
-                  last_pos[iNodeId].m_travelStartTime = at;
-                  // Log new position
-                  NS_LOG_DEBUG ("Positions after parse for node " << iNodeId << " " << nodeId <<
-                                " position =" << last_pos[iNodeId].m_finalPosition);
-                }
-              else
-                {
-                  NS_LOG_WARN ("Format Line is not correct: " << line << "\n");
-                }
+bool
+Ns2MobilityLoader::LoadUntil (double end)
+{
+  while (true)
+    {
+      if (!m_hasNext)
+        {
+          if (!m_reader.Read (m_next))
+            {
+              return false;
             }
+          m_hasNext = true;
+        }
+      // the initial positions were set by the first parse
+      if (m_next.type == Ns2Statement::INITIAL_POS)
+        {
+          m_hasNext = false;
+          continue;
+        }
+      if (m_next.at >= end)
+        {
+          return true;
         }
-      file.close ();
+      m_hasNext = false;
+      if (!m_window.IsZero () && m_next.at < m_lastAt)
+        {
+          NS_FATAL_ERROR ("The statements of a trace read with a streaming window must be sorted by time, "
+                          "found time " << m_next.at << " after time " << m_lastAt <<
+                          "; use Ns2MobilityHelper::ConvertToBinary to sort them");
+        }
+      m_lastAt = m_next.at;
+      NodeMap::iterator it = m_nodes.find (m_next.nodeId);
+      if (it == m_nodes.end ())
+        {
+          // unknown node, reported by the first parse
+          continue;
+        }
+      ScheduleStatement (m_next, it->second);
+    }
+}
+
+void
+Ns2MobilityLoader::ScheduleStatement (const Ns2Statement &statement, NodeState &node)
+{
+  // the statement times are relative to the time the trace was installed
+  Time offset = m_start - Simulator::Now ();
+  double at = statement.at;
+  DestinationPoint &lastPos = node.lastPos;
+
+  /*
+   * In this case a new waypoint is added
+   * line like $ns_ at 1 "$node_(0) setdest 2 3 4"
+   */
+  if (statement.type == Ns2Statement::SCHED_SETDEST)
+    {
+      if (lastPos.m_targetArrivalTime > at)
+        {
+          NS_LOG_LOGIC ("Did not reach a destination! stoptime = " << lastPos.m_targetArrivalTime << ", at = "<<  at);
+          double actuallytraveled = at - lastPos.m_travelStartTime;
+          Vector reached = Vector (
+              lastPos.m_startPosition.x + lastPos.m_speed.x * actuallytraveled,
+              lastPos.m_startPosition.y + lastPos.m_speed.y * actuallytraveled,
+              0
+              );
+          NS_LOG_LOGIC ("Final point = " << lastPos.m_finalPosition << ", actually reached = " << reached);
+          lastPos.m_stopEvent.Cancel ();
+          lastPos.m_finalPosition = reached;
+        }
+      //                                      last position        time          X coord              Y coord              velocity
+      lastPos = SetMovement (node.model, lastPos.m_finalPosition, offset, at, statement.values[0], statement.values[1], statement.values[2]);
+
+      // Log new position
+      NS_LOG_DEBUG ("Positions after parse for node " << statement.nodeId << " position =" << lastPos.m_finalPosition);
+    }
+
+  /*
+   * Scheduled set position
+   * line like $ns_ at 4.634906291962 "$node_(0) set X_ 28.675920486450"
+   */
+  else if (statement.type == Ns2Statement::SCHED_POS)
+    {
+      //                                                                           time  coordinate                         coord value
+      node.parsePosition = SetSchedPosition (node.model, node.parsePosition, offset, at, GetCoordName (statement.coord), statement.values[0]);
+      lastPos.m_finalPosition = node.parsePosition;
+      if (lastPos.m_targetArrivalTime > at)
+        {
+          lastPos.m_stopEvent.Cancel ();
+        }
+      lastPos.m_targetArrivalTime = at;
+      lastPos.m_travelStartTime = at;
+      // Log new position
+      NS_LOG_DEBUG ("Positions after parse for node " << statement.nodeId <<
+                    " position =" << lastPos.m_finalPosition);
     }
 }
 
@@ -652,27 +987,6 @@ GetNodeIdInt (ParseResult pr)
   return result;
 }
 
-// Get node id number in string format
-std::string
-GetNodeIdString (ParseResult pr)
-{
-  switch (pr.tokens.size ())
-    {
-    case 4:   // line like $node_(0) set X_ 11
-      return pr.svals[0];
-      break;
-    case 7:   // line like $ns_ at 4 "$node_(0) set X_ 28"
-      return pr.svals[3];
-      break;
-    case 8:   // line like $ns_ at 1 "$node_(0) setdest 2 3 4"
-      return pr.svals[3];
-      break;
-    default:
-      return "";
-    }
-}
-
-
 Vector
 SetOneInitialCoord (Vector position, std::string& coord, double value)
 {
@@ -730,7 +1044,7 @@ IsSchedMobilityPos (ParseResult pr)
 }
 
 DestinationPoint
-SetMovement (Ptr<ConstantVelocityMobilityModel> model, Vector last_pos, double at,
+SetMovement (Ptr<ConstantVelocityMobilityModel> model, Vector last_pos, Time offset, double at,
              double xFinalPosition, double yFinalPosition, double speed)
 {
   DestinationPoint retval;
@@ -742,7 +1056,7 @@ SetMovement (Ptr<ConstantVelocityMobilityModel> model, Vector last_pos, double a
   if (speed == 0)
     {
       // We have to maintain last position, and stop the movement
-      retval.m_stopEvent = Simulator::Schedule (Seconds (at), &ConstantVelocityMobilityModel::SetVelocity, model,
+      retval.m_stopEvent = Simulator::Schedule (offset + Seconds (at), &ConstantVelocityMobilityModel::SetVelocity, model,
                                                 Vector (0, 0, 0));
       return retval;
     }
@@ -766,8 +1080,8 @@ SetMovement (Ptr<ConstantVelocityMobilityModel> model, Vector last_pos, double a
       NS_LOG_DEBUG ("Calculated Speed: X=" << xSpeed << " Y=" << ySpeed << " Z=" << zSpeed);
 
       // Set the Values
-      Simulator::Schedule (Seconds (at), &ConstantVelocityMobilityModel::SetVelocity, model, Vector (xSpeed, ySpeed, zSpeed));
-      retval.m_stopEvent = Simulator::Schedule (Seconds (at + time), &ConstantVelocityMobilityModel::SetVelocity, model, Vector (0, 0, 0));
+      Simulator::Schedule (offset + Seconds (at), &ConstantVelocityMobilityModel::SetVelocity, model, Vector (xSpeed, ySpeed, zSpeed));
+      retval.m_stopEvent = Simulator::Schedule (offset + Seconds (at + time), &ConstantVelocityMobilityModel::SetVelocity, model, Vector (0, 0, 0));
       retval.m_finalPosition.x += xSpeed * time;
       retval.m_finalPosition.y += ySpeed * time;
       retval.m_targetArrivalTime += time;
@@ -791,22 +1105,68 @@ SetInitialPosition (Ptr<ConstantVelocityMobilityModel> model, std::string coord,
 
 // Schedule a set of position for a node
 Vector
-SetSchedPosition (Ptr<ConstantVelocityMobilityModel> model, double at, std::string coord, double coordVal)
+SetSchedPosition (Ptr<ConstantVelocityMobilityModel> model, Vector position, Time offset, double at,
+                  std::string coord, double coordVal)
 {
   // update position
-  model->SetPosition (SetOneInitialCoord (model->GetPosition (), coord, coordVal));
-
-  Vector position;
-  position.x = model->GetPosition ().x;
-  position.y = model->GetPosition ().y;
-  position.z = model->GetPosition ().z;
+  position = SetOneInitialCoord (position, coord, coordVal);
 
   // Chedule next positions
-  Simulator::Schedule (Seconds (at), &ConstantVelocityMobilityModel::SetPosition, model,position);
+  Simulator::Schedule (offset + Seconds (at), &ConstantVelocityMobilityModel::SetPosition, model,position);
 
   return position;
 }
 
+std::string
+GetCoordName (uint8_t coord)
+{
+  switch (coord)
+    {
+    case 0:
+      return NS2_X_COORD;
+    case 1:
+      return NS2_Y_COORD;
+    default:
+      return NS2_Z_COORD;
+    }
+}
+
+uint8_t
+GetCoordIndex (const std::string& coord)
+{
+  if (coord == NS2_X_COORD)
+    {
+      return 0;
+    }
+  else if (coord == NS2_Y_COORD)
+    {
+      return 1;
+    }
+  return 2;
+}
+
+bool
+Ns2StatementTimeLess (const Ns2Statement& a, const Ns2Statement& b)
+{
+  // the initial positions are not scheduled, they are kept first
+  double aTime = (a.type == Ns2Statement::INITIAL_POS) ? -1 : a.at;
+  double bTime = (b.type == Ns2Statement::INITIAL_POS) ? -1 : b.at;
+  return aTime < bTime;
+}
+
+void
+WriteNs2Statements (std::ostream& os, const std::vector<Ns2Statement>& statements)
+{
+  for (std::vector<Ns2Statement>::const_iterator it = statements.begin (); it != statements.end (); ++it)
+    {
+      os.write (reinterpret_cast<const char *> (&it->type), sizeof (it->type));
+      os.write (reinterpret_cast<const char *> (&it->coord), sizeof (it->coord));
+      os.write (reinterpret_cast<const char *> (&it->nodeId), sizeof (it->nodeId));
+      os.write (reinterpret_cast<const char *> (&it->at), sizeof (it->at));
+      os.write (reinterpret_cast<const char *> (it->values), sizeof (it->values));
+    }
+}
+
 void
 Ns2MobilityHelper::Install (void) const
 {
@@ -27,6 +27,7 @@
 #include <stdint.h>
 #include "ns3/ptr.h"
 #include "ns3/object.h"
+#include "ns3/nstime.h"
 
 namespace ns3 {
 
@@ -69,6 +70,14 @@ class ConstantVelocityMobilityModel;
  *
  *  See usage example in examples/mobility/ns2-mobility-trace.cc
  *
+ * By default, the whole trace is parsed and all the movements are
+ * scheduled when the helper is installed. For long traces with many nodes,
+ * SetStreamingWindow can be used to read the trace as the simulation
+ * advances and only schedule the movements of the next time windows, which
+ * requires the scheduled statements of the trace to be sorted by time.
+ * ConvertToBinary converts a trace to a compact binary format, read
+ * without text parsing, whose statements are sorted by time.
+ *
  * \bug Rounding errors may cause movement to diverge from the mobility
  * pattern in ns-2 (using the same trace).
  * See https://www.nsnam.org/bugzilla/show_bug.cgi?id=1316
@@ -103,6 +112,40 @@ public:
    */
   template <typename T>
   void Install (T begin, T end) const;
+
+  /**
+   * Read the trace incrementally when installed. The initial positions are
+   * set when the helper is installed, but the scheduled statements are then
+   * read as the simulation advances, those of the next two time windows
+   * being scheduled at the start of each window, so that the memory used
+   * does not grow with the duration of the trace. The scheduled statements
+   * of the trace must be sorted by time.
+   *
+   * \param window the duration of the time windows, or zero (the default)
+   *        to schedule all the statements when the helper is installed
+   */
+  void SetStreamingWindow (Time window);
+
+  /**
+   * Convert a ns-2 mobility trace to a binary trace which can be read by
+   * this helper, faster than the text format. The binary trace holds the
+   * valid statements of the trace, with the scheduled statements sorted by
+   * time (the statements scheduled at the same time keep their order), so
+   * that it can always be read with SetStreamingWindow.
+   *
+   * The binary trace is an 8-byte header followed by a record of 38 bytes
+   * per statement, in the byte order of the host: the type of statement
+   * (1 byte: 0 for an initial position, 1 for a scheduled position, 2 for
+   * a setdest), the coordinate of a position statement (1 byte: 0 for X_,
+   * 1 for Y_, 2 for Z_), the node ID (4 bytes), the time of a scheduled
+   * statement in seconds and three values (doubles): the coordinate value
+   * of a position statement, or the destination x and y and the speed of a
+   * setdest statement.
+   *
+   * \param tclFilename the name of the ns-2 trace file to read
+   * \param binaryFilename the name of the binary trace file to write
+   */
+  static void ConvertToBinary (std::string tclFilename, std::string binaryFilename);
 private:
   /**
    * \brief a class to hold input objects internally
@@ -124,13 +167,14 @@ public:
    */
   void ConfigNodesMovements (const ObjectStore &store) const;
   /**
-   * Get or create a ConstantVelocityMobilityModel corresponding to idString
-   * \param idString string name for a node
+   * Get or create a ConstantVelocityMobilityModel corresponding to id
+   * \param id the node ID in the trace
    * \param store Object store containing ns-3 mobility models
    * \return pointer to a ConstantVelocityMobilityModel
    */
-  Ptr<ConstantVelocityMobilityModel> GetMobilityModel (std::string idString, const ObjectStore &store) const;
+  Ptr<ConstantVelocityMobilityModel> GetMobilityModel (uint32_t id, const ObjectStore &store) const;
   std::string m_filename; //!< filename of file containing ns-2 mobility trace 
+  Time m_streamingWindow; //!< duration of the windows of the trace read at once, or zero
 };
 
 } // namespace ns3
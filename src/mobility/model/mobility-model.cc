@@ -21,6 +21,7 @@
 #include <cmath>
 
 #include "mobility-model.h"
+#include "ns3/simulator.h"
 #include "ns3/trace-source-accessor.h"
 
 namespace ns3 {
@@ -53,6 +54,7 @@ MobilityModel::GetTypeId (void)
 }
 
 MobilityModel::MobilityModel ()
+  : m_cachedPositionValid (false)
 {
 }
 
@@ -63,7 +65,33 @@ MobilityModel::~MobilityModel ()
 Vector
 MobilityModel::GetPosition (void) const
 {
-  return DoGetPosition ();
+  return GetCachedPosition (Simulator::Now ());
+}
+
+Vector
+MobilityModel::GetCachedPosition (const Time &now) const
+{
+  if (!m_cachedPositionValid || m_cachedPositionTime != now)
+    {
+      Vector position = DoGetPosition ();
+      m_cachedPosition = position;
+      m_cachedPositionTime = now;
+      m_cachedPositionValid = true;
+      return position;
+    }
+  return m_cachedPosition;
+}
+
+void
+MobilityModel::GetPositions (const std::vector<Ptr<MobilityModel> > &models,
+                             std::vector<Vector> &positions)
+{
+  Time now = Simulator::Now ();
+  positions.resize (models.size ());
+  for (std::size_t i = 0; i < models.size (); i++)
+    {
+      positions[i] = models[i]->GetCachedPosition (now);
+    }
 }
 Vector
 MobilityModel::GetVelocity (void) const
@@ -75,13 +103,14 @@ void
 MobilityModel::SetPosition (const Vector &position)
 {
   DoSetPosition (position);
+  m_cachedPositionValid = false;
 }
 
 double 
 MobilityModel::GetDistanceFrom (Ptr<const MobilityModel> other) const
 {
-  Vector oPosition = other->DoGetPosition ();
-  Vector position = DoGetPosition ();
+  Vector oPosition = other->GetPosition ();
+  Vector position = GetPosition ();
   return CalculateDistance (position, oPosition);
 }
 
@@ -94,9 +123,16 @@ MobilityModel::GetRelativeSpeed (Ptr<const MobilityModel> other) const
 void
 MobilityModel::NotifyCourseChange (void) const
 {
+  m_cachedPositionValid = false;
   m_courseChangeTrace (this);
 }
 
+void
+MobilityModel::NotifyPositionChange (void) const
+{
+  m_cachedPositionValid = false;
+}
+
 int64_t
 MobilityModel::AssignStreams (int64_t start)
 {
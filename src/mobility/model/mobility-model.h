@@ -20,8 +20,10 @@
 #ifndef MOBILITY_MODEL_H
 #define MOBILITY_MODEL_H
 
+#include <vector>
 #include "ns3/vector.h"
 #include "ns3/object.h"
+#include "ns3/nstime.h"
 #include "ns3/traced-callback.h"
 
 namespace ns3 {
@@ -48,9 +50,20 @@ public:
   virtual ~MobilityModel () = 0;
 
   /**
+   * The position is computed by the concrete mobility model at most once per
+   * simulation time, until the course changes or the position is set.
+   *
    * \return the current position
    */
   Vector GetPosition (void) const;
+  /**
+   * Get the current positions of several mobility models.
+   *
+   * \param models the mobility models
+   * \param positions the positions of the mobility models, in the same order
+   */
+  static void GetPositions (const std::vector<Ptr<MobilityModel> > &models,
+                            std::vector<Vector> &positions);
   /**
    * \param position the position to set.
    */
@@ -92,7 +105,19 @@ protected:
    * position changes to notify course change listeners.
    */
   void NotifyCourseChange (void) const;
+  /**
+   * Must be invoked by subclasses when the current position changes
+   * without a course change being notified, so that the position is
+   * computed again by the next call to GetPosition.
+   */
+  void NotifyPositionChange (void) const;
 private:
+  /**
+   * \param now the current simulation time
+   * \return the current position, computed once per simulation time
+   */
+  Vector GetCachedPosition (const Time &now) const;
+
   /**
    * \return the current position.
    *
@@ -129,6 +154,10 @@ private:
    */
   ns3::TracedCallback<Ptr<const MobilityModel> > m_courseChangeTrace;
 
+  mutable Vector m_cachedPosition;     //!< position computed at m_cachedPositionTime
+  mutable Time m_cachedPositionTime;   //!< time when m_cachedPosition was computed
+  mutable bool m_cachedPositionValid;  //!< whether m_cachedPosition can be used
+
 };
 
 } // namespace ns3
@@ -97,6 +97,8 @@ WaypointMobilityModel::AddWaypoint (const Waypoint &waypoint)
     {
       Simulator::Schedule (waypoint.time - Simulator::Now (), &WaypointMobilityModel::Update, this);
     }
+  // the new waypoint may change the current position
+  NotifyPositionChange ();
 }
 Waypoint
 WaypointMobilityModel::GetNextWaypoint (void) const
@@ -206,6 +208,7 @@ WaypointMobilityModel::EndMobility (void)
   m_current.time = Time(std::numeric_limits<uint64_t>::infinity());
   m_next.time = m_current.time;
   m_first = true;
+  NotifyPositionChange ();
 }
 Vector
 WaypointMobilityModel::DoGetVelocity (void) const
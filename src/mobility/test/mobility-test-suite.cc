@@ -30,6 +30,7 @@
 #include "ns3/vector.h"
 #include "ns3/mobility-model.h"
 #include "ns3/waypoint-mobility-model.h"
+#include "ns3/constant-velocity-mobility-model.h"
 #include "ns3/mobility-helper.h"
 
 using namespace ns3;
@@ -410,6 +411,83 @@ WaypointMobilityModelViaHelper::DoRun (void)
   Simulator::Destroy ();
 }
 
+/**
+ * \ingroup mobility-test
+ * \ingroup tests
+ *
+ * \brief Test that the positions returned by GetPosition and GetPositions
+ * follow the changes of course and position made at the same time.
+ */
+class MobilityPositionCache : public TestCase
+{
+public:
+  MobilityPositionCache ();
+  virtual ~MobilityPositionCache ();
+
+private:
+  /**
+   * Check the positions, then change the course and position of the models
+   * and check the positions again.
+   * \param models the mobility models
+   */
+  void ChangeCourse (std::vector<Ptr<MobilityModel> > models);
+  virtual void DoRun (void);
+};
+
+MobilityPositionCache::MobilityPositionCache ()
+  : TestCase ("Test positions after course changes at the same time")
+{
+}
+
+MobilityPositionCache::~MobilityPositionCache ()
+{
+}
+
+void
+MobilityPositionCache::ChangeCourse (std::vector<Ptr<MobilityModel> > models)
+{
+  std::vector<Vector> positions;
+  MobilityModel::GetPositions (models, positions);
+  NS_TEST_ASSERT_MSG_EQ (positions.size (), 2, "Wrong number of positions");
+  NS_TEST_EXPECT_MSG_EQ_TOL (positions[0].x, 2, 0.001, "Wrong constant velocity position");
+  NS_TEST_EXPECT_MSG_EQ_TOL (positions[1].x, 10, 0.001, "Wrong waypoint position");
+
+  Ptr<ConstantVelocityMobilityModel> cv = DynamicCast<ConstantVelocityMobilityModel> (models[0]);
+  cv->SetVelocity (Vector (-1, 0, 0));
+  NS_TEST_EXPECT_MSG_EQ_TOL (cv->GetPosition ().x, 2, 0.001, "Position changed by a velocity change");
+  cv->SetPosition (Vector (5, 0, 0));
+  NS_TEST_EXPECT_MSG_EQ_TOL (cv->GetPosition ().x, 5, 0.001, "Position set not returned");
+
+  Ptr<WaypointMobilityModel> waypoint = DynamicCast<WaypointMobilityModel> (models[1]);
+  waypoint->EndMobility ();
+  waypoint->AddWaypoint (Waypoint (Simulator::Now (), Vector (30, 0, 0)));
+  MobilityModel::GetPositions (models, positions);
+  NS_TEST_EXPECT_MSG_EQ_TOL (positions[0].x, 5, 0.001, "Wrong constant velocity position");
+  NS_TEST_EXPECT_MSG_EQ_TOL (positions[1].x, 30, 0.001, "Waypoint added not taken into account");
+}
+
+void
+MobilityPositionCache::DoRun (void)
+{
+  Ptr<ConstantVelocityMobilityModel> cv = CreateObject<ConstantVelocityMobilityModel> ();
+  cv->SetPosition (Vector (0, 0, 0));
+  cv->SetVelocity (Vector (1, 0, 0));
+  Ptr<WaypointMobilityModel> waypoint = CreateObject<WaypointMobilityModel> ();
+  waypoint->AddWaypoint (Waypoint (Seconds (0), Vector (0, 0, 0)));
+  waypoint->AddWaypoint (Waypoint (Seconds (4), Vector (20, 0, 0)));
+  std::vector<Ptr<MobilityModel> > models;
+  models.push_back (cv);
+  models.push_back (waypoint);
+
+  std::vector<Vector> positions;
+  MobilityModel::GetPositions (models, positions);
+  NS_TEST_EXPECT_MSG_EQ_TOL (positions[0].x, 0, 0.001, "Wrong initial position");
+  NS_TEST_EXPECT_MSG_EQ_TOL (positions[1].x, 0, 0.001, "Wrong initial position");
+  Simulator::Schedule (Seconds (2), &MobilityPositionCache::ChangeCourse, this, models);
+  Simulator::Run ();
+  Simulator::Destroy ();
+}
+
 /**
  * \ingroup mobility-test
  * \ingroup tests
@@ -429,6 +507,7 @@ MobilityTestSuite::MobilityTestSuite ()
   AddTestCase (new WaypointLazyNotifyTrue, TestCase::QUICK);
   AddTestCase (new WaypointInitialPositionIsWaypoint, TestCase::QUICK);
   AddTestCase (new WaypointMobilityModelViaHelper, TestCase::QUICK);
+  AddTestCase (new MobilityPositionCache, TestCase::QUICK);
 }
 
 static MobilityTestSuite mobilityTestSuite; ///< the test suite
@@ -126,7 +126,9 @@ public:
     : TestCase (name),
       m_timeLimit (timeLimit),
       m_nodeCount (nodes),
-      m_nextRefPoint (0)
+      m_nextRefPoint (0),
+      m_streamingWindow (Seconds (0)),
+      m_binary (false)
   {
   }
   /// Empty
@@ -138,6 +140,16 @@ public:
   {
     m_trace = trace;
   }
+  /// Read the trace incrementally, with the given window
+  void SetStreamingWindow (Time window)
+  {
+    m_streamingWindow = window;
+  }
+  /// Convert the trace to the binary format before reading it
+  void SetBinary (bool binary)
+  {
+    m_binary = binary;
+  }
   /// Add next reference point
   void AddReferencePoint (ReferencePoint const & r)
   {
@@ -162,6 +174,10 @@ private:
   size_t m_nextRefPoint;
   /// TMP trace file name
   std::string m_traceFile;
+  /// Streaming window of the helper
+  Time m_streamingWindow;
+  /// Whether to read the trace in the binary format
+  bool m_binary;
 
 private:
   /// Dump NS-2 trace to tmp file
@@ -253,7 +269,14 @@ private:
       {
         return;
       }
-    Ns2MobilityHelper mobility (m_traceFile);
+    std::string traceFile = m_traceFile;
+    if (m_binary)
+      {
+        traceFile = CreateTempDirFilename ("Ns2MobilityHelperTest.bin");
+        Ns2MobilityHelper::ConvertToBinary (m_traceFile, traceFile);
+      }
+    Ns2MobilityHelper mobility (traceFile);
+    mobility.SetStreamingWindow (m_streamingWindow);
     mobility.Install ();
     if (CheckInitialPositions ())
       {
@@ -532,5 +555,78 @@ public:
     t->AddReferencePoint ("0", 920.000, Vector (300.000,  650.000, 0.000), Vector (0.000, 0.000, 0.000));
     AddTestCase (t, TestCase::QUICK);
 
+    // Same trace, read in time windows shorter than the movements
+    t = new Ns2MobilityHelperTest ("Bug 1316 testcase, streaming", Seconds (1000));
+    t->SetTrace ("$node_(0) set X_ 350.00000000000000\n"
+                 "$node_(0) set Y_ 50.00000000000000\n"
+                 "$ns_ at 50.00000000000000  \"$node_(0) setdest 400.00000000000000 50.00000000000000 1.00000000000000\"\n"
+                 "$ns_ at 150.00000000000000 \"$node_(0) setdest 400.00000000000000 150.00000000000000 4.00000000000000\"\n"
+                 "$ns_ at 300.00000000000000 \"$node_(0) setdest 250.00000000000000 150.00000000000000 3.00000000000000\"\n"
+                 "$ns_ at 350.00000000000000 \"$node_(0) setdest 250.00000000000000 50.00000000000000 1.00000000000000\"\n"
+                 "$ns_ at 600.00000000000000 \"$node_(0) setdest 250.00000000000000 1050.00000000000000 2.00000000000000\"\n"
+                 "$ns_ at 900.00000000000000 \"$node_(0) setdest 300.00000000000000 650.00000000000000 2.50000000000000\"\n"
+                 );
+    t->SetStreamingWindow (Seconds (40));
+    t->AddReferencePoint ("0", 0.000, Vector (350.000, 50.000, 0.000), Vector (0.000, 0.000, 0.000));
+    t->AddReferencePoint ("0", 50.000, Vector (350.000, 50.000, 0.000), Vector (1.000, 0.000, 0.000));
+    t->AddReferencePoint ("0", 100.000, Vector (400.000, 50.000, 0.000), Vector (0.000, 0.000, 0.000));
+    t->AddReferencePoint ("0", 150.000, Vector (400.000, 50.000, 0.000), Vector (0.000, 4.000, 0.000));
+    t->AddReferencePoint ("0", 175.000, Vector (400.000, 150.000, 0.000), Vector (0.000, 0.000, 0.000));
+    t->AddReferencePoint ("0", 300.000, Vector (400.000, 150.000, 0.000), Vector (-3.000, 0.000, 0.000));
+    t->AddReferencePoint ("0", 350.000, Vector (250.000, 150.000, 0.000), Vector (0.000, 0.000, 0.000));
+    t->AddReferencePoint ("0", 350.000, Vector (250.000, 150.000, 0.000), Vector (0.000, -1.000, 0.000));
+    t->AddReferencePoint ("0", 450.000, Vector (250.000,  50.000, 0.000), Vector (0.000, 0.000, 0.000));
+    t->AddReferencePoint ("0", 600.000, Vector (250.000,  50.000, 0.000), Vector (0.000, 2.000, 0.000));
+    t->AddReferencePoint ("0", 900.000, Vector (250.000,  650.000, 0.000), Vector (2.500, 0.000, 0.000));
+    t->AddReferencePoint ("0", 920.000, Vector (300.000,  650.000, 0.000), Vector (0.000, 0.000, 0.000));
+    AddTestCase (t, TestCase::QUICK);
+
+    // Scheduled set position, converted to the binary format and streamed
+    t = new Ns2MobilityHelperTest ("scheduled set position, binary streaming", Seconds (2));
+    t->SetTrace ("$ns_ at 1.0 \"$node_(0) set X_ 10\"\n"
+                 "$ns_ at 1.0 \"$node_(0) set Z_ 10\"\n"
+                 "$ns_ at 1.0 \"$node_(0) set Y_ 10\"");
+    t->SetBinary (true);
+    t->SetStreamingWindow (Seconds (0.25));
+    //                     id  t  position         velocity
+    t->AddReferencePoint ("0", 1, Vector (10, 0, 0), Vector (0, 0, 0));
+    t->AddReferencePoint ("0", 1, Vector (10, 0, 10), Vector (0, 0, 0));
+    t->AddReferencePoint ("0", 1, Vector (10, 10, 10), Vector (0, 0, 0));
+    AddTestCase (t, TestCase::QUICK);
+
+    // Trace written node by node, so not sorted by time, with interrupted
+    // movements, read at once, converted to the binary format, and
+    // converted and streamed
+    for (uint32_t mode = 0; mode < 3; ++mode)
+      {
+        std::string name = "nodes not sorted by time";
+        name += (mode == 0) ? "" : (mode == 1) ? ", binary" : ", binary streaming";
+        t = new Ns2MobilityHelperTest (name, Seconds (10), 2);
+        t->SetTrace ("$node_(1) set X_ 0.0\n"
+                     "$node_(1) set Y_ 10.0\n"
+                     "$ns_ at 0.5 \"$node_(1) setdest 0 16 2\"\n"
+                     "$ns_ at 2.5 \"$node_(1) setdest 4 14 1\"\n"
+                     "$ns_ at 1.0 \"$node_(0) setdest 10 0 5\"\n"
+                     "$ns_ at 4.0 \"$node_(0) setdest 10 3 1\"\n"
+                     "$node_(0) set X_ 0.0\n"
+                     "$node_(0) set Y_ 0.0\n");
+        t->SetBinary (mode > 0);
+        if (mode == 2)
+          {
+            t->SetStreamingWindow (Seconds (1));
+          }
+        //                     id  t    position           velocity
+        t->AddReferencePoint ("0", 0,   Vector (0, 0, 0),   Vector (0, 0, 0));
+        t->AddReferencePoint ("1", 0,   Vector (0, 10, 0),  Vector (0, 0, 0));
+        t->AddReferencePoint ("1", 0.5, Vector (0, 10, 0),  Vector (0, 2, 0));
+        t->AddReferencePoint ("0", 1,   Vector (0, 0, 0),   Vector (5, 0, 0));
+        t->AddReferencePoint ("1", 2.5, Vector (0, 14, 0),  Vector (1, 0, 0));
+        t->AddReferencePoint ("0", 3,   Vector (10, 0, 0),  Vector (0, 0, 0));
+        t->AddReferencePoint ("0", 4,   Vector (10, 0, 0),  Vector (0, 1, 0));
+        t->AddReferencePoint ("1", 6.5, Vector (4, 14, 0),  Vector (0, 0, 0));
+        t->AddReferencePoint ("0", 7,   Vector (10, 3, 0),  Vector (0, 0, 0));
+        AddTestCase (t, TestCase::QUICK);
+      }
+
   }
 } g_ns2TransmobilityHelperTestSuite; ///< the test suite
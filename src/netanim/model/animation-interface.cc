@@ -408,9 +408,9 @@ AnimationInterface::GetNodeEnergyFraction (Ptr <const Node> node) const
 void
 AnimationInterface::MobilityCourseChangeTrace (Ptr <const MobilityModel> mobility)
 {
-  CHECK_STARTED_INTIMEWINDOW;
   Ptr <Node> n = mobility->GetObject <Node> ();
   NS_ASSERT (n);
+  CHECK_STARTED_INTIMEWINDOW;
   Vector v;
   if (!mobility)
     {
@@ -473,6 +473,10 @@ AnimationInterface::GetMovedNodes ()
     {
       Ptr<Node> n = *i;
       NS_ASSERT (n);
+      if (n->GetId () < m_stationaryNodes.size () && m_stationaryNodes[n->GetId ()])
+        {
+          continue; // Position is updated by MobilityCourseChangeTrace
+        }
       Ptr <MobilityModel> mobility = n->GetObject <MobilityModel> ();
       Vector newLocation;
       if (!mobility)
@@ -587,19 +591,6 @@ AnimationInterface::GetNodeFromContext (const std::string& context) const
   return n;
 }
 
-Ptr <NetDevice>
-AnimationInterface::GetNetDeviceFromContext (std::string context)
-{
-  // Use "NodeList/*/DeviceList/*/ as reference
-  // where element [1] is the Node Id
-  // element [2] is the NetDevice Id
-
-  std::vector <std::string> elements = GetElementsFromContext (context);
-  Ptr <Node> n = GetNodeFromContext (context);
-
-  return n->GetDevice (atoi (elements.at (3).c_str ()));
-}
-
 uint64_t
 AnimationInterface::GetAnimUidFromPacket (Ptr <const Packet> p)
 {
@@ -635,11 +626,10 @@ AnimationInterface::AddByteTag (uint64_t animUid, Ptr<const Packet> p)
 }
 
 void
-AnimationInterface::RemainingEnergyTrace (std::string context, double previousEnergy, double currentEnergy)
+AnimationInterface::RemainingEnergyTrace (uint32_t nodeId, double previousEnergy, double currentEnergy)
 {
   CHECK_STARTED_INTIMEWINDOW;
-  const Ptr <const Node> node = GetNodeFromContext (context);
-  const uint32_t nodeId = node->GetId ();
+  const Ptr <const Node> node = NodeList::GetNode (nodeId);
 
   NS_LOG_INFO ("Remaining energy on one of sources on node " << nodeId << ": " << currentEnergy);
 
@@ -656,128 +646,107 @@ AnimationInterface::RemainingEnergyTrace (std::string context, double previousEn
 }
 
 void
-AnimationInterface::WifiPhyTxDropTrace (std::string context, Ptr<const Packet> p)
+AnimationInterface::WifiPhyTxDropTrace (uint32_t nodeId, Ptr<const Packet> p)
 {
-  const Ptr <const Node> node = GetNodeFromContext (context);
-  ++m_nodeWifiPhyTxDrop[node->GetId ()];
+  ++m_nodeWifiPhyTxDrop[nodeId];
 }
 
 void
-AnimationInterface::WifiPhyRxDropTrace (std::string context, Ptr<const Packet> p, WifiPhyRxfailureReason reason)
+AnimationInterface::WifiPhyRxDropTrace (uint32_t nodeId, Ptr<const Packet> p, WifiPhyRxfailureReason reason)
 {
-  const Ptr <const Node> node = GetNodeFromContext (context);
-  ++m_nodeWifiPhyRxDrop[node->GetId ()];
+  ++m_nodeWifiPhyRxDrop[nodeId];
 }
 
 void
-AnimationInterface::WifiMacTxTrace (std::string context, Ptr<const Packet> p)
+AnimationInterface::WifiMacTxTrace (uint32_t nodeId, Ptr<const Packet> p)
 {
-  const Ptr <const Node> node = GetNodeFromContext (context);
-  ++m_nodeWifiMacTx[node->GetId ()];
+  ++m_nodeWifiMacTx[nodeId];
 }
 
 void
-AnimationInterface::WifiMacTxDropTrace (std::string context, Ptr<const Packet> p)
+AnimationInterface::WifiMacTxDropTrace (uint32_t nodeId, Ptr<const Packet> p)
 {
-  const Ptr <const Node> node = GetNodeFromContext (context);
-  ++m_nodeWifiMacTxDrop[node->GetId ()];
+  ++m_nodeWifiMacTxDrop[nodeId];
 }
 
 void
-AnimationInterface::WifiMacRxTrace (std::string context, Ptr<const Packet> p)
+AnimationInterface::WifiMacRxTrace (uint32_t nodeId, Ptr<const Packet> p)
 {
-  const Ptr <const Node> node = GetNodeFromContext (context);
-  ++m_nodeWifiMacRx[node->GetId ()];
+  ++m_nodeWifiMacRx[nodeId];
 }
 
 void
-AnimationInterface::WifiMacRxDropTrace (std::string context, Ptr<const Packet> p)
+AnimationInterface::WifiMacRxDropTrace (uint32_t nodeId, Ptr<const Packet> p)
 {
-  const Ptr <const Node> node = GetNodeFromContext (context);
-  ++m_nodeWifiMacRxDrop[node->GetId ()];
+  ++m_nodeWifiMacRxDrop[nodeId];
 }
 
 void
-AnimationInterface::LrWpanMacTxTrace (std::string context, Ptr<const Packet> p)
+AnimationInterface::LrWpanMacTxTrace (uint32_t nodeId, Ptr<const Packet> p)
 {
-  const Ptr <const Node> node = GetNodeFromContext (context);
-  ++m_nodeLrWpanMacTx[node->GetId ()];
+  ++m_nodeLrWpanMacTx[nodeId];
 }
 
 void
-AnimationInterface::LrWpanMacTxDropTrace (std::string context, Ptr<const Packet> p)
+AnimationInterface::LrWpanMacTxDropTrace (uint32_t nodeId, Ptr<const Packet> p)
 {
-  const Ptr <const Node> node = GetNodeFromContext (context);
-  ++m_nodeLrWpanMacTxDrop[node->GetId ()];
+  ++m_nodeLrWpanMacTxDrop[nodeId];
 }
 
 void
-AnimationInterface::LrWpanMacRxTrace (std::string context, Ptr<const Packet> p)
+AnimationInterface::LrWpanMacRxTrace (uint32_t nodeId, Ptr<const Packet> p)
 {
-  const Ptr <const Node> node = GetNodeFromContext (context);
-  ++m_nodeLrWpanMacRx[node->GetId ()];
+  ++m_nodeLrWpanMacRx[nodeId];
 }
 
 void
-AnimationInterface::LrWpanMacRxDropTrace (std::string context, Ptr<const Packet> p)
+AnimationInterface::LrWpanMacRxDropTrace (uint32_t nodeId, Ptr<const Packet> p)
 {
-  const Ptr <const Node> node = GetNodeFromContext (context);
-  ++m_nodeLrWpanMacRxDrop[node->GetId ()];
+  ++m_nodeLrWpanMacRxDrop[nodeId];
 }
 
 void
-AnimationInterface::Ipv4TxTrace (std::string context, Ptr<const Packet> p, Ptr<Ipv4> ipv4, uint32_t interfaceIndex)
+AnimationInterface::Ipv4TxTrace (uint32_t nodeId, Ptr<const Packet> p, Ptr<Ipv4> ipv4, uint32_t interfaceIndex)
 {
-  const Ptr <const Node> node = GetNodeFromContext (context);
-  ++m_nodeIpv4Tx[node->GetId ()];
+  ++m_nodeIpv4Tx[nodeId];
 }
 
 void
-AnimationInterface::Ipv4RxTrace (std::string context, Ptr<const Packet> p, Ptr<Ipv4> ipv4, uint32_t interfaceIndex)
+AnimationInterface::Ipv4RxTrace (uint32_t nodeId, Ptr<const Packet> p, Ptr<Ipv4> ipv4, uint32_t interfaceIndex)
 {
-  const Ptr <const Node> node = GetNodeFromContext (context);
-  ++m_nodeIpv4Rx[node->GetId ()];
+  ++m_nodeIpv4Rx[nodeId];
 }
 
 void
-AnimationInterface::Ipv4DropTrace (std::string context,
-                                   const Ipv4Header & ipv4Header,
+AnimationInterface::Ipv4DropTrace (uint32_t nodeId, const Ipv4Header & ipv4Header,
                                    Ptr<const Packet> p,
                                    Ipv4L3Protocol::DropReason dropReason,
                                    Ptr<Ipv4> ipv4,
                                    uint32_t)
 {
-  const Ptr <const Node> node = GetNodeFromContext (context);
-  ++m_nodeIpv4Drop[node->GetId ()];
+  ++m_nodeIpv4Drop[nodeId];
 }
 
 void
-AnimationInterface::EnqueueTrace (std::string context,
-                                  Ptr<const Packet> p)
+AnimationInterface::EnqueueTrace (uint32_t nodeId, Ptr<const Packet> p)
 {
-  const Ptr <const Node> node = GetNodeFromContext (context);
-  ++m_nodeQueueEnqueue[node->GetId ()];
+  ++m_nodeQueueEnqueue[nodeId];
 }
 
 void
-AnimationInterface::DequeueTrace (std::string context,
-                                  Ptr<const Packet> p)
+AnimationInterface::DequeueTrace (uint32_t nodeId, Ptr<const Packet> p)
 {
-  const Ptr <const Node> node = GetNodeFromContext (context);
-  ++m_nodeQueueDequeue[node->GetId ()];
+  ++m_nodeQueueDequeue[nodeId];
 }
 
 void
-AnimationInterface::QueueDropTrace (std::string context,
-                                    Ptr<const Packet> p)
+AnimationInterface::QueueDropTrace (uint32_t nodeId, Ptr<const Packet> p)
 {
-  const Ptr <const Node> node = GetNodeFromContext (context);
-  ++m_nodeQueueDrop[node->GetId ()];
+  ++m_nodeQueueDrop[nodeId];
 }
 
 void
-AnimationInterface::DevTxTrace (std::string context,
-                                Ptr<const Packet> p,
+AnimationInterface::DevTxTrace (Ptr<const Packet> p,
                                 Ptr<NetDevice> tx,
                                 Ptr<NetDevice> rx,
                                 Time txTime,
@@ -804,11 +773,11 @@ AnimationInterface::DevTxTrace (std::string context,
 }
 
 void
-AnimationInterface::GenericWirelessTxTrace (std::string context, Ptr<const Packet> p, ProtocolType protocolType)
+AnimationInterface::GenericWirelessTxTrace (uint32_t nodeId, uint32_t deviceId, Ptr<const Packet> p, ProtocolType protocolType)
 {
   NS_LOG_FUNCTION (this);
   CHECK_STARTED_INTIMEWINDOW_TRACKPACKETS;
-  Ptr <NetDevice> ndev = GetNetDeviceFromContext (context);
+  Ptr <NetDevice> ndev = NodeList::GetNode (nodeId)->GetDevice (deviceId);
   NS_ASSERT (ndev);
   UpdatePosition (ndev);
 
@@ -834,11 +803,11 @@ AnimationInterface::GenericWirelessTxTrace (std::string context, Ptr<const Packe
 }
 
 void
-AnimationInterface::GenericWirelessRxTrace (std::string context, Ptr<const Packet> p, ProtocolType protocolType)
+AnimationInterface::GenericWirelessRxTrace (uint32_t nodeId, uint32_t deviceId, Ptr<const Packet> p, ProtocolType protocolType)
 {
   NS_LOG_FUNCTION (this);
   CHECK_STARTED_INTIMEWINDOW_TRACKPACKETS;
-  Ptr <NetDevice> ndev = GetNetDeviceFromContext (context);
+  Ptr <NetDevice> ndev = NodeList::GetNode (nodeId)->GetDevice (deviceId);
   NS_ASSERT (ndev);
   UpdatePosition (ndev);
   uint64_t animUid = GetAnimUidFromPacket (p);
@@ -854,26 +823,26 @@ AnimationInterface::GenericWirelessRxTrace (std::string context, Ptr<const Packe
 }
 
 void
-AnimationInterface::UanPhyGenTxTrace (std::string context, Ptr<const Packet> p)
+AnimationInterface::UanPhyGenTxTrace (uint32_t nodeId, uint32_t deviceId, Ptr<const Packet> p)
 {
   NS_LOG_FUNCTION (this);
-  return GenericWirelessTxTrace (context, p, AnimationInterface::UAN);
+  return GenericWirelessTxTrace (nodeId, deviceId, p, AnimationInterface::UAN);
 }
 
 void
-AnimationInterface::UanPhyGenRxTrace (std::string context, Ptr<const Packet> p)
+AnimationInterface::UanPhyGenRxTrace (uint32_t nodeId, uint32_t deviceId, Ptr<const Packet> p)
 {
   NS_LOG_FUNCTION (this);
-  return GenericWirelessRxTrace (context, p, AnimationInterface::UAN);
+  return GenericWirelessRxTrace (nodeId, deviceId, p, AnimationInterface::UAN);
 }
 
 void
-AnimationInterface::WifiPhyTxBeginTrace (std::string context, WifiConstPsduMap psduMap, WifiTxVector txVector, double txPowerW)
+AnimationInterface::WifiPhyTxBeginTrace (uint32_t nodeId, uint32_t deviceId, WifiConstPsduMap psduMap, WifiTxVector txVector, double txPowerW)
 {
   NS_LOG_FUNCTION (this);
   NS_UNUSED (txVector);
   CHECK_STARTED_INTIMEWINDOW_TRACKPACKETS;
-  Ptr<NetDevice> ndev = GetNetDeviceFromContext (context);
+  Ptr<NetDevice> ndev = NodeList::GetNode (nodeId)->GetDevice (deviceId);
   NS_ASSERT (ndev);
   UpdatePosition (ndev);
 
@@ -909,11 +878,11 @@ AnimationInterface::WifiPhyTxBeginTrace (std::string context, WifiConstPsduMap p
 }
 
 void
-AnimationInterface::WifiPhyRxBeginTrace (std::string context, Ptr<const Packet> p, RxPowerWattPerChannelBand rxPowersW)
+AnimationInterface::WifiPhyRxBeginTrace (uint32_t nodeId, uint32_t deviceId, Ptr<const Packet> p, RxPowerWattPerChannelBand rxPowersW)
 {
   NS_LOG_FUNCTION (this);
   CHECK_STARTED_INTIMEWINDOW_TRACKPACKETS;
-  Ptr <NetDevice> ndev = GetNetDeviceFromContext (context);
+  Ptr <NetDevice> ndev = NodeList::GetNode (nodeId)->GetDevice (deviceId);
   NS_ASSERT (ndev);
   UpdatePosition (ndev);
   uint64_t animUid = GetAnimUidFromPacket (p);
@@ -946,13 +915,12 @@ AnimationInterface::WifiPhyRxBeginTrace (std::string context, Ptr<const Packet>
 }
 
 void
-AnimationInterface::LrWpanPhyTxBeginTrace (std::string context,
-                                           Ptr<const Packet> p)
+AnimationInterface::LrWpanPhyTxBeginTrace (uint32_t nodeId, uint32_t deviceId, Ptr<const Packet> p)
 {
   NS_LOG_FUNCTION (this);
   CHECK_STARTED_INTIMEWINDOW_TRACKPACKETS;
 
-  Ptr <NetDevice> ndev = GetNetDeviceFromContext (context);
+  Ptr <NetDevice> ndev = NodeList::GetNode (nodeId)->GetDevice (deviceId);
   NS_ASSERT (ndev);
   Ptr<LrWpanNetDevice> netDevice = DynamicCast<LrWpanNetDevice> (ndev);
 
@@ -998,12 +966,11 @@ AnimationInterface::LrWpanPhyTxBeginTrace (std::string context,
 }
 
 void
-AnimationInterface::LrWpanPhyRxBeginTrace (std::string context,
-                                           Ptr<const Packet> p)
+AnimationInterface::LrWpanPhyRxBeginTrace (uint32_t nodeId, uint32_t deviceId, Ptr<const Packet> p)
 {
   NS_LOG_FUNCTION (this);
   CHECK_STARTED_INTIMEWINDOW_TRACKPACKETS;
-  Ptr <NetDevice> ndev = GetNetDeviceFromContext (context);
+  Ptr <NetDevice> ndev = NodeList::GetNode (nodeId)->GetDevice (deviceId);
   NS_ASSERT (ndev);
   Ptr <Node> n = ndev->GetNode ();
   NS_ASSERT (n);
@@ -1027,18 +994,18 @@ AnimationInterface::LrWpanPhyRxBeginTrace (std::string context,
 }
 
 void
-AnimationInterface::WavePhyTxBeginTrace (std::string context, Ptr<const Packet> p)
+AnimationInterface::WavePhyTxBeginTrace (uint32_t nodeId, uint32_t deviceId, Ptr<const Packet> p)
 {
   NS_LOG_FUNCTION (this);
-  return GenericWirelessTxTrace (context, p, AnimationInterface::WAVE);
+  return GenericWirelessTxTrace (nodeId, deviceId, p, AnimationInterface::WAVE);
 }
 
 void
-AnimationInterface::WavePhyRxBeginTrace (std::string context, Ptr<const Packet> p)
+AnimationInterface::WavePhyRxBeginTrace (uint32_t nodeId, uint32_t deviceId, Ptr<const Packet> p)
 {
   NS_LOG_FUNCTION (this);
   CHECK_STARTED_INTIMEWINDOW_TRACKPACKETS;
-  Ptr <NetDevice> ndev = GetNetDeviceFromContext (context);
+  Ptr <NetDevice> ndev = NodeList::GetNode (nodeId)->GetDevice (deviceId);
   NS_ASSERT (ndev);
   UpdatePosition (ndev);
   uint64_t animUid = GetAnimUidFromPacket (p);
@@ -1072,36 +1039,36 @@ AnimationInterface::WavePhyRxBeginTrace (std::string context, Ptr<const Packet>
 
 
 void
-AnimationInterface::WimaxTxTrace (std::string context, Ptr<const Packet> p, const Mac48Address & m)
+AnimationInterface::WimaxTxTrace (uint32_t nodeId, uint32_t deviceId, Ptr<const Packet> p, const Mac48Address & m)
 {
   NS_LOG_FUNCTION (this);
-  return GenericWirelessTxTrace (context, p, AnimationInterface::WIMAX);
+  return GenericWirelessTxTrace (nodeId, deviceId, p, AnimationInterface::WIMAX);
 }
 
 
 void
-AnimationInterface::WimaxRxTrace (std::string context, Ptr<const Packet> p, const Mac48Address & m)
+AnimationInterface::WimaxRxTrace (uint32_t nodeId, uint32_t deviceId, Ptr<const Packet> p, const Mac48Address & m)
 {
   NS_LOG_FUNCTION (this);
-  return GenericWirelessRxTrace (context, p, AnimationInterface::WIMAX);
+  return GenericWirelessRxTrace (nodeId, deviceId, p, AnimationInterface::WIMAX);
 }
 
 void
-AnimationInterface::LteTxTrace (std::string context, Ptr<const Packet> p, const Mac48Address & m)
+AnimationInterface::LteTxTrace (uint32_t nodeId, uint32_t deviceId, Ptr<const Packet> p, const Mac48Address & m)
 {
   NS_LOG_FUNCTION (this);
-  return GenericWirelessTxTrace (context, p, AnimationInterface::LTE);
+  return GenericWirelessTxTrace (nodeId, deviceId, p, AnimationInterface::LTE);
 }
 
 void
-AnimationInterface::LteRxTrace (std::string context, Ptr<const Packet> p, const Mac48Address & m)
+AnimationInterface::LteRxTrace (uint32_t nodeId, uint32_t deviceId, Ptr<const Packet> p, const Mac48Address & m)
 {
   NS_LOG_FUNCTION (this);
-  return GenericWirelessRxTrace (context, p, AnimationInterface::LTE);
+  return GenericWirelessRxTrace (nodeId, deviceId, p, AnimationInterface::LTE);
 }
 
 void
-AnimationInterface::LteSpectrumPhyTxStart (std::string context, Ptr<const PacketBurst> pb)
+AnimationInterface::LteSpectrumPhyTxStart (uint32_t nodeId, uint32_t deviceId, Ptr<const PacketBurst> pb)
 {
   NS_LOG_FUNCTION (this);
   CHECK_STARTED_INTIMEWINDOW_TRACKPACKETS;
@@ -1110,8 +1077,7 @@ AnimationInterface::LteSpectrumPhyTxStart (std::string context, Ptr<const Packet
       NS_LOG_WARN ("pb == 0. Not yet supported");
       return;
     }
-  context = "/" + context;
-  Ptr <NetDevice> ndev = GetNetDeviceFromContext (context);
+  Ptr <NetDevice> ndev = NodeList::GetNode (nodeId)->GetDevice (deviceId);
   NS_ASSERT (ndev);
   UpdatePosition (ndev);
 
@@ -1131,7 +1097,7 @@ AnimationInterface::LteSpectrumPhyTxStart (std::string context, Ptr<const Packet
 }
 
 void
-AnimationInterface::LteSpectrumPhyRxStart (std::string context, Ptr<const PacketBurst> pb)
+AnimationInterface::LteSpectrumPhyRxStart (uint32_t nodeId, uint32_t deviceId, Ptr<const PacketBurst> pb)
 {
   NS_LOG_FUNCTION (this);
   CHECK_STARTED_INTIMEWINDOW_TRACKPACKETS;
@@ -1140,8 +1106,7 @@ AnimationInterface::LteSpectrumPhyRxStart (std::string context, Ptr<const Packet
       NS_LOG_WARN ("pb == 0. Not yet supported");
       return;
     }
-  context = "/" + context;
-  Ptr <NetDevice> ndev = GetNetDeviceFromContext (context);
+  Ptr <NetDevice> ndev = NodeList::GetNode (nodeId)->GetDevice (deviceId);
   NS_ASSERT (ndev);
   UpdatePosition (ndev);
 
@@ -1165,11 +1130,11 @@ AnimationInterface::LteSpectrumPhyRxStart (std::string context, Ptr<const Packet
 }
 
 void
-AnimationInterface::CsmaPhyTxBeginTrace (std::string context, Ptr<const Packet> p)
+AnimationInterface::CsmaPhyTxBeginTrace (uint32_t nodeId, uint32_t deviceId, Ptr<const Packet> p)
 {
   NS_LOG_FUNCTION (this);
   CHECK_STARTED_INTIMEWINDOW_TRACKPACKETS;
-  Ptr <NetDevice> ndev = GetNetDeviceFromContext (context);
+  Ptr <NetDevice> ndev = NodeList::GetNode (nodeId)->GetDevice (deviceId);
   NS_ASSERT (ndev);
   UpdatePosition (ndev);
   ++gAnimUid;
@@ -1183,11 +1148,11 @@ AnimationInterface::CsmaPhyTxBeginTrace (std::string context, Ptr<const Packet>
 }
 
 void
-AnimationInterface::CsmaPhyTxEndTrace (std::string context, Ptr<const Packet> p)
+AnimationInterface::CsmaPhyTxEndTrace (uint32_t nodeId, uint32_t deviceId, Ptr<const Packet> p)
 {
   NS_LOG_FUNCTION (this);
   CHECK_STARTED_INTIMEWINDOW_TRACKPACKETS;
-  Ptr <NetDevice> ndev = GetNetDeviceFromContext (context);
+  Ptr <NetDevice> ndev = NodeList::GetNode (nodeId)->GetDevice (deviceId);
   NS_ASSERT (ndev);
   UpdatePosition (ndev);
   uint64_t animUid = GetAnimUidFromPacket (p);
@@ -1206,11 +1171,11 @@ AnimationInterface::CsmaPhyTxEndTrace (std::string context, Ptr<const Packet> p)
 }
 
 void
-AnimationInterface::CsmaPhyRxEndTrace (std::string context, Ptr<const Packet> p)
+AnimationInterface::CsmaPhyRxEndTrace (uint32_t nodeId, uint32_t deviceId, Ptr<const Packet> p)
 {
   NS_LOG_FUNCTION (this);
   CHECK_STARTED_INTIMEWINDOW_TRACKPACKETS;
-  Ptr <NetDevice> ndev = GetNetDeviceFromContext (context);
+  Ptr <NetDevice> ndev = NodeList::GetNode (nodeId)->GetDevice (deviceId);
   NS_ASSERT (ndev);
   UpdatePosition (ndev);
   uint64_t animUid = GetAnimUidFromPacket (p);
@@ -1228,12 +1193,11 @@ AnimationInterface::CsmaPhyRxEndTrace (std::string context, Ptr<const Packet> p)
 }
 
 void
-AnimationInterface::CsmaMacRxTrace (std::string context,
-                                    Ptr<const Packet> p)
+AnimationInterface::CsmaMacRxTrace (uint32_t nodeId, uint32_t deviceId, Ptr<const Packet> p)
 {
   NS_LOG_FUNCTION (this);
   CHECK_STARTED_INTIMEWINDOW_TRACKPACKETS;
-  Ptr <NetDevice> ndev = GetNetDeviceFromContext (context);
+  Ptr <NetDevice> ndev = NodeList::GetNode (nodeId)->GetDevice (deviceId);
   NS_ASSERT (ndev);
   uint64_t animUid = GetAnimUidFromPacket (p);
   if (!IsPacketPending (animUid, AnimationInterface::CSMA))
@@ -1554,18 +1518,15 @@ AnimationInterface::ConnectLteEnb (Ptr <Node> n, Ptr <LteEnbNetDevice> nd, uint3
   Ptr<LteEnbPhy> lteEnbPhy = nd->GetPhy ();
   Ptr<LteSpectrumPhy> dlPhy = lteEnbPhy->GetDownlinkSpectrumPhy ();
   Ptr<LteSpectrumPhy> ulPhy = lteEnbPhy->GetUplinkSpectrumPhy ();
-  std::ostringstream oss;
-  //NodeList/*/DeviceList/*/
-  oss << "NodeList/" << n->GetId () << "/DeviceList/" << devIndex << "/";
   if (dlPhy)
     {
-      dlPhy->TraceConnect ("TxStart", oss.str (), MakeCallback (&AnimationInterface::LteSpectrumPhyTxStart, this));
-      dlPhy->TraceConnect ("RxStart", oss.str (), MakeCallback (&AnimationInterface::LteSpectrumPhyRxStart, this));
+      dlPhy->TraceConnectWithoutContext ("TxStart", MakeCallback (&AnimationInterface::LteSpectrumPhyTxStart, this).TwoBind (n->GetId (), devIndex));
+      dlPhy->TraceConnectWithoutContext ("RxStart", MakeCallback (&AnimationInterface::LteSpectrumPhyRxStart, this).TwoBind (n->GetId (), devIndex));
     }
   if (ulPhy)
     {
-      ulPhy->TraceConnect ("TxStart", oss.str (), MakeCallback (&AnimationInterface::LteSpectrumPhyTxStart, this));
-      ulPhy->TraceConnect ("RxStart", oss.str (), MakeCallback (&AnimationInterface::LteSpectrumPhyRxStart, this));
+      ulPhy->TraceConnectWithoutContext ("TxStart", MakeCallback (&AnimationInterface::LteSpectrumPhyTxStart, this).TwoBind (n->GetId (), devIndex));
+      ulPhy->TraceConnectWithoutContext ("RxStart", MakeCallback (&AnimationInterface::LteSpectrumPhyRxStart, this).TwoBind (n->GetId (), devIndex));
     }
 }
 
@@ -1578,18 +1539,15 @@ AnimationInterface::ConnectLteUe (Ptr <Node> n, Ptr <LteUeNetDevice> nd, uint32_
   Ptr<LteUePhy> lteUePhy = nd->GetPhy ();
   Ptr<LteSpectrumPhy> dlPhy = lteUePhy->GetDownlinkSpectrumPhy ();
   Ptr<LteSpectrumPhy> ulPhy = lteUePhy->GetUplinkSpectrumPhy ();
-  std::ostringstream oss;
-  //NodeList/*/DeviceList/*/
-  oss << "NodeList/" << n->GetId () << "/DeviceList/" << devIndex << "/";
   if (dlPhy)
     {
-      dlPhy->TraceConnect ("TxStart", oss.str (), MakeCallback (&AnimationInterface::LteSpectrumPhyTxStart, this));
-      dlPhy->TraceConnect ("RxStart", oss.str (), MakeCallback (&AnimationInterface::LteSpectrumPhyRxStart, this));
+      dlPhy->TraceConnectWithoutContext ("TxStart", MakeCallback (&AnimationInterface::LteSpectrumPhyTxStart, this).TwoBind (n->GetId (), devIndex));
+      dlPhy->TraceConnectWithoutContext ("RxStart", MakeCallback (&AnimationInterface::LteSpectrumPhyRxStart, this).TwoBind (n->GetId (), devIndex));
     }
   if (ulPhy)
     {
-      ulPhy->TraceConnect ("TxStart", oss.str (), MakeCallback (&AnimationInterface::LteSpectrumPhyTxStart, this));
-      ulPhy->TraceConnect ("RxStart", oss.str (), MakeCallback (&AnimationInterface::LteSpectrumPhyRxStart, this));
+      ulPhy->TraceConnectWithoutContext ("TxStart", MakeCallback (&AnimationInterface::LteSpectrumPhyTxStart, this).TwoBind (n->GetId (), devIndex));
+      ulPhy->TraceConnectWithoutContext ("RxStart", MakeCallback (&AnimationInterface::LteSpectrumPhyRxStart, this).TwoBind (n->GetId (), devIndex));
     }
 }
 
@@ -1625,113 +1583,156 @@ AnimationInterface::ConnectLte ()
     }
 }
 
+template <typename CB>
+void
+AnimationInterface::ConnectNodeTrace (std::string path, CB cb)
+{
+  std::size_t pos = path.rfind ('/');
+  std::string traceSource = path.substr (pos + 1);
+  Config::MatchContainer matches = Config::LookupMatches (path.substr (0, pos));
+  for (std::size_t i = 0; i < matches.GetN (); ++i)
+    {
+      // "/NodeList/[i]/..."
+      std::vector <std::string> elements = GetElementsFromContext (matches.GetMatchedPath (i));
+      uint32_t nodeId = atoi (elements.at (1).c_str ());
+      matches.Get (i)->TraceConnectWithoutContext (traceSource, cb.Bind (nodeId));
+    }
+}
+
+template <typename CB>
+void
+AnimationInterface::ConnectNetDeviceTrace (std::string path, CB cb)
+{
+  std::size_t pos = path.rfind ('/');
+  std::string traceSource = path.substr (pos + 1);
+  Config::MatchContainer matches = Config::LookupMatches (path.substr (0, pos));
+  for (std::size_t i = 0; i < matches.GetN (); ++i)
+    {
+      // "/NodeList/[i]/DeviceList/[j]/..."
+      std::vector <std::string> elements = GetElementsFromContext (matches.GetMatchedPath (i));
+      uint32_t nodeId = atoi (elements.at (1).c_str ());
+      uint32_t deviceId = atoi (elements.at (3).c_str ());
+      matches.Get (i)->TraceConnectWithoutContext (traceSource, cb.TwoBind (nodeId, deviceId));
+    }
+}
+
 void
 AnimationInterface::ConnectCallbacks ()
 {
+  // nodes with a constant position only move through course changes
+  m_stationaryNodes.assign (NodeList::GetNNodes (), false);
+  for (NodeList::Iterator i = NodeList::Begin (); i != NodeList::End (); ++i)
+    {
+      if (DynamicCast <ConstantPositionMobilityModel> ((*i)->GetObject <MobilityModel> ()))
+        {
+          m_stationaryNodes[(*i)->GetId ()] = true;
+        }
+    }
+
   // Connect the callbacks
-  Config::ConnectFailSafe ("/ChannelList/*/TxRxPointToPoint",
-                           MakeCallback (&AnimationInterface::DevTxTrace, this));
-  Config::ConnectFailSafe ("/NodeList/*/DeviceList/*/$ns3::WifiNetDevice/Phy/PhyTxPsduBegin",
-                           MakeCallback (&AnimationInterface::WifiPhyTxBeginTrace, this));
-  Config::ConnectFailSafe ("/NodeList/*/DeviceList/*/$ns3::WifiNetDevice/Phy/PhyRxBegin",
-                           MakeCallback (&AnimationInterface::WifiPhyRxBeginTrace, this));
+  Config::ConnectWithoutContextFailSafe ("/ChannelList/*/TxRxPointToPoint",
+                                         MakeCallback (&AnimationInterface::DevTxTrace, this));
+  ConnectNetDeviceTrace ("/NodeList/*/DeviceList/*/$ns3::WifiNetDevice/Phy/PhyTxPsduBegin",
+                         MakeCallback (&AnimationInterface::WifiPhyTxBeginTrace, this));
+  ConnectNetDeviceTrace ("/NodeList/*/DeviceList/*/$ns3::WifiNetDevice/Phy/PhyRxBegin",
+                         MakeCallback (&AnimationInterface::WifiPhyRxBeginTrace, this));
   Config::ConnectWithoutContextFailSafe ("/NodeList/*/$ns3::MobilityModel/CourseChange",
                                          MakeCallback (&AnimationInterface::MobilityCourseChangeTrace, this));
-  Config::ConnectFailSafe ("/NodeList/*/DeviceList/*/$ns3::WimaxNetDevice/Tx",
-                           MakeCallback (&AnimationInterface::WimaxTxTrace, this));
-  Config::ConnectFailSafe ("/NodeList/*/DeviceList/*/$ns3::WimaxNetDevice/Rx",
-                           MakeCallback (&AnimationInterface::WimaxRxTrace, this));
-  Config::ConnectFailSafe ("/NodeList/*/DeviceList/*/$ns3::LteNetDevice/Tx",
-                           MakeCallback (&AnimationInterface::LteTxTrace, this));
-  Config::ConnectFailSafe ("/NodeList/*/DeviceList/*/$ns3::LteNetDevice/Rx",
-                           MakeCallback (&AnimationInterface::LteRxTrace, this));
-  Config::ConnectFailSafe ("/NodeList/*/DeviceList/*/$ns3::CsmaNetDevice/PhyTxBegin",
-                           MakeCallback (&AnimationInterface::CsmaPhyTxBeginTrace, this));
-  Config::ConnectFailSafe ("/NodeList/*/DeviceList/*/$ns3::CsmaNetDevice/PhyTxEnd",
-                           MakeCallback (&AnimationInterface::CsmaPhyTxEndTrace, this));
-  Config::ConnectFailSafe ("/NodeList/*/DeviceList/*/$ns3::CsmaNetDevice/PhyRxEnd",
-                           MakeCallback (&AnimationInterface::CsmaPhyRxEndTrace, this));
-  Config::ConnectFailSafe ("/NodeList/*/DeviceList/*/$ns3::CsmaNetDevice/MacRx",
-                           MakeCallback (&AnimationInterface::CsmaMacRxTrace, this));
-  Config::ConnectFailSafe ("/NodeList/*/DeviceList/*/$ns3::UanNetDevice/Phy/PhyTxBegin",
-                           MakeCallback (&AnimationInterface::UanPhyGenTxTrace, this));
-  Config::ConnectFailSafe ("/NodeList/*/DeviceList/*/$ns3::UanNetDevice/Phy/PhyRxBegin",
-                           MakeCallback (&AnimationInterface::UanPhyGenRxTrace, this));
-  Config::ConnectFailSafe ("/NodeList/*/$ns3::BasicEnergySource/RemainingEnergy",
-                           MakeCallback (&AnimationInterface::RemainingEnergyTrace, this));
+  ConnectNetDeviceTrace ("/NodeList/*/DeviceList/*/$ns3::WimaxNetDevice/Tx",
+                         MakeCallback (&AnimationInterface::WimaxTxTrace, this));
+  ConnectNetDeviceTrace ("/NodeList/*/DeviceList/*/$ns3::WimaxNetDevice/Rx",
+                         MakeCallback (&AnimationInterface::WimaxRxTrace, this));
+  ConnectNetDeviceTrace ("/NodeList/*/DeviceList/*/$ns3::LteNetDevice/Tx",
+                         MakeCallback (&AnimationInterface::LteTxTrace, this));
+  ConnectNetDeviceTrace ("/NodeList/*/DeviceList/*/$ns3::LteNetDevice/Rx",
+                         MakeCallback (&AnimationInterface::LteRxTrace, this));
+  ConnectNetDeviceTrace ("/NodeList/*/DeviceList/*/$ns3::CsmaNetDevice/PhyTxBegin",
+                         MakeCallback (&AnimationInterface::CsmaPhyTxBeginTrace, this));
+  ConnectNetDeviceTrace ("/NodeList/*/DeviceList/*/$ns3::CsmaNetDevice/PhyTxEnd",
+                         MakeCallback (&AnimationInterface::CsmaPhyTxEndTrace, this));
+  ConnectNetDeviceTrace ("/NodeList/*/DeviceList/*/$ns3::CsmaNetDevice/PhyRxEnd",
+                         MakeCallback (&AnimationInterface::CsmaPhyRxEndTrace, this));
+  ConnectNetDeviceTrace ("/NodeList/*/DeviceList/*/$ns3::CsmaNetDevice/MacRx",
+                         MakeCallback (&AnimationInterface::CsmaMacRxTrace, this));
+  ConnectNetDeviceTrace ("/NodeList/*/DeviceList/*/$ns3::UanNetDevice/Phy/PhyTxBegin",
+                         MakeCallback (&AnimationInterface::UanPhyGenTxTrace, this));
+  ConnectNetDeviceTrace ("/NodeList/*/DeviceList/*/$ns3::UanNetDevice/Phy/PhyRxBegin",
+                         MakeCallback (&AnimationInterface::UanPhyGenRxTrace, this));
+  ConnectNodeTrace ("/NodeList/*/$ns3::BasicEnergySource/RemainingEnergy",
+                    MakeCallback (&AnimationInterface::RemainingEnergyTrace, this));
   
   ConnectLte ();
   
-  Config::ConnectFailSafe ("/NodeList/*/$ns3::Ipv4L3Protocol/Tx",
-                           MakeCallback (&AnimationInterface::Ipv4TxTrace, this));
-  Config::ConnectFailSafe ("/NodeList/*/$ns3::Ipv4L3Protocol/Rx",
-                           MakeCallback (&AnimationInterface::Ipv4RxTrace, this));
-  Config::ConnectFailSafe ("/NodeList/*/$ns3::Ipv4L3Protocol/Drop",
-                           MakeCallback (&AnimationInterface::Ipv4DropTrace, this));
+  ConnectNodeTrace ("/NodeList/*/$ns3::Ipv4L3Protocol/Tx",
+                    MakeCallback (&AnimationInterface::Ipv4TxTrace, this));
+  ConnectNodeTrace ("/NodeList/*/$ns3::Ipv4L3Protocol/Rx",
+                    MakeCallback (&AnimationInterface::Ipv4RxTrace, this));
+  ConnectNodeTrace ("/NodeList/*/$ns3::Ipv4L3Protocol/Drop",
+                    MakeCallback (&AnimationInterface::Ipv4DropTrace, this));
   
   // Queue Enqueues
   
-  Config::ConnectFailSafe ("/NodeList/*/DeviceList/*/$ns3::AlohaNoackNetDevice/Queue/Enqueue",
-                           MakeCallback (&AnimationInterface::EnqueueTrace, this));
-  Config::ConnectFailSafe ("/NodeList/*/DeviceList/*/$ns3::CsmaNetDevice/TxQueue/Enqueue",
-                           MakeCallback (&AnimationInterface::EnqueueTrace, this));
-  Config::ConnectFailSafe ("/NodeList/*/DeviceList/*/$ns3::PointToPointNetDevice/TxQueue/Enqueue",
-                           MakeCallback (&AnimationInterface::EnqueueTrace, this));
+  ConnectNodeTrace ("/NodeList/*/DeviceList/*/$ns3::AlohaNoackNetDevice/Queue/Enqueue",
+                    MakeCallback (&AnimationInterface::EnqueueTrace, this));
+  ConnectNodeTrace ("/NodeList/*/DeviceList/*/$ns3::CsmaNetDevice/TxQueue/Enqueue",
+                    MakeCallback (&AnimationInterface::EnqueueTrace, this));
+  ConnectNodeTrace ("/NodeList/*/DeviceList/*/$ns3::PointToPointNetDevice/TxQueue/Enqueue",
+                    MakeCallback (&AnimationInterface::EnqueueTrace, this));
   
   // Queue Dequeues
   
-  Config::ConnectFailSafe ("/NodeList/*/DeviceList/*/$ns3::AlohaNoackNetDevice/Queue/Dequeue",
-                           MakeCallback (&AnimationInterface::DequeueTrace, this));
-  Config::ConnectFailSafe ("/NodeList/*/DeviceList/*/$ns3::CsmaNetDevice/TxQueue/Dequeue",
-                           MakeCallback (&AnimationInterface::DequeueTrace, this));
-  Config::ConnectFailSafe ("/NodeList/*/DeviceList/*/$ns3::PointToPointNetDevice/TxQueue/Dequeue",
-                           MakeCallback (&AnimationInterface::DequeueTrace, this));
+  ConnectNodeTrace ("/NodeList/*/DeviceList/*/$ns3::AlohaNoackNetDevice/Queue/Dequeue",
+                    MakeCallback (&AnimationInterface::DequeueTrace, this));
+  ConnectNodeTrace ("/NodeList/*/DeviceList/*/$ns3::CsmaNetDevice/TxQueue/Dequeue",
+                    MakeCallback (&AnimationInterface::DequeueTrace, this));
+  ConnectNodeTrace ("/NodeList/*/DeviceList/*/$ns3::PointToPointNetDevice/TxQueue/Dequeue",
+                    MakeCallback (&AnimationInterface::DequeueTrace, this));
   
   // Queue Drops
   
-  Config::ConnectFailSafe ("/NodeList/*/DeviceList/*/$ns3::AlohaNoackNetDevice/Queue/Drop",
-                           MakeCallback (&AnimationInterface::QueueDropTrace, this));
-  Config::ConnectFailSafe ("/NodeList/*/DeviceList/*/$ns3::CsmaNetDevice/TxQueue/Drop",
-                           MakeCallback (&AnimationInterface::QueueDropTrace, this));
-  Config::ConnectFailSafe ("/NodeList/*/DeviceList/*/$ns3::PointToPointNetDevice/TxQueue/Drop",
-                           MakeCallback (&AnimationInterface::QueueDropTrace, this));
+  ConnectNodeTrace ("/NodeList/*/DeviceList/*/$ns3::AlohaNoackNetDevice/Queue/Drop",
+                    MakeCallback (&AnimationInterface::QueueDropTrace, this));
+  ConnectNodeTrace ("/NodeList/*/DeviceList/*/$ns3::CsmaNetDevice/TxQueue/Drop",
+                    MakeCallback (&AnimationInterface::QueueDropTrace, this));
+  ConnectNodeTrace ("/NodeList/*/DeviceList/*/$ns3::PointToPointNetDevice/TxQueue/Drop",
+                    MakeCallback (&AnimationInterface::QueueDropTrace, this));
   
   
   // Wifi Mac
-  Config::ConnectFailSafe ("/NodeList/*/DeviceList/*/$ns3::WifiNetDevice/Mac/MacTx",
-                           MakeCallback (&AnimationInterface::WifiMacTxTrace, this));
-  Config::ConnectFailSafe ("/NodeList/*/DeviceList/*/$ns3::WifiNetDevice/Mac/MacTxDrop",
-                           MakeCallback (&AnimationInterface::WifiMacTxDropTrace, this));
-  Config::ConnectFailSafe ("/NodeList/*/DeviceList/*/$ns3::WifiNetDevice/Mac/MacRx",
-                           MakeCallback (&AnimationInterface::WifiMacRxTrace, this));
-  Config::ConnectFailSafe ("/NodeList/*/DeviceList/*/$ns3::WifiNetDevice/Mac/MacRxDrop",
-                           MakeCallback (&AnimationInterface::WifiMacRxDropTrace, this));
+  ConnectNodeTrace ("/NodeList/*/DeviceList/*/$ns3::WifiNetDevice/Mac/MacTx",
+                    MakeCallback (&AnimationInterface::WifiMacTxTrace, this));
+  ConnectNodeTrace ("/NodeList/*/DeviceList/*/$ns3::WifiNetDevice/Mac/MacTxDrop",
+                    MakeCallback (&AnimationInterface::WifiMacTxDropTrace, this));
+  ConnectNodeTrace ("/NodeList/*/DeviceList/*/$ns3::WifiNetDevice/Mac/MacRx",
+                    MakeCallback (&AnimationInterface::WifiMacRxTrace, this));
+  ConnectNodeTrace ("/NodeList/*/DeviceList/*/$ns3::WifiNetDevice/Mac/MacRxDrop",
+                    MakeCallback (&AnimationInterface::WifiMacRxDropTrace, this));
   
   // Wifi Phy
-  Config::ConnectFailSafe ("/NodeList/*/DeviceList/*/$ns3::WifiNetDevice/Phy/PhyTxDrop",
-                           MakeCallback (&AnimationInterface::WifiPhyTxDropTrace, this));
-  Config::ConnectFailSafe ("/NodeList/*/DeviceList/*/$ns3::WifiNetDevice/Phy/PhyRxDrop",
-                           MakeCallback (&AnimationInterface::WifiPhyRxDropTrace, this));
+  ConnectNodeTrace ("/NodeList/*/DeviceList/*/$ns3::WifiNetDevice/Phy/PhyTxDrop",
+                    MakeCallback (&AnimationInterface::WifiPhyTxDropTrace, this));
+  ConnectNodeTrace ("/NodeList/*/DeviceList/*/$ns3::WifiNetDevice/Phy/PhyRxDrop",
+                    MakeCallback (&AnimationInterface::WifiPhyRxDropTrace, this));
   
   // LrWpan
-  Config::ConnectFailSafe ("NodeList/*/DeviceList/*/$ns3::LrWpanNetDevice/Phy/PhyTxBegin",
-                           MakeCallback (&AnimationInterface::LrWpanPhyTxBeginTrace, this));
-  Config::ConnectFailSafe ("NodeList/*/DeviceList/*/$ns3::LrWpanNetDevice/Phy/PhyRxBegin",
-                           MakeCallback (&AnimationInterface::LrWpanPhyRxBeginTrace, this));
-  Config::ConnectFailSafe ("/NodeList/*/DeviceList/*/$ns3::LrWpanNetDevice/Mac/MacTx",
-                           MakeCallback (&AnimationInterface::LrWpanMacTxTrace, this));
-  Config::ConnectFailSafe ("/NodeList/*/DeviceList/*/$ns3::LrWpanNetDevice/Mac/MacTxDrop",
-                           MakeCallback (&AnimationInterface::LrWpanMacTxDropTrace, this));
-  Config::ConnectFailSafe ("/NodeList/*/DeviceList/*/$ns3::LrWpanNetDevice/Mac/MacRx",
-                           MakeCallback (&AnimationInterface::LrWpanMacRxTrace, this));
-  Config::ConnectFailSafe ("/NodeList/*/DeviceList/*/$ns3::LrWpanNetDevice/Mac/MacRxDrop",
-                           MakeCallback (&AnimationInterface::LrWpanMacRxDropTrace, this));
+  ConnectNetDeviceTrace ("/NodeList/*/DeviceList/*/$ns3::LrWpanNetDevice/Phy/PhyTxBegin",
+                         MakeCallback (&AnimationInterface::LrWpanPhyTxBeginTrace, this));
+  ConnectNetDeviceTrace ("/NodeList/*/DeviceList/*/$ns3::LrWpanNetDevice/Phy/PhyRxBegin",
+                         MakeCallback (&AnimationInterface::LrWpanPhyRxBeginTrace, this));
+  ConnectNodeTrace ("/NodeList/*/DeviceList/*/$ns3::LrWpanNetDevice/Mac/MacTx",
+                    MakeCallback (&AnimationInterface::LrWpanMacTxTrace, this));
+  ConnectNodeTrace ("/NodeList/*/DeviceList/*/$ns3::LrWpanNetDevice/Mac/MacTxDrop",
+                    MakeCallback (&AnimationInterface::LrWpanMacTxDropTrace, this));
+  ConnectNodeTrace ("/NodeList/*/DeviceList/*/$ns3::LrWpanNetDevice/Mac/MacRx",
+                    MakeCallback (&AnimationInterface::LrWpanMacRxTrace, this));
+  ConnectNodeTrace ("/NodeList/*/DeviceList/*/$ns3::LrWpanNetDevice/Mac/MacRxDrop",
+                    MakeCallback (&AnimationInterface::LrWpanMacRxDropTrace, this));
   
   // Wave
-  Config::ConnectFailSafe ("/NodeList/*/DeviceList/*/$ns3::WaveNetDevice/PhyEntities/*/$ns3::WifiPhy/PhyTxBegin",
-                           MakeCallback (&AnimationInterface::WavePhyTxBeginTrace, this));
-  Config::ConnectFailSafe ("/NodeList/*/DeviceList/*/$ns3::WaveNetDevice/PhyEntities/*/$ns3::WifiPhy/PhyRxBegin",
-                           MakeCallback (&AnimationInterface::WavePhyRxBeginTrace, this));
+  ConnectNetDeviceTrace ("/NodeList/*/DeviceList/*/$ns3::WaveNetDevice/PhyEntities/*/$ns3::WifiPhy/PhyTxBegin",
+                         MakeCallback (&AnimationInterface::WavePhyTxBeginTrace, this));
+  ConnectNetDeviceTrace ("/NodeList/*/DeviceList/*/$ns3::WaveNetDevice/PhyEntities/*/$ns3::WifiPhy/PhyRxBegin",
+                         MakeCallback (&AnimationInterface::WavePhyRxBeginTrace, this));
 }
 
 Vector
@@ -2123,6 +2124,8 @@ AnimationInterface::SetOutputFile (const std::string& fn, bool routing)
       NS_FATAL_ERROR ("Unable to open output file:" << fn.c_str ());
       return; // Can't open output file
     }
+  // the trace is written in many small chunks, use a larger buffer
+  std::setvbuf (f, 0, _IOFBF, 1 << 16);
   if (routing)
     {
       m_routingF = f;
@@ -663,6 +663,8 @@ private:
   AnimUidPacketInfoMap m_pendingWavePackets; ///< pending WAVE packets
 
   std::map <uint32_t, Vector> m_nodeLocation; ///< node location
+  /// whether each node, indexed by ID, has a constant position (only changed through course changes)
+  std::vector <bool> m_stationaryNodes;
   std::map <std::string, uint32_t> m_macToNodeIdMap; ///< MAC to node ID map
   std::map <std::string, uint32_t> m_ipv4ToNodeIdMap; ///< IPv4 to node ID map
   std::map <std::string, uint32_t> m_ipv6ToNodeIdMap; ///< IPv6 to node ID map
@@ -709,12 +711,6 @@ private:
    * \returns the node
    */
   Ptr <Node> GetNodeFromContext (const std::string& context) const;
-  /**
-   * Get net device from context
-   * \param context the context string
-   * \returns the device
-   */
-  Ptr <NetDevice> GetNetDeviceFromContext (std::string context);
 
   // ##### General #####
   /**
@@ -914,296 +910,321 @@ private:
   // ##### Trace #####
   /**
    * Enqueue trace function
-   * \param context the context
+   * \param nodeId the node ID
    * \param p the packet
    */
-  void EnqueueTrace (std::string context, Ptr<const Packet>);
+  void EnqueueTrace (uint32_t nodeId, Ptr<const Packet>);
   /**
    * Dequeue trace function
-   * \param context the context
+   * \param nodeId the node ID
    * \param p the packet
    */
-  void DequeueTrace (std::string context, Ptr<const Packet>);
+  void DequeueTrace (uint32_t nodeId, Ptr<const Packet>);
   /**
    * Queue trace function
-   * \param context the context
+   * \param nodeId the node ID
    * \param p the packet
    */
-  void QueueDropTrace (std::string context, Ptr<const Packet>);
+  void QueueDropTrace (uint32_t nodeId, Ptr<const Packet>);
   /**
    * IPv4 transmit trace function
-   * \param context the context
+   * \param nodeId the node ID
    * \param p the packet
    * \param ipv4 the IP
    * \param interfaceIndex the interface index
    */
-  void Ipv4TxTrace (std::string context,
-                    Ptr<const Packet> p, Ptr<Ipv4> ipv4,
+  void Ipv4TxTrace (uint32_t nodeId, Ptr<const Packet> p, Ptr<Ipv4> ipv4,
                     uint32_t interfaceIndex);
   /**
    * IPv4 receive trace function
-   * \param context the context
+   * \param nodeId the node ID
    * \param p the packet
    * \param ipv4 the IP
    * \param interfaceIndex the interface index
    */
-  void Ipv4RxTrace (std::string context,
-                    Ptr<const Packet> p, Ptr<Ipv4> ipv4,
+  void Ipv4RxTrace (uint32_t nodeId, Ptr<const Packet> p, Ptr<Ipv4> ipv4,
                     uint32_t interfaceIndex);
   /**
    * IPv4 drop trace function
-   * \param context the context
+   * \param nodeId the node ID
    * \param ipv4Header the IPv4 header
    * \param p the packet
    * \param dropReason the reason for the drop
    * \param ipv4 the IP
    * \param interfaceIndex the interface index
    */
-  void Ipv4DropTrace (std::string context,
-                      const Ipv4Header & ipv4Header,
+  void Ipv4DropTrace (uint32_t nodeId, const Ipv4Header & ipv4Header,
                       Ptr<const Packet> p,
                       Ipv4L3Protocol::DropReason dropReason, Ptr<Ipv4> ipv4,
                       uint32_t interfaceIndex);
 
   /**
    * wifi MAC transmit trace function
-   * \param context the context
+   * \param nodeId the node ID
    * \param p the packet
    */
-  void WifiMacTxTrace (std::string context, Ptr<const Packet> p);
+  void WifiMacTxTrace (uint32_t nodeId, Ptr<const Packet> p);
   /**
    * wifi MAC transmit drop trace function
-   * \param context the context
+   * \param nodeId the node ID
    * \param p the packet
    */
-  void WifiMacTxDropTrace (std::string context, Ptr<const Packet> p);
+  void WifiMacTxDropTrace (uint32_t nodeId, Ptr<const Packet> p);
   /**
    * wifi MAC receive trace function
-   * \param context the context
+   * \param nodeId the node ID
    * \param p the packet
    */
-  void WifiMacRxTrace (std::string context, Ptr<const Packet> p);
+  void WifiMacRxTrace (uint32_t nodeId, Ptr<const Packet> p);
   /**
    * wifi MAC receive drop trace function
-   * \param context the context
+   * \param nodeId the node ID
    * \param p the packet
    */
-  void WifiMacRxDropTrace (std::string context, Ptr<const Packet> p);
+  void WifiMacRxDropTrace (uint32_t nodeId, Ptr<const Packet> p);
   /**
    * wifi Phy transmit drop trace function
-   * \param context the context
+   * \param nodeId the node ID
    * \param p the packet
    */
-  void WifiPhyTxDropTrace (std::string context, Ptr<const Packet> p);
+  void WifiPhyTxDropTrace (uint32_t nodeId, Ptr<const Packet> p);
   /**
    * wifi Phy receive drop trace function
-   * \param context the context
+   * \param nodeId the node ID
    * \param p the packet
    * \param reason the reason
    */
-  void WifiPhyRxDropTrace (std::string context, Ptr<const Packet> p, WifiPhyRxfailureReason reason);
+  void WifiPhyRxDropTrace (uint32_t nodeId, Ptr<const Packet> p, WifiPhyRxfailureReason reason);
   /**
    * LR-WPAN MAC transmit trace function
-   * \param context the context
+   * \param nodeId the node ID
    * \param p the packet
    */
-  void LrWpanMacTxTrace (std::string context,
-                         Ptr<const Packet> p);
+  void LrWpanMacTxTrace (uint32_t nodeId, Ptr<const Packet> p);
   /**
    * LR-WPAN MAC transmit drop trace function
-   * \param context the context
+   * \param nodeId the node ID
    * \param p the packet
    */
-  void LrWpanMacTxDropTrace (std::string context,
-                             Ptr<const Packet> p);
+  void LrWpanMacTxDropTrace (uint32_t nodeId, Ptr<const Packet> p);
   /**
    * LR-WPAN MAC receive trace function
-   * \param context the context
+   * \param nodeId the node ID
    * \param p the packet
    */
-  void LrWpanMacRxTrace (std::string context,
-                         Ptr<const Packet> p);
+  void LrWpanMacRxTrace (uint32_t nodeId, Ptr<const Packet> p);
   /**
    * LR-WPAN MAC receive drop trace function
-   * \param context the context
+   * \param nodeId the node ID
    * \param p the packet
    */
-  void LrWpanMacRxDropTrace (std::string context,
-                             Ptr<const Packet> p);
+  void LrWpanMacRxDropTrace (uint32_t nodeId, Ptr<const Packet> p);
   /**
    * Device transmit trace function
-   * \param context the context
    * \param p the packet
    * \param tx the transmit device
    * \param rx the receive device
    * \param txTime the transmit time
    * \param rxTime the reeive time
    */
-  void DevTxTrace (std::string context,
-                   Ptr<const Packet> p,
+  void DevTxTrace (Ptr<const Packet> p,
                    Ptr<NetDevice> tx,
                    Ptr<NetDevice> rx,
                    Time txTime,
                    Time rxTime);
   /**
    * wifi Phy transmit PSDU begin trace function
-   * \param context the context
+   * \param nodeId the node ID
+   * \param deviceId the device index
    * \param psduMap the PSDU map
    * \param txVector the TXVECTOR
    * \param txPowerW the tx power in Watts
    */
-  void WifiPhyTxBeginTrace (std::string context, WifiConstPsduMap psduMap, WifiTxVector txVector, double txPowerW);
+  void WifiPhyTxBeginTrace (uint32_t nodeId, uint32_t deviceId, WifiConstPsduMap psduMap, WifiTxVector txVector, double txPowerW);
   /**
    * wifi Phy receive begin trace function
    *
-   * \param context the context
+   * \param nodeId the node ID
+   * \param deviceId the device index
    * \param p the packet
    * \param rxPowersW the receive power per channel band in Watts
    */
-  void WifiPhyRxBeginTrace (std::string context, Ptr<const Packet> p, RxPowerWattPerChannelBand rxPowersW);
+  void WifiPhyRxBeginTrace (uint32_t nodeId, uint32_t deviceId, Ptr<const Packet> p, RxPowerWattPerChannelBand rxPowersW);
   /**
    * WAVE Phy transmit begin trace function
-   * \param context the context
+   * \param nodeId the node ID
+   * \param deviceId the device index
    * \param p the packet
    */
-  void WavePhyTxBeginTrace (std::string context,
-                            Ptr<const Packet> p);
+  void WavePhyTxBeginTrace (uint32_t nodeId, uint32_t deviceId, Ptr<const Packet> p);
   /**
    * WAVE Phy receive begin trace function
    *
-   * \param context the context
+   * \param nodeId the node ID
+   * \param deviceId the device index
    * \param p the packet
    */
-  void WavePhyRxBeginTrace (std::string context,
-                            Ptr<const Packet> p);
+  void WavePhyRxBeginTrace (uint32_t nodeId, uint32_t deviceId, Ptr<const Packet> p);
   /**
    * LR-WPAN Phy receive begin trace function
    *
-   * \param context the context
+   * \param nodeId the node ID
+   * \param deviceId the device index
    * \param p the packet
    */
-  void LrWpanPhyTxBeginTrace (std::string context,
-                              Ptr<const Packet> p);
+  void LrWpanPhyTxBeginTrace (uint32_t nodeId, uint32_t deviceId, Ptr<const Packet> p);
   /**
    * LR-WPAN Phy receive begin trace function
    *
-   * \param context the context
+   * \param nodeId the node ID
+   * \param deviceId the device index
    * \param p the packet
    */
-  void LrWpanPhyRxBeginTrace (std::string context,
-                              Ptr<const Packet> p);
+  void LrWpanPhyRxBeginTrace (uint32_t nodeId, uint32_t deviceId, Ptr<const Packet> p);
   /**
    * WIMax transmit trace function
-   * \param context the context
+   * \param nodeId the node ID
+   * \param deviceId the device index
    * \param p the packet
    * \param m the MAC address
    */
-  void WimaxTxTrace (std::string context,
-                     Ptr<const Packet> p,
+  void WimaxTxTrace (uint32_t nodeId, uint32_t deviceId, Ptr<const Packet> p,
                      const Mac48Address & m);
   /**
    * WIMax receive trace function
-   * \param context the context
+   * \param nodeId the node ID
+   * \param deviceId the device index
    * \param p the packet
    * \param m the MAC address
    */
-  void WimaxRxTrace (std::string context,
-                     Ptr<const Packet> p,
+  void WimaxRxTrace (uint32_t nodeId, uint32_t deviceId, Ptr<const Packet> p,
                      const Mac48Address & m);
   /**
    * CSMA Phy transmit begin trace function
-   * \param context the context
+   * \param nodeId the node ID
+   * \param deviceId the device index
    * \param p the packet
    */
-  void CsmaPhyTxBeginTrace (std::string context, Ptr<const Packet> p);
+  void CsmaPhyTxBeginTrace (uint32_t nodeId, uint32_t deviceId, Ptr<const Packet> p);
   /**
    * CSMA Phy transmit end trace function
    *
-   * \param context the context
+   * \param nodeId the node ID
+   * \param deviceId the device index
    * \param p the packet
    */
-  void CsmaPhyTxEndTrace (std::string context, Ptr<const Packet> p);
+  void CsmaPhyTxEndTrace (uint32_t nodeId, uint32_t deviceId, Ptr<const Packet> p);
   /**
    * CSMA Phy receive end trace function
    *
-   * \param context the context
+   * \param nodeId the node ID
+   * \param deviceId the device index
    * \param p the packet
    */
-  void CsmaPhyRxEndTrace (std::string context, Ptr<const Packet> p);
+  void CsmaPhyRxEndTrace (uint32_t nodeId, uint32_t deviceId, Ptr<const Packet> p);
   /**
    * CSMA MAC receive trace function
    *
-   * \param context the context
+   * \param nodeId the node ID
+   * \param deviceId the device index
    * \param p the packet
    */
-  void CsmaMacRxTrace (std::string context, Ptr<const Packet> p);
+  void CsmaMacRxTrace (uint32_t nodeId, uint32_t deviceId, Ptr<const Packet> p);
   /**
    * LTE transmit trace function
-   * \param context the context
+   * \param nodeId the node ID
+   * \param deviceId the device index
    * \param p the packet
    * \param m the MAC address
    */
-  void LteTxTrace (std::string context,
-                   Ptr<const Packet> p,
+  void LteTxTrace (uint32_t nodeId, uint32_t deviceId, Ptr<const Packet> p,
                    const Mac48Address & m);
   /**
    * LTE receive trace function
-   * \param context the context
+   * \param nodeId the node ID
+   * \param deviceId the device index
    * \param p the packet
    * \param m the MAC address
    */
-  void LteRxTrace (std::string context,
-                   Ptr<const Packet> p,
+  void LteRxTrace (uint32_t nodeId, uint32_t deviceId, Ptr<const Packet> p,
                    const Mac48Address & m);
   /**
    * LTE Spectrum Phy transmit start function
-   * \param context the context
+   * \param nodeId the node ID
+   * \param deviceId the device index
    * \param pb the packet burst
    */
-  void LteSpectrumPhyTxStart (std::string context, Ptr<const PacketBurst> pb);
+  void LteSpectrumPhyTxStart (uint32_t nodeId, uint32_t deviceId, Ptr<const PacketBurst> pb);
   /**
    * LTE Spectrum Phy receive start function
-   * \param context the context
+   * \param nodeId the node ID
+   * \param deviceId the device index
    * \param pb the packet burst
    */
-  void LteSpectrumPhyRxStart (std::string context, Ptr<const PacketBurst> pb);
+  void LteSpectrumPhyRxStart (uint32_t nodeId, uint32_t deviceId, Ptr<const PacketBurst> pb);
   /**
    * UAN Phy gen transmit trace function
-   * \param context the context
+   * \param nodeId the node ID
+   * \param deviceId the device index
    * \param p the packet
    */
-  void UanPhyGenTxTrace (std::string context, Ptr<const Packet>);
+  void UanPhyGenTxTrace (uint32_t nodeId, uint32_t deviceId, Ptr<const Packet>);
   /**
    * UAN Phy gen receive trace function
-   * \param context the context
+   * \param nodeId the node ID
+   * \param deviceId the device index
    * \param p the packet
    */
-  void UanPhyGenRxTrace (std::string context, Ptr<const Packet>);
+  void UanPhyGenRxTrace (uint32_t nodeId, uint32_t deviceId, Ptr<const Packet>);
   /**
    * Remaining energy trace function
-   * \param context the context
+   * \param nodeId the node ID
    * \param previousEnergy The previous energy
    * \param currentEnergy The current energy
    */
-  void RemainingEnergyTrace (std::string context, double previousEnergy, double currentEnergy);
+  void RemainingEnergyTrace (uint32_t nodeId, double previousEnergy, double currentEnergy);
   /**
    * Generic wireless transmit trace function
-   * \param context the context
+   * \param nodeId the node ID
+   * \param deviceId the device index
    * \param p the packet
    * \param protocolType the protocol type
    */
-  void GenericWirelessTxTrace (std::string context, Ptr<const Packet> p, ProtocolType protocolType);
+  void GenericWirelessTxTrace (uint32_t nodeId, uint32_t deviceId, Ptr<const Packet> p, ProtocolType protocolType);
   /**
    * Generic wireless receive trace function
-   * \param context the context
+   * \param nodeId the node ID
+   * \param deviceId the device index
    * \param p the packet
    * \param protocolType the protocol type
    */
-  void GenericWirelessRxTrace (std::string context, Ptr<const Packet> p, ProtocolType protocolType);
+  void GenericWirelessRxTrace (uint32_t nodeId, uint32_t deviceId, Ptr<const Packet> p, ProtocolType protocolType);
 
 
   /// Connect callbacks function
   void ConnectCallbacks ();
+  /**
+   * Connect a callback to a trace source of all the objects matching a path,
+   * binding the ID of the node of each object as first argument, so that
+   * the context does not have to be parsed each time the trace is fired.
+   *
+   * \tparam CB \deduced the type of the callback
+   * \param path the path of the trace source, starting with /NodeList/
+   * \param cb the callback, taking the node ID as first argument
+   */
+  template <typename CB>
+  void ConnectNodeTrace (std::string path, CB cb);
+  /**
+   * Connect a callback to a trace source of all the objects matching a path,
+   * binding the ID of the node and the index of the device of each object as
+   * first two arguments.
+   *
+   * \tparam CB \deduced the type of the callback
+   * \param path the path of the trace source, starting with /NodeList/ * /DeviceList/
+   * \param cb the callback, taking the node ID and the device index as first arguments
+   */
+  template <typename CB>
+  void ConnectNetDeviceTrace (std::string path, CB cb);
   /// Connect LTE function
   void ConnectLte ();
   /**
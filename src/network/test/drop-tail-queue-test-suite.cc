@@ -19,6 +19,8 @@
 #include "ns3/test.h"
 #include "ns3/drop-tail-queue.h"
 #include "ns3/string.h"
+#include "ns3/ring-buffer.h"
+#include <vector>
 
 using namespace ns3;
 
@@ -83,6 +85,121 @@ DropTailQueueTestCase::DoRun (void)
   NS_TEST_EXPECT_MSG_EQ ((packet == 0), true, "There are really no packets in there");
 }
 
+/**
+ * \ingroup network-test
+ * \ingroup tests
+ *
+ * RingBuffer unit tests.
+ */
+class RingBufferTestCase : public TestCase
+{
+public:
+  RingBufferTestCase ();
+  virtual void DoRun (void);
+private:
+  /**
+   * Check the content of a ring buffer
+   * \param buffer the ring buffer
+   * \param expected the expected elements
+   */
+  void Check (const RingBuffer<int>& buffer, std::vector<int> expected);
+};
+
+RingBufferTestCase::RingBufferTestCase ()
+  : TestCase ("Sanity check on the ring buffer backing the queues")
+{
+}
+
+void
+RingBufferTestCase::Check (const RingBuffer<int>& buffer, std::vector<int> expected)
+{
+  NS_TEST_ASSERT_MSG_EQ (buffer.size (), expected.size (), "Unexpected number of elements");
+  std::size_t i = 0;
+  for (RingBuffer<int>::const_iterator it = buffer.begin (); it != buffer.end (); ++it, ++i)
+    {
+      NS_TEST_EXPECT_MSG_EQ (*it, expected[i], "Unexpected element at position " << i);
+    }
+}
+
+void
+RingBufferTestCase::DoRun (void)
+{
+  RingBuffer<int> buffer;
+  NS_TEST_EXPECT_MSG_EQ (buffer.empty (), true, "The buffer should be empty");
+
+  // make the elements wrap around the end of the buffer
+  for (int i = 0; i < 12; i++)
+    {
+      buffer.push_back (i);
+    }
+  for (int i = 0; i < 10; i++)
+    {
+      buffer.pop_front ();
+    }
+  std::size_t capacity = buffer.capacity ();
+  for (int i = 12; i < 20; i++)
+    {
+      buffer.push_back (i);
+    }
+  NS_TEST_EXPECT_MSG_EQ (buffer.capacity (), capacity, "The buffer should not have grown");
+  Check (buffer, {10, 11, 12, 13, 14, 15, 16, 17, 18, 19});
+
+  // grow the buffer while the elements wrap around
+  for (int i = 20; i < 30; i++)
+    {
+      buffer.push_back (i);
+    }
+  NS_TEST_EXPECT_MSG_GT (buffer.capacity (), capacity, "The buffer should have grown");
+  NS_TEST_EXPECT_MSG_EQ (buffer.front (), 10, "Unexpected first element");
+  NS_TEST_EXPECT_MSG_EQ (buffer.back (), 29, "Unexpected last element");
+  for (int i = 0; i < 15; i++)
+    {
+      buffer.pop_back ();
+    }
+  Check (buffer, {10, 11, 12, 13, 14});
+
+  // insert and erase in the first and in the second half
+  RingBuffer<int>::const_iterator pos = ++buffer.begin ();
+  RingBuffer<int>::iterator it = buffer.insert (pos, 100);
+  NS_TEST_EXPECT_MSG_EQ (*it, 100, "Iterator to the wrong element");
+  it = buffer.insert (buffer.end (), 101);
+  NS_TEST_EXPECT_MSG_EQ ((++it == buffer.end ()), true, "Iterator to the wrong element");
+  it = buffer.insert (--buffer.end (), 102);
+  buffer.push_front (103);
+  Check (buffer, {103, 10, 100, 11, 12, 13, 14, 102, 101});
+
+  it = buffer.erase (++buffer.begin ());
+  NS_TEST_EXPECT_MSG_EQ (*it, 100, "Iterator to the wrong element");
+  it = buffer.erase (--(--buffer.end ()));
+  NS_TEST_EXPECT_MSG_EQ (*it, 101, "Iterator to the wrong element");
+  Check (buffer, {103, 100, 11, 12, 13, 14, 101});
+
+  buffer.clear ();
+  NS_TEST_EXPECT_MSG_EQ (buffer.empty (), true, "The buffer should be empty");
+  NS_TEST_EXPECT_MSG_EQ ((buffer.begin () == buffer.cend ()), true, "Empty buffer with elements");
+
+  // a drop tail queue keeps the FIFO order while its buffer wraps and grows
+  Ptr<DropTailQueue<Packet> > queue = CreateObject<DropTailQueue<Packet> > ();
+  queue->SetAttribute ("MaxSize", StringValue ("1000p"));
+  std::vector<uint64_t> uids;
+  for (uint32_t round = 0; round < 10; round++)
+    {
+      for (uint32_t i = 0; i < 10 * round + 7; i++)
+        {
+          Ptr<Packet> p = Create<Packet> ();
+          uids.push_back (p->GetUid ());
+          queue->Enqueue (p);
+        }
+      for (uint32_t i = 0; i < 5 * round + 3; i++)
+        {
+          Ptr<Packet> p = queue->Dequeue ();
+          NS_TEST_EXPECT_MSG_EQ (p->GetUid (), uids.front (), "Packet dequeued out of order");
+          uids.erase (uids.begin ());
+        }
+    }
+  NS_TEST_EXPECT_MSG_EQ (queue->GetNPackets (), uids.size (), "Unexpected number of packets");
+}
+
 /**
  * \ingroup network-test
  * \ingroup tests
@@ -96,6 +213,7 @@ public:
     : TestSuite ("drop-tail-queue", UNIT)
   {
     AddTestCase (new DropTailQueueTestCase (), TestCase::QUICK);
+    AddTestCase (new RingBufferTestCase (), TestCase::QUICK);
   }
 };
 
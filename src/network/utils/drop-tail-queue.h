@@ -20,6 +20,7 @@
 #define DROPTAIL_H
 
 #include "ns3/queue.h"
+#include "ns3/ring-buffer.h"
 
 namespace ns3 {
 
@@ -27,6 +28,9 @@ namespace ns3 {
  * \ingroup queue
  *
  * \brief A FIFO packet queue that drops tail-end packets on overflow
+ *
+ * The items are stored in a RingBuffer rather than in the list of the Queue
+ * base class, so that enqueuing an item does not allocate memory.
  */
 template <typename Item>
 class DropTailQueue : public Queue<Item>
@@ -52,13 +56,12 @@ public:
   virtual Ptr<const Item> Peek (void) const;
 
 private:
-  using Queue<Item>::begin;
-  using Queue<Item>::end;
-  using Queue<Item>::DoEnqueue;
-  using Queue<Item>::DoDequeue;
-  using Queue<Item>::DoRemove;
-  using Queue<Item>::DoPeek;
+  using Queue<Item>::ItemEnqueued;
+  using Queue<Item>::ItemDequeued;
+  using Queue<Item>::DropBeforeEnqueue;
+  using Queue<Item>::DropAfterDequeue;
 
+  RingBuffer<Ptr<Item> > m_items;  //!< the items in the queue
   NS_LOG_TEMPLATE_DECLARE;     //!< redefinition of the log component
 };
 
@@ -105,7 +108,17 @@ DropTailQueue<Item>::Enqueue (Ptr<Item> item)
 {
   NS_LOG_FUNCTION (this << item);
 
-  return DoEnqueue (end (), item);
+  if (this->GetCurrentSize () + item > this->GetMaxSize ())
+    {
+      NS_LOG_LOGIC ("Queue full -- dropping pkt");
+      DropBeforeEnqueue (item);
+      return false;
+    }
+
+  m_items.push_back (item);
+  ItemEnqueued (item);
+
+  return true;
 }
 
 template <typename Item>
@@ -114,7 +127,15 @@ DropTailQueue<Item>::Dequeue (void)
 {
   NS_LOG_FUNCTION (this);
 
-  Ptr<Item> item = DoDequeue (begin ());
+  if (m_items.empty ())
+    {
+      NS_LOG_LOGIC ("Queue empty");
+      return 0;
+    }
+
+  Ptr<Item> item = m_items.front ();
+  m_items.pop_front ();
+  ItemDequeued (item);
 
   NS_LOG_LOGIC ("Popped " << item);
 
@@ -127,7 +148,17 @@ DropTailQueue<Item>::Remove (void)
 {
   NS_LOG_FUNCTION (this);
 
-  Ptr<Item> item = DoRemove (begin ());
+  if (m_items.empty ())
+    {
+      NS_LOG_LOGIC ("Queue empty");
+      return 0;
+    }
+
+  Ptr<Item> item = m_items.front ();
+  m_items.pop_front ();
+  // packets are first dequeued and then dropped
+  ItemDequeued (item);
+  DropAfterDequeue (item);
 
   NS_LOG_LOGIC ("Removed " << item);
 
@@ -140,7 +171,13 @@ DropTailQueue<Item>::Peek (void) const
 {
   NS_LOG_FUNCTION (this);
 
-  return DoPeek (begin ());
+  if (m_items.empty ())
+    {
+      NS_LOG_LOGIC ("Queue empty");
+      return 0;
+    }
+
+  return m_items.front ();
 }
 
 // The following explicit template instantiation declarations prevent all the
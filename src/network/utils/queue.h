@@ -248,6 +248,13 @@ private:
  * \endcode
  *
  * Then, include queue.h in the corresponding .cc file.
+ *
+ * The DoEnqueue, DoDequeue, DoRemove and DoPeek methods operate on a list
+ * of items kept by this class. Subclasses that never insert in the middle of
+ * the queue may instead store the items in a container of their own (e.g.,
+ * the RingBuffer used by DropTailQueue, which does not allocate memory for
+ * every enqueued item) and call the ItemEnqueued and ItemDequeued methods
+ * to maintain the statistics and fire the trace sources.
  */
 template <typename Item>
 class Queue : public QueueBase
@@ -407,6 +414,25 @@ protected:
    */
   Ptr<const Item> DoPeek (ConstIterator pos) const;
 
+  /**
+   * \brief Account for an item stored by a subclass in its own container
+   * \param item the enqueued item
+   *
+   * Update the statistics and fire the Enqueue trace. The subclass must have
+   * checked that the item fits in the queue (and called DropBeforeEnqueue
+   * otherwise).
+   */
+  void ItemEnqueued (Ptr<Item> item);
+
+  /**
+   * \brief Account for an item removed by a subclass from its own container
+   * \param item the dequeued item
+   *
+   * Update the statistics and fire the Dequeue trace. The subclass must call
+   * DropAfterDequeue afterwards if the item is dropped.
+   */
+  void ItemDequeued (Ptr<Item> item);
+
   /**
    * \brief Drop a packet before enqueue
    * \param item item that was dropped
@@ -508,6 +534,16 @@ Queue<Item>::DoEnqueue (ConstIterator pos, Ptr<Item> item, Iterator& ret)
     }
 
   ret = m_packets.insert (pos, item);
+  ItemEnqueued (item);
+
+  return true;
+}
+
+template <typename Item>
+void
+Queue<Item>::ItemEnqueued (Ptr<Item> item)
+{
+  NS_LOG_FUNCTION (this << item);
 
   uint32_t size = item->GetSize ();
   m_nBytes += size;
@@ -518,8 +554,6 @@ Queue<Item>::DoEnqueue (ConstIterator pos, Ptr<Item> item, Iterator& ret)
 
   NS_LOG_LOGIC ("m_traceEnqueue (p)");
   m_traceEnqueue (item);
-
-  return true;
 }
 
 template <typename Item>
@@ -539,18 +573,27 @@ Queue<Item>::DoDequeue (ConstIterator pos)
 
   if (item != 0)
     {
-      NS_ASSERT (m_nBytes.Get () >= item->GetSize ());
-      NS_ASSERT (m_nPackets.Get () > 0);
-
-      m_nBytes -= item->GetSize ();
-      m_nPackets--;
-
-      NS_LOG_LOGIC ("m_traceDequeue (p)");
-      m_traceDequeue (item);
+      ItemDequeued (item);
     }
   return item;
 }
 
+template <typename Item>
+void
+Queue<Item>::ItemDequeued (Ptr<Item> item)
+{
+  NS_LOG_FUNCTION (this << item);
+
+  NS_ASSERT (m_nBytes.Get () >= item->GetSize ());
+  NS_ASSERT (m_nPackets.Get () > 0);
+
+  m_nBytes -= item->GetSize ();
+  m_nPackets--;
+
+  NS_LOG_LOGIC ("m_traceDequeue (p)");
+  m_traceDequeue (item);
+}
+
 template <typename Item>
 Ptr<Item>
 Queue<Item>::DoRemove (ConstIterator pos)
@@ -568,16 +611,8 @@ Queue<Item>::DoRemove (ConstIterator pos)
 
   if (item != 0)
     {
-      NS_ASSERT (m_nBytes.Get () >= item->GetSize ());
-      NS_ASSERT (m_nPackets.Get () > 0);
-
-      m_nBytes -= item->GetSize ();
-      m_nPackets--;
-
       // packets are first dequeued and then dropped
-      NS_LOG_LOGIC ("m_traceDequeue (p)");
-      m_traceDequeue (item);
-
+      ItemDequeued (item);
       DropAfterDequeue (item);
     }
   return item;
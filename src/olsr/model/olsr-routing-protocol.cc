@@ -33,6 +33,7 @@
 
 
 #include <iomanip>
+#include <algorithm>
 #include "olsr-routing-protocol.h"
 #include "ns3/socket-factory.h"
 #include "ns3/udp-socket-factory.h"
@@ -204,7 +205,9 @@ RoutingProtocol::RoutingProtocol (void)
   m_tcTimer (Timer::CANCEL_ON_DESTROY),
   m_midTimer (Timer::CANCEL_ON_DESTROY),
   m_hnaTimer (Timer::CANCEL_ON_DESTROY),
-  m_queuedMessagesTimer (Timer::CANCEL_ON_DESTROY)
+  m_queuedMessagesTimer (Timer::CANCEL_ON_DESTROY),
+  m_mprComputationVersion (0),
+  m_routingTableVersion (0)
 {
   m_uniformRandomVariable = CreateObject<UniformRandomVariable> ();
 
@@ -416,6 +419,7 @@ void RoutingProtocol::DoInitialize ()
 void RoutingProtocol::SetMainInterface (uint32_t interface)
 {
   m_mainAddress = m_ipv4->GetAddress (interface, 0).GetLocal ();
+  InvalidateComputations ();
 }
 
 void RoutingProtocol::SetInterfaceExclusions (std::set<uint32_t> exceptions)
@@ -666,6 +670,13 @@ RoutingProtocol::MprComputation  (void)
 {
   NS_LOG_FUNCTION (this);
 
+  if (m_mprComputationVersion == m_state.GetNeighborhoodVersion ())
+    {
+      NS_LOG_LOGIC ("Neighborhood unchanged, MPR set not computed again");
+      return;
+    }
+  m_mprComputationVersion = m_state.GetNeighborhoodVersion ();
+
   // MPR computation should be done for each interface. See section 8.3.1
   // (RFC 3626) for details.
   MprSet mprSet;
@@ -978,31 +989,70 @@ RoutingProtocol::RoutingTableComputation  (void)
   NS_LOG_DEBUG (Simulator::Now ().As (Time::S) << " : Node " << m_mainAddress
                                                << ": RoutingTableComputation begin...");
 
+  // The routing table only depends on the sets of the state, and on
+  // which links are still valid: compute it again only if one of them changed.
+  Time now = Simulator::Now ();
+  const LinkSet &linkSet = m_state.GetLinks ();
+  std::vector<bool> linkValidity;
+  linkValidity.reserve (linkSet.size ());
+  for (LinkSet::const_iterator it = linkSet.begin (); it != linkSet.end (); it++)
+    {
+      linkValidity.push_back (it->time >= now);
+    }
+  if (m_routingTableVersion == m_state.GetRoutingVersion ()
+      && linkValidity == m_routingTableLinkValidity)
+    {
+      NS_LOG_DEBUG ("Node " << m_mainAddress << ": state unchanged, RoutingTableComputation skipped.");
+      return;
+    }
+  m_routingTableVersion = m_state.GetRoutingVersion ();
+  m_routingTableLinkValidity.swap (linkValidity);
+
   // 1. All the entries from the routing table are removed.
   Clear ();
 
+  // Index the valid link tuples by the main address of the neighbor, in the
+  // order of the Link Set.
+  std::map<Ipv4Address, std::vector<const LinkTuple *> > validLinks;
+  for (std::size_t i = 0; i < linkSet.size (); i++)
+    {
+      LinkTuple const &link_tuple = linkSet[i];
+      NS_LOG_DEBUG ("Looking at link tuple: " << link_tuple
+                                              << (m_routingTableLinkValidity[i] ? "" : " (expired)"));
+      if (m_routingTableLinkValidity[i])
+        {
+          validLinks[GetMainAddress (link_tuple.neighborIfaceAddr)].push_back (&link_tuple);
+        }
+    }
+
   // 2. The new routing entries are added starting with the
   // symmetric neighbors (h=1) as the destination nodes.
   const NeighborSet &neighborSet = m_state.GetNeighbors ();
+  // the symmetric neighbors, and the neighbors with willingness different of WILL_NEVER
+  std::set<Ipv4Address> symNeighbors;
+  std::set<Ipv4Address> willingNeighbors;
   for (NeighborSet::const_iterator it = neighborSet.begin ();
        it != neighborSet.end (); it++)
     {
       NeighborTuple const &nb_tuple = *it;
       NS_LOG_DEBUG ("Looking at neighbor tuple: " << nb_tuple);
+      if (nb_tuple.willingness != OLSR_WILL_NEVER)
+        {
+          willingNeighbors.insert (nb_tuple.neighborMainAddr);
+        }
       if (nb_tuple.status == NeighborTuple::STATUS_SYM)
         {
+          symNeighbors.insert (nb_tuple.neighborMainAddr);
           bool nb_main_addr = false;
           const LinkTuple *lt = NULL;
-          const LinkSet &linkSet = m_state.GetLinks ();
-          for (LinkSet::const_iterator it2 = linkSet.begin ();
-               it2 != linkSet.end (); it2++)
+          std::map<Ipv4Address, std::vector<const LinkTuple *> >::const_iterator links =
+            validLinks.find (nb_tuple.neighborMainAddr);
+          if (links != validLinks.end ())
             {
-              LinkTuple const &link_tuple = *it2;
-              NS_LOG_DEBUG ("Looking at link tuple: " << link_tuple
-                                                      << (link_tuple.time >= Simulator::Now () ? "" : " (expired)"));
-              if ((GetMainAddress (link_tuple.neighborIfaceAddr) == nb_tuple.neighborMainAddr)
-                  && link_tuple.time >= Simulator::Now ())
+              for (std::vector<const LinkTuple *>::const_iterator it2 = links->second.begin ();
+                   it2 != links->second.end (); it2++)
                 {
+                  LinkTuple const &link_tuple = **it2;
                   NS_LOG_LOGIC ("Link tuple matches neighbor " << nb_tuple.neighborMainAddr
                                                                << " => adding routing table entry to neighbor");
                   lt = &link_tuple;
@@ -1015,13 +1065,6 @@ RoutingProtocol::RoutingTableComputation  (void)
                       nb_main_addr = true;
                     }
                 }
-              else
-                {
-                  NS_LOG_LOGIC ("Link tuple: linkMainAddress= " << GetMainAddress (link_tuple.neighborIfaceAddr)
-                                                                << "; neighborMainAddr =  " << nb_tuple.neighborMainAddr
-                                                                << "; expired=" << int (link_tuple.time < Simulator::Now ())
-                                                                << " => IGNORE");
-                }
             }
 
           // If, in the above, no R_dest_addr is equal to the main
@@ -1059,7 +1102,7 @@ RoutingProtocol::RoutingTableComputation  (void)
       NS_LOG_LOGIC ("Looking at two-hop neighbor tuple: " << nb2hop_tuple);
 
       // a 2-hop neighbor which is not a neighbor node or the node itself
-      if (m_state.FindSymNeighborTuple (nb2hop_tuple.twoHopNeighborAddr))
+      if (symNeighbors.find (nb2hop_tuple.twoHopNeighborAddr) != symNeighbors.end ())
         {
           NS_LOG_LOGIC ("Two-hop neighbor tuple is also neighbor; skipped.");
           continue;
@@ -1074,18 +1117,7 @@ RoutingProtocol::RoutingTableComputation  (void)
       // ...and such that there exist at least one entry in the 2-hop
       // neighbor set where N_neighbor_main_addr correspond to a
       // neighbor node with willingness different of WILL_NEVER...
-      bool nb2hopOk = false;
-      for (NeighborSet::const_iterator neighbor = neighborSet.begin ();
-           neighbor != neighborSet.end (); neighbor++)
-        {
-          if (neighbor->neighborMainAddr == nb2hop_tuple.neighborMainAddr
-              && neighbor->willingness != OLSR_WILL_NEVER)
-            {
-              nb2hopOk = true;
-              break;
-            }
-        }
-      if (!nb2hopOk)
+      if (willingNeighbors.find (nb2hop_tuple.neighborMainAddr) == willingNeighbors.end ())
         {
           NS_LOG_LOGIC ("Two-hop neighbor tuple skipped: 2-hop neighbor "
                         << nb2hop_tuple.twoHopNeighborAddr
@@ -1123,21 +1155,57 @@ RoutingProtocol::RoutingTableComputation  (void)
         }
     }
 
-  for (uint32_t h = 2;; h++)
+  // The destinations at distance h, from which the routes at distance h+1
+  // are computed, starting with the 2-hop neighbors.
+  std::vector<Ipv4Address> frontier;
+  for (std::map<Ipv4Address, RoutingTableEntry>::const_iterator it = m_table.begin ();
+       it != m_table.end (); it++)
+    {
+      if (it->second.distance == 2)
+        {
+          frontier.push_back (it->first);
+        }
+    }
+
+  // Index the topology tuples by their T_last_addr, in the order of the
+  // Topology Set.
+  const TopologySet &topology = m_state.GetTopologySet ();
+  std::map<Ipv4Address, std::vector<std::size_t> > topologyByLastAddr;
+  for (std::size_t i = 0; i < topology.size (); i++)
     {
-      bool added = false;
+      topologyByLastAddr[topology[i].lastAddr].push_back (i);
+    }
 
+  for (uint32_t h = 2; !frontier.empty (); h++)
+    {
       // 3.1. For each topology entry in the topology table, if its
       // T_dest_addr does not correspond to R_dest_addr of any
       // route entry in the routing table AND its T_last_addr
       // corresponds to R_dest_addr of a route entry whose R_dist
       // is equal to h, then a new route entry MUST be recorded in
       // the routing table (if it does not already exist)
-      const TopologySet &topology = m_state.GetTopologySet ();
-      for (TopologySet::const_iterator it = topology.begin ();
-           it != topology.end (); it++)
+      //
+      // The entries whose R_dist is equal to h are those of the
+      // frontier, so only the topology tuples whose T_last_addr is in
+      // the frontier are looked at, in the order of the Topology Set.
+      std::vector<std::size_t> candidates;
+      for (std::vector<Ipv4Address>::const_iterator it = frontier.begin ();
+           it != frontier.end (); it++)
+        {
+          std::map<Ipv4Address, std::vector<std::size_t> >::const_iterator tuples =
+            topologyByLastAddr.find (*it);
+          if (tuples != topologyByLastAddr.end ())
+            {
+              candidates.insert (candidates.end (), tuples->second.begin (), tuples->second.end ());
+            }
+        }
+      std::sort (candidates.begin (), candidates.end ());
+
+      frontier.clear ();
+      for (std::vector<std::size_t>::const_iterator it = candidates.begin ();
+           it != candidates.end (); it++)
         {
-          const TopologyTuple &topology_tuple = *it;
+          const TopologyTuple &topology_tuple = topology[*it];
           NS_LOG_LOGIC ("Looking at topology tuple: " << topology_tuple);
 
           RoutingTableEntry destAddrEntry, lastAddrEntry;
@@ -1160,7 +1228,7 @@ RoutingProtocol::RoutingTableComputation  (void)
                         lastAddrEntry.nextAddr,
                         lastAddrEntry.interface,
                         h + 1);
-              added = true;
+              frontier.push_back (topology_tuple.destAddr);
             }
           else
             {
@@ -1171,11 +1239,6 @@ RoutingProtocol::RoutingTableComputation  (void)
                                                   << " (h=" << h << ")");
             }
         }
-
-      if (!added)
-        {
-          break;
-        }
     }
 
   // 4. For each entry in the multiple interface association base
@@ -1288,6 +1351,13 @@ RoutingProtocol::RoutingTableComputation  (void)
   m_routingTableChanged (GetSize ());
 }
 
+void
+RoutingProtocol::InvalidateComputations (void)
+{
+  m_mprComputationVersion = 0;
+  m_routingTableVersion = 0;
+}
+
 
 void
 RoutingProtocol::ProcessHello (const olsr::MessageHeader &msg,
@@ -1487,18 +1557,35 @@ RoutingProtocol::ProcessMid (const olsr::MessageHeader &msg,
   // 3. (not part of the RFC) iterate over all NeighborTuple's and
   // TwoHopNeighborTuples, update the neighbor addresses taking into account
   // the new MID information.
+  bool neighborhoodChanged = false;
   NeighborSet &neighbors = m_state.GetNeighbors ();
   for (NeighborSet::iterator neighbor = neighbors.begin (); neighbor != neighbors.end (); neighbor++)
     {
-      neighbor->neighborMainAddr = GetMainAddress (neighbor->neighborMainAddr);
+      Ipv4Address mainAddr = GetMainAddress (neighbor->neighborMainAddr);
+      if (mainAddr != neighbor->neighborMainAddr)
+        {
+          neighbor->neighborMainAddr = mainAddr;
+          neighborhoodChanged = true;
+        }
     }
 
   TwoHopNeighborSet &twoHopNeighbors = m_state.GetTwoHopNeighbors ();
   for (TwoHopNeighborSet::iterator twoHopNeighbor = twoHopNeighbors.begin ();
        twoHopNeighbor != twoHopNeighbors.end (); twoHopNeighbor++)
     {
-      twoHopNeighbor->neighborMainAddr = GetMainAddress (twoHopNeighbor->neighborMainAddr);
-      twoHopNeighbor->twoHopNeighborAddr = GetMainAddress (twoHopNeighbor->twoHopNeighborAddr);
+      Ipv4Address neighborMainAddr = GetMainAddress (twoHopNeighbor->neighborMainAddr);
+      Ipv4Address twoHopNeighborAddr = GetMainAddress (twoHopNeighbor->twoHopNeighborAddr);
+      if (neighborMainAddr != twoHopNeighbor->neighborMainAddr
+          || twoHopNeighborAddr != twoHopNeighbor->twoHopNeighborAddr)
+        {
+          twoHopNeighbor->neighborMainAddr = neighborMainAddr;
+          twoHopNeighbor->twoHopNeighborAddr = twoHopNeighborAddr;
+          neighborhoodChanged = true;
+        }
+    }
+  if (neighborhoodChanged)
+    {
+      m_state.NotifyNeighborhoodChanged ();
     }
   NS_LOG_DEBUG ("Node " << m_mainAddress << " ProcessMid from " << senderIface << " -> END.");
 }
@@ -2148,9 +2235,10 @@ RoutingProtocol::PopulateNeighborSet (const olsr::MessageHeader &msg,
                                       const olsr::MessageHeader::Hello &hello)
 {
   NeighborTuple *nb_tuple = m_state.FindNeighborTuple (msg.GetOriginatorAddress ());
-  if (nb_tuple != NULL)
+  if (nb_tuple != NULL && nb_tuple->willingness != hello.willingness)
     {
       nb_tuple->willingness = hello.willingness;
+      m_state.NotifyNeighborhoodChanged ();
     }
 }
 
@@ -2473,6 +2561,10 @@ RoutingProtocol::LinkTupleUpdated (const LinkTuple &tuple, uint8_t willingness)
           NS_LOG_DEBUG (*nb_tuple << "->status = STATUS_NOT_SYM; changed:"
                                   << int (statusBefore != nb_tuple->status));
         }
+      if (statusBefore != nb_tuple->status)
+        {
+          m_state.NotifyNeighborhoodChanged ();
+        }
     }
   else
     {
@@ -3080,10 +3172,13 @@ RoutingProtocol::NotifyInterfaceDown (uint32_t i)
 void
 RoutingProtocol::NotifyAddAddress (uint32_t interface, Ipv4InterfaceAddress address)
 {
+  // the routing table entries refer to interfaces by index
+  InvalidateComputations ();
 }
 void
 RoutingProtocol::NotifyRemoveAddress (uint32_t interface, Ipv4InterfaceAddress address)
 {
+  InvalidateComputations ();
 }
 
 
@@ -388,14 +388,26 @@ private:
 
   /**
    * \brief Computates MPR set of a node following \RFC{3626} hints.
+   *
+   * Nothing is done if neither the Neighbor Set nor the 2-hop Neighbor Set
+   * changed since the last computation.
    */
   void MprComputation (void);
 
   /**
    * \brief Creates the routing table of the node following \RFC{3626} hints.
+   *
+   * Nothing is done if none of the sets the routing table is computed from
+   * changed since the last computation, and if no link expired.
    */
   void RoutingTableComputation (void);
 
+  /**
+   * \brief Forces the next MPR and routing table computations, e.g., after
+   * a change of the main address or of the interfaces of the node.
+   */
+  void InvalidateComputations (void);
+
 public:
   /**
    * \brief Gets the main address associated with a given interface address.
@@ -822,6 +834,13 @@ private:
   /// Routing table chanes challback
   TracedCallback <uint32_t> m_routingTableChanged;
 
+  /// OlsrState::GetNeighborhoodVersion at the last MPR computation, 0 if none
+  uint32_t m_mprComputationVersion;
+  /// OlsrState::GetRoutingVersion at the last routing table computation, 0 if none
+  uint32_t m_routingTableVersion;
+  /// Whether each tuple of the Link Set was valid at the last routing table computation
+  std::vector<bool> m_routingTableLinkValidity;
+
   /// Provides uniform random variables.
   Ptr<UniformRandomVariable> m_uniformRandomVariable;
 
@@ -159,6 +159,7 @@ OlsrState::EraseNeighborTuple (const NeighborTuple &tuple)
       if (*it == tuple)
         {
           m_neighborSet.erase (it);
+          NeighborhoodChanged ();
           break;
         }
     }
@@ -173,6 +174,7 @@ OlsrState::EraseNeighborTuple (const Ipv4Address &mainAddr)
       if (it->neighborMainAddr == mainAddr)
         {
           it = m_neighborSet.erase (it);
+          NeighborhoodChanged ();
           break;
         }
     }
@@ -187,11 +189,16 @@ OlsrState::InsertNeighborTuple (NeighborTuple const &tuple)
       if (it->neighborMainAddr == tuple.neighborMainAddr)
         {
           // Update it
-          *it = tuple;
+          if (!(*it == tuple))
+            {
+              *it = tuple;
+              NeighborhoodChanged ();
+            }
           return;
         }
     }
   m_neighborSet.push_back (tuple);
+  NeighborhoodChanged ();
 }
 
 /********** Neighbor 2 Hop Set Manipulation **********/
@@ -221,6 +228,7 @@ OlsrState::EraseTwoHopNeighborTuple (const TwoHopNeighborTuple &tuple)
       if (*it == tuple)
         {
           m_twoHopNeighborSet.erase (it);
+          NeighborhoodChanged ();
           break;
         }
     }
@@ -237,6 +245,7 @@ OlsrState::EraseTwoHopNeighborTuples (const Ipv4Address &neighborMainAddr,
           && it->twoHopNeighborAddr == twoHopNeighborAddr)
         {
           it = m_twoHopNeighborSet.erase (it);
+          NeighborhoodChanged ();
         }
       else
         {
@@ -254,6 +263,7 @@ OlsrState::EraseTwoHopNeighborTuples (const Ipv4Address &neighborMainAddr)
       if (it->neighborMainAddr == neighborMainAddr)
         {
           it = m_twoHopNeighborSet.erase (it);
+          NeighborhoodChanged ();
         }
       else
         {
@@ -266,6 +276,7 @@ void
 OlsrState::InsertTwoHopNeighborTuple (TwoHopNeighborTuple const &tuple)
 {
   m_twoHopNeighborSet.push_back (tuple);
+  NeighborhoodChanged ();
 }
 
 /********** MPR Set Manipulation **********/
@@ -370,6 +381,7 @@ OlsrState::EraseLinkTuple (const LinkTuple &tuple)
       if (*it == tuple)
         {
           m_linkSet.erase (it);
+          m_routingVersion++;
           break;
         }
     }
@@ -379,6 +391,7 @@ LinkTuple&
 OlsrState::InsertLinkTuple (LinkTuple const &tuple)
 {
   m_linkSet.push_back (tuple);
+  m_routingVersion++;
   return m_linkSet.back ();
 }
 
@@ -422,6 +435,7 @@ OlsrState::EraseTopologyTuple (const TopologyTuple &tuple)
       if (*it == tuple)
         {
           m_topologySet.erase (it);
+          m_routingVersion++;
           break;
         }
     }
@@ -436,6 +450,7 @@ OlsrState::EraseOlderTopologyTuples (const Ipv4Address &lastAddr, uint16_t ansn)
       if (it->lastAddr == lastAddr && it->sequenceNumber < ansn)
         {
           it = m_topologySet.erase (it);
+          m_routingVersion++;
         }
       else
         {
@@ -448,6 +463,7 @@ void
 OlsrState::InsertTopologyTuple (TopologyTuple const &tuple)
 {
   m_topologySet.push_back (tuple);
+  m_routingVersion++;
 }
 
 /********** Interface Association Set Manipulation **********/
@@ -489,6 +505,7 @@ OlsrState::EraseIfaceAssocTuple (const IfaceAssocTuple &tuple)
       if (*it == tuple)
         {
           m_ifaceAssocSet.erase (it);
+          m_routingVersion++;
           break;
         }
     }
@@ -498,6 +515,7 @@ void
 OlsrState::InsertIfaceAssocTuple (const IfaceAssocTuple &tuple)
 {
   m_ifaceAssocSet.push_back (tuple);
+  m_routingVersion++;
 }
 
 std::vector<Ipv4Address>
@@ -540,6 +558,7 @@ OlsrState::EraseAssociationTuple (const AssociationTuple &tuple)
       if (*it == tuple)
         {
           m_associationSet.erase (it);
+          m_routingVersion++;
           break;
         }
     }
@@ -549,6 +568,7 @@ void
 OlsrState::InsertAssociationTuple (const AssociationTuple &tuple)
 {
   m_associationSet.push_back (tuple);
+  m_routingVersion++;
 }
 
 void
@@ -560,6 +580,7 @@ OlsrState::EraseAssociation (const Association &tuple)
       if (*it == tuple)
         {
           m_associations.erase (it);
+          m_routingVersion++;
           break;
         }
     }
@@ -569,6 +590,7 @@ void
 OlsrState::InsertAssociation (const Association &tuple)
 {
   m_associations.push_back (tuple);
+  m_routingVersion++;
 }
 
 }
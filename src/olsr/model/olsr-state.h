@@ -46,10 +46,60 @@ protected:
   IfaceAssocSet m_ifaceAssocSet;        //!< Interface Association Set (\RFC{3626}, section 4.1).
   AssociationSet m_associationSet; //!<	Association Set (\RFC{3626}, section12.2). Associations obtained from HNA messages generated by other nodes.
   Associations m_associations;  //!< The node's local Host Network Associations that will be advertised using HNA messages.
+  uint32_t m_neighborhoodVersion; //!< Incremented whenever the Neighbor Set or the 2-hop Neighbor Set changes.
+  uint32_t m_routingVersion;    //!< Incremented whenever a set used by the routing table computation changes.
+
+  /**
+   * Records a change of the Neighbor Set or of the 2-hop Neighbor Set,
+   * which are used both by the MPR and by the routing table computations.
+   */
+  void NeighborhoodChanged ()
+  {
+    m_neighborhoodVersion++;
+    m_routingVersion++;
+  }
 
 public:
   OlsrState ()
+    : m_neighborhoodVersion (1),
+      m_routingVersion (1)
+  {
+  }
+
+  // Versions
+
+  /**
+   * Gets the version of the Neighbor Set and of the 2-hop Neighbor Set, which
+   * is incremented whenever a tuple is inserted in, erased from or changed in
+   * one of them. The MPR set only needs to be computed again when this
+   * version changes.
+   * \returns The version of the neighborhood.
+   */
+  uint32_t GetNeighborhoodVersion () const
+  {
+    return m_neighborhoodVersion;
+  }
+
+  /**
+   * Gets the version of the sets used by the routing table computation (Link,
+   * Neighbor, 2-hop Neighbor, Topology, Interface Association and
+   * Association Sets, and the local associations), which is incremented
+   * whenever a tuple is inserted in, erased from or changed in one of them.
+   * Changes of the expiration times of the tuples are not counted.
+   * \returns The version of the routing state.
+   */
+  uint32_t GetRoutingVersion () const
+  {
+    return m_routingVersion;
+  }
+
+  /**
+   * Notifies that tuples of the Neighbor Set or of the 2-hop Neighbor Set
+   * were changed in place, through a pointer or a mutable reference.
+   */
+  void NotifyNeighborhoodChanged ()
   {
+    NeighborhoodChanged ();
   }
 
   // MPR selector
@@ -106,6 +156,7 @@ public:
   }
   /**
    * Gets the neighbor set.
+   * The caller must call NotifyNeighborhoodChanged after changing its tuples.
    * \returns The neighbor set.
    */
   NeighborSet & GetNeighbors ()
@@ -165,6 +216,7 @@ public:
   }
   /**
    * Gets the 2-hop neighbor set.
+   * The caller must call NotifyNeighborhoodChanged after changing its tuples.
    * \returns The 2-hop neighbor set.
    */
   TwoHopNeighborSet & GetTwoHopNeighbors ()
@@ -338,6 +390,8 @@ public:
   }
   /**
    * Gets a mutable reference to the interface association set.
+   * Only the expiration time of its tuples may be changed in place, since
+   * the routing version is not incremented.
    * \returns The interface association set.
    */
   IfaceAssocSet & GetIfaceAssocSetMutable ()
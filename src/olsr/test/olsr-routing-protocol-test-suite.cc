@@ -176,6 +176,84 @@ OlsrMprTestCase::DoRun ()
   mpr = state.GetMprSet ();
   NS_TEST_EXPECT_MSG_EQ (mpr.size (), 3, "An only address must be chosen.");
   NS_TEST_EXPECT_MSG_EQ ((mpr.find ("10.0.0.9") == mpr.end ()), true, "Node 1 must NOT select node 8 as MPR");
+  /*
+   * Same topology, but node 8 changes its willingness to OLSR_WILL_DEFAULT,
+   * in place.
+   *
+   * Node 1 must select nodes 2, 3, 7 and 8 as MPRs.
+   */
+  protocol->m_state.FindNeighborTuple (Ipv4Address ("10.0.0.8"))->willingness = OLSR_WILL_DEFAULT;
+  protocol->MprComputation ();
+  NS_TEST_EXPECT_MSG_EQ (state.GetMprSet ().size (), 3, "The MPR set must not be computed again if the state is unchanged.");
+  protocol->m_state.NotifyNeighborhoodChanged ();
+  protocol->MprComputation ();
+  mpr = state.GetMprSet ();
+  NS_TEST_EXPECT_MSG_EQ (mpr.size (), 4, "The MPR set must be computed again after a change of the neighborhood.");
+  NS_TEST_EXPECT_MSG_EQ ((mpr.find ("10.0.0.8") != mpr.end ()), true, "Node 1 must select node 8 as MPR");
+}
+
+/**
+ * \ingroup olsr-test
+ * \ingroup tests
+ *
+ * Testcase for the versions of the OLSR state, which only change when a set
+ * effectively changes.
+ */
+class OlsrStateVersionTestCase : public TestCase
+{
+public:
+  OlsrStateVersionTestCase ();
+  virtual void DoRun (void);
+};
+
+OlsrStateVersionTestCase::OlsrStateVersionTestCase ()
+  : TestCase ("Check OLSR state versions")
+{
+}
+
+void
+OlsrStateVersionTestCase::DoRun ()
+{
+  OlsrState state;
+  uint32_t neighborhood = state.GetNeighborhoodVersion ();
+  uint32_t routing = state.GetRoutingVersion ();
+
+  NeighborTuple neighbor;
+  neighbor.status = NeighborTuple::STATUS_SYM;
+  neighbor.willingness = OLSR_WILL_DEFAULT;
+  neighbor.neighborMainAddr = Ipv4Address ("10.0.0.2");
+  state.InsertNeighborTuple (neighbor);
+  NS_TEST_EXPECT_MSG_NE (state.GetNeighborhoodVersion (), neighborhood, "Inserting a neighbor changes the neighborhood");
+  NS_TEST_EXPECT_MSG_NE (state.GetRoutingVersion (), routing, "Inserting a neighbor changes the routing state");
+
+  neighborhood = state.GetNeighborhoodVersion ();
+  routing = state.GetRoutingVersion ();
+  state.InsertNeighborTuple (neighbor);
+  state.EraseNeighborTuple (Ipv4Address ("10.0.0.3"));
+  state.EraseTwoHopNeighborTuples (Ipv4Address ("10.0.0.2"));
+  state.EraseOlderTopologyTuples (Ipv4Address ("10.0.0.2"), 10);
+  NS_TEST_EXPECT_MSG_EQ (state.GetNeighborhoodVersion (), neighborhood, "No tuple was changed");
+  NS_TEST_EXPECT_MSG_EQ (state.GetRoutingVersion (), routing, "No tuple was changed");
+
+  neighbor.willingness = OLSR_WILL_HIGH;
+  state.InsertNeighborTuple (neighbor);
+  NS_TEST_EXPECT_MSG_NE (state.GetNeighborhoodVersion (), neighborhood, "Updating a neighbor changes the neighborhood");
+
+  neighborhood = state.GetNeighborhoodVersion ();
+  routing = state.GetRoutingVersion ();
+  TopologyTuple topology;
+  topology.destAddr = Ipv4Address ("10.0.0.4");
+  topology.lastAddr = Ipv4Address ("10.0.0.2");
+  topology.sequenceNumber = 1;
+  topology.expirationTime = Seconds (10);
+  state.InsertTopologyTuple (topology);
+  NS_TEST_EXPECT_MSG_EQ (state.GetNeighborhoodVersion (), neighborhood, "Inserting a topology tuple does not change the neighborhood");
+  NS_TEST_EXPECT_MSG_NE (state.GetRoutingVersion (), routing, "Inserting a topology tuple changes the routing state");
+
+  routing = state.GetRoutingVersion ();
+  state.EraseOlderTopologyTuples (Ipv4Address ("10.0.0.2"), 10);
+  NS_TEST_EXPECT_MSG_NE (state.GetRoutingVersion (), routing, "Erasing a topology tuple changes the routing state");
+  NS_TEST_EXPECT_MSG_EQ (state.GetTopologySet ().size (), 0, "The topology tuple was not erased");
 }
 
 /**
@@ -194,6 +272,7 @@ OlsrProtocolTestSuite::OlsrProtocolTestSuite ()
   : TestSuite ("routing-olsr", UNIT)
 {
   AddTestCase (new OlsrMprTestCase (), TestCase::QUICK);
+  AddTestCase (new OlsrStateVersionTestCase (), TestCase::QUICK);
 }
 
 static OlsrProtocolTestSuite g_olsrProtocolTestSuite; //!< Static variable for test initialization
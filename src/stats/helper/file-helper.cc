@@ -41,6 +41,8 @@ FileHelper::FileHelper ()
 {
   NS_LOG_FUNCTION (this);
 
+  m_adaptorFactory.SetTypeId ("ns3::TimeSeriesAdaptor");
+
   // Note that this does not construct an aggregator. It will be
   // constructed later when needed.
 }
@@ -55,6 +57,8 @@ FileHelper::FileHelper (const std::string &outputFileNameWithoutExtension,
 {
   NS_LOG_FUNCTION (this);
 
+  m_adaptorFactory.SetTypeId ("ns3::TimeSeriesAdaptor");
+
   // Note that this does not construct an aggregator. It will be
   // constructed later when needed.
 }
@@ -212,6 +216,14 @@ FileHelper::AddProbe (const std::string &typeId,
   m_probeMap[probeName] = std::make_pair (probe, typeId);
 }
 
+void
+FileHelper::SetAdaptorAttribute (const std::string &name, const AttributeValue &value)
+{
+  NS_LOG_FUNCTION (this << name);
+
+  m_adaptorFactory.Set (name, value);
+}
+
 void
 FileHelper::AddTimeSeriesAdaptor (const std::string &adaptorName)
 {
@@ -224,7 +236,7 @@ FileHelper::AddTimeSeriesAdaptor (const std::string &adaptorName)
     }
 
   // Create the time series adaptor.
-  Ptr<TimeSeriesAdaptor> timeSeriesAdaptor = CreateObject<TimeSeriesAdaptor> ();
+  Ptr<TimeSeriesAdaptor> timeSeriesAdaptor = m_adaptorFactory.Create<TimeSeriesAdaptor> ();
 
   // Enable logging of data for the time series adaptor.
   timeSeriesAdaptor->Enable ();
@@ -45,6 +45,8 @@ GnuplotHelper::GnuplotHelper ()
 {
   NS_LOG_FUNCTION (this);
 
+  m_adaptorFactory.SetTypeId ("ns3::TimeSeriesAdaptor");
+
   // Note that this does not construct an aggregator. It will be
   // constructed later when needed.
 }
@@ -64,6 +66,8 @@ GnuplotHelper::GnuplotHelper (const std::string &outputFileNameWithoutExtension,
 {
   NS_LOG_FUNCTION (this);
 
+  m_adaptorFactory.SetTypeId ("ns3::TimeSeriesAdaptor");
+
   // Construct the aggregator.
   ConstructAggregator ();
 }
@@ -237,6 +241,14 @@ GnuplotHelper::AddProbe (const std::string &typeId,
   m_probeMap[probeName] = std::make_pair (probe, typeId);
 }
 
+void
+GnuplotHelper::SetAdaptorAttribute (const std::string &name, const AttributeValue &value)
+{
+  NS_LOG_FUNCTION (this << name);
+
+  m_adaptorFactory.Set (name, value);
+}
+
 void
 GnuplotHelper::AddTimeSeriesAdaptor (const std::string &adaptorName)
 {
@@ -249,7 +261,7 @@ GnuplotHelper::AddTimeSeriesAdaptor (const std::string &adaptorName)
     }
 
   // Create the time series adaptor.
-  Ptr<TimeSeriesAdaptor> timeSeriesAdaptor = CreateObject<TimeSeriesAdaptor> ();
+  Ptr<TimeSeriesAdaptor> timeSeriesAdaptor = m_adaptorFactory.Create<TimeSeriesAdaptor> ();
 
   // Enable logging of data for the time series adaptor.
   timeSeriesAdaptor->Enable ();
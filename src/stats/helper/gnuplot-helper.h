@@ -125,6 +125,20 @@ public:
                   const std::string &title,
                   enum GnuplotAggregator::KeyLocation keyLocation = GnuplotAggregator::KEY_INSIDE);
 
+  /**
+   * \param name the name of the attribute to set.
+   * \param value the value of the attribute to set.
+   *
+   * \brief Sets an attribute of the time series adaptors created for the
+   * probes added afterwards.
+   *
+   * Setting the AggregationWindow attribute of the TimeSeriesAdaptor
+   * class, for instance, reduces the values of the next probes to a
+   * statistic per window before they are written, which can be chosen
+   * probe by probe.
+   */
+  void SetAdaptorAttribute (const std::string &name, const AttributeValue &value);
+
   /**
    * \param adaptorName the timeSeriesAdaptor's name.
    *
@@ -185,6 +199,9 @@ private:
   /// Used to create the probes and collectors as they are added.
   ObjectFactory m_factory;
 
+  /// Used to create the time series adaptors as they are added.
+  ObjectFactory m_adaptorFactory;
+
   /// The aggregator used to make the plots.
   Ptr<GnuplotAggregator> m_aggregator;
 
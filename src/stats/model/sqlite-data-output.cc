@@ -62,10 +62,20 @@ SqliteDataOutput::Output (DataCollector &dc)
 
   std::string m_dbFile = m_filePrefix + ".db";
   std::string run = dc.GetRunLabel ();
+  // the statements bind the labels without copying them
+  std::string experiment = dc.GetExperimentLabel ();
+  std::string strategy = dc.GetStrategyLabel ();
+  std::string input = dc.GetInputLabel ();
+  std::string description = dc.GetDescription ();
   bool res;
 
   m_sqliteOut = new SQLiteOutput (m_dbFile, "ns-3-sqlite-data-output-sem");
 
+  // Write everything in a single transaction: outside of a transaction,
+  // every insert is committed, and synced to the disk, on its own.
+  res = m_sqliteOut->SpinExec ("BEGIN");
+  NS_ASSERT (res);
+
   res = m_sqliteOut->SpinExec ("CREATE TABLE IF NOT EXISTS Experiments (run, experiment, strategy, input, description text)");
   NS_ASSERT (res);
 
@@ -78,18 +88,16 @@ SqliteDataOutput::Output (DataCollector &dc)
 
   res = m_sqliteOut->Bind (stmt, 1, run);
   NS_ASSERT (res);
-  res = m_sqliteOut->Bind (stmt, 2, dc.GetExperimentLabel ());
+  res = m_sqliteOut->Bind (stmt, 2, experiment);
   NS_ASSERT (res);
-  res = m_sqliteOut->Bind (stmt, 3, dc.GetStrategyLabel ());
+  res = m_sqliteOut->Bind (stmt, 3, strategy);
   NS_ASSERT (res);
-  res = m_sqliteOut->Bind (stmt, 4, dc.GetInputLabel ());
+  res = m_sqliteOut->Bind (stmt, 4, input);
   NS_ASSERT (res);
-  res = m_sqliteOut->Bind (stmt, 5, dc.GetDescription ());
+  res = m_sqliteOut->Bind (stmt, 5, description);
   NS_ASSERT (res);
 
-  res = m_sqliteOut->SpinStep (stmt);
-  NS_ASSERT (res);
-  res = m_sqliteOut->SpinFinalize (stmt);
+  res = m_sqliteOut->SpinExec (stmt);
   NS_ASSERT (res);
 
   res = m_sqliteOut->WaitExec ("CREATE TABLE IF NOT EXISTS " \
@@ -102,12 +110,12 @@ SqliteDataOutput::Output (DataCollector &dc)
                                   "values (?, ?, ?)");
   NS_ASSERT (res);
 
+  m_sqliteOut->Bind (stmt, 1, run);
   for (MetadataList::iterator i = dc.MetadataBegin ();
        i != dc.MetadataEnd (); i++)
     {
-      std::pair<std::string, std::string> blob = (*i);
+      const std::pair<std::string, std::string> &blob = (*i);
       m_sqliteOut->SpinReset (stmt);
-      m_sqliteOut->Bind (stmt, 1, run);
       m_sqliteOut->Bind (stmt, 2, blob.first);
       m_sqliteOut->Bind (stmt, 3, blob.second);
       m_sqliteOut->SpinStep (stmt);
@@ -115,14 +123,16 @@ SqliteDataOutput::Output (DataCollector &dc)
 
   m_sqliteOut->SpinFinalize (stmt);
 
-  m_sqliteOut->SpinExec ("BEGIN");
-  SqliteOutputCallback callback (m_sqliteOut, run);
-  for (DataCalculatorList::iterator i = dc.DataCalculatorBegin ();
-       i != dc.DataCalculatorEnd (); i++)
-    {
-      (*i)->Output (callback);
-    }
-  m_sqliteOut->SpinExec ("COMMIT");
+  {
+    SqliteOutputCallback callback (m_sqliteOut, run);
+    for (DataCalculatorList::iterator i = dc.DataCalculatorBegin ();
+         i != dc.DataCalculatorEnd (); i++)
+      {
+        (*i)->Output (callback);
+      }
+  }
+  res = m_sqliteOut->SpinExec ("COMMIT");
+  NS_ASSERT (res);
   // end SqliteDataOutput::Output
 }
 
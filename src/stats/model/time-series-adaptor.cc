@@ -20,12 +20,16 @@
 
 #include <cmath>
 #include <cfloat>
+#include <algorithm>
 
 #include "ns3/time-series-adaptor.h"
 #include "ns3/object.h"
 #include "ns3/traced-value.h"
 #include "ns3/log.h"
 #include "ns3/simulator.h"
+#include "ns3/double.h"
+#include "ns3/enum.h"
+#include "ns3/abort.h"
 
 namespace ns3 {
 
@@ -45,11 +49,45 @@ TimeSeriesAdaptor::GetTypeId (void)
                       "the current value converted to a double",
                       MakeTraceSourceAccessor (&TimeSeriesAdaptor::m_output),
                       "ns3::TimeSeriesAdaptor::OutputTracedCallback")
+    .AddAttribute ("AggregationWindow",
+                   "The duration of the windows of simulation time over which "
+                   "the values are reduced to a single output value, "
+                   "or zero to output every value",
+                   TimeValue (Seconds (0)),
+                   MakeTimeAccessor (&TimeSeriesAdaptor::m_window),
+                   MakeTimeChecker (Seconds (0)))
+    .AddAttribute ("Statistic",
+                   "The statistic of the values of each aggregation window "
+                   "which is output",
+                   EnumValue (TimeSeriesAdaptor::MEAN),
+                   MakeEnumAccessor (&TimeSeriesAdaptor::m_statistic),
+                   MakeEnumChecker (TimeSeriesAdaptor::MEAN, "Mean",
+                                    TimeSeriesAdaptor::MIN, "Min",
+                                    TimeSeriesAdaptor::MAX, "Max",
+                                    TimeSeriesAdaptor::SUM, "Sum",
+                                    TimeSeriesAdaptor::COUNT, "Count",
+                                    TimeSeriesAdaptor::QUANTILE, "Quantile"))
+    .AddAttribute ("Quantile",
+                   "The quantile output by the Quantile statistic",
+                   DoubleValue (0.5),
+                   MakeDoubleAccessor (&TimeSeriesAdaptor::m_quantile),
+                   MakeDoubleChecker<double> (0, 1))
+    .AddAttribute ("HistogramBinWidth",
+                   "The width of the bins of the histogram from which the "
+                   "Quantile statistic is estimated, which must be positive; "
+                   "the values must not be negative",
+                   DoubleValue (1),
+                   MakeDoubleAccessor (&TimeSeriesAdaptor::m_binWidth),
+                   MakeDoubleChecker<double> (DBL_MIN))
   ;
   return tid;
 }
 
 TimeSeriesAdaptor::TimeSeriesAdaptor ()
+  : m_count (0),
+    m_sum (0),
+    m_min (0),
+    m_max (0)
 {
   NS_LOG_FUNCTION (this);
 }
@@ -59,6 +97,14 @@ TimeSeriesAdaptor::~TimeSeriesAdaptor ()
   NS_LOG_FUNCTION (this);
 }
 
+void
+TimeSeriesAdaptor::DoDispose (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_outputEvent.Cancel ();
+  DataCollectionObject::DoDispose ();
+}
+
 void
 TimeSeriesAdaptor::TraceSinkDouble (double oldData, double newData)
 {
@@ -71,10 +117,110 @@ TimeSeriesAdaptor::TraceSinkDouble (double oldData, double newData)
       return;
     }
 
+  if (!m_window.IsZero ())
+    {
+      Aggregate (newData);
+      return;
+    }
+
   // Time stamp the value with the current time in seconds.
   m_output (Simulator::Now ().GetSeconds (), newData);
 }
 
+void
+TimeSeriesAdaptor::Aggregate (double data)
+{
+  Time now = Simulator::Now ();
+
+  // The window may end at the time of this value, before its output
+  // event is run.
+  if (m_count > 0 && now >= m_windowEnd)
+    {
+      m_outputEvent.Cancel ();
+      OutputWindow ();
+    }
+
+  if (m_count == 0)
+    {
+      // The windows are aligned on multiples of their duration, and
+      // only output when they have values.
+      int64_t index = now.GetTimeStep () / m_window.GetTimeStep ();
+      m_windowEnd = TimeStep ((index + 1) * m_window.GetTimeStep ());
+      m_outputEvent = Simulator::Schedule (m_windowEnd - now, &TimeSeriesAdaptor::OutputWindow, this);
+      m_sum = 0;
+      m_min = data;
+      m_max = data;
+      if (m_statistic == QUANTILE)
+        {
+          m_histogram = Histogram (m_binWidth);
+        }
+    }
+
+  m_count++;
+  m_sum += data;
+  m_min = std::min (m_min, data);
+  m_max = std::max (m_max, data);
+  if (m_statistic == QUANTILE)
+    {
+      NS_ABORT_MSG_IF (data < 0, "The Quantile statistic requires values which are not negative");
+      m_histogram.AddValue (data);
+    }
+}
+
+void
+TimeSeriesAdaptor::OutputWindow (void)
+{
+  NS_LOG_FUNCTION (this);
+
+  double value = 0;
+  switch (m_statistic)
+    {
+    case MEAN:
+      value = m_sum / m_count;
+      break;
+    case MIN:
+      value = m_min;
+      break;
+    case MAX:
+      value = m_max;
+      break;
+    case SUM:
+      value = m_sum;
+      break;
+    case COUNT:
+      value = m_count;
+      break;
+    case QUANTILE:
+      value = GetQuantile ();
+      break;
+    }
+  m_count = 0;
+
+  // Time stamp the statistic with the end of the window in seconds.
+  m_output (m_windowEnd.GetSeconds (), value);
+}
+
+double
+TimeSeriesAdaptor::GetQuantile (void)
+{
+  // Find the bin of the quantile, and interpolate linearly within it.
+  double rank = m_quantile * m_count;
+  double cumulated = 0;
+  for (uint32_t index = 0; index < m_histogram.GetNBins (); index++)
+    {
+      uint32_t binCount = m_histogram.GetBinCount (index);
+      if (binCount > 0 && cumulated + binCount >= rank)
+        {
+          double fraction = (rank - cumulated) / binCount;
+          double value = m_histogram.GetBinStart (index) + fraction * m_histogram.GetBinWidth (index);
+          // The values are known to be within the minimum and maximum.
+          return std::min (std::max (value, m_min), m_max);
+        }
+      cumulated += binCount;
+    }
+  return m_max;
+}
+
 void
 TimeSeriesAdaptor::TraceSinkBoolean (bool oldData, bool newData)
 {
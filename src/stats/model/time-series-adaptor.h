@@ -25,6 +25,9 @@
 #include "ns3/object.h"
 #include "ns3/type-id.h"
 #include "ns3/traced-value.h"
+#include "ns3/nstime.h"
+#include "ns3/event-id.h"
+#include "ns3/histogram.h"
 
 namespace ns3 {
 
@@ -44,6 +47,17 @@ namespace ns3 {
  *
  * It should be noted that time series adaptors convert
  * Simulation Time objects to double values in its output.
+ *
+ * By default, every value is output as soon as it is received. When the
+ * AggregationWindow attribute is set, the values are instead reduced to
+ * a single statistic (the mean, minimum, maximum, sum or count of the
+ * values, or a quantile estimated from a Histogram of the values) over
+ * consecutive windows of simulation time, and only this statistic is
+ * output, at the end of each window with at least one value.  This keeps
+ * the cost of the downstream aggregators, which format and write every
+ * output value, independent of the number of values probed.  The values
+ * of a window which has not ended when the simulation stops are not
+ * output.
  */
 class TimeSeriesAdaptor : public DataCollectionObject
 {
@@ -54,6 +68,17 @@ public:
    */
   static TypeId GetTypeId (void);
 
+  /// Statistic output for each aggregation window
+  enum Statistic
+  {
+    MEAN,     //!< the mean of the values
+    MIN,      //!< the minimum value
+    MAX,      //!< the maximum value
+    SUM,      //!< the sum of the values
+    COUNT,    //!< the number of values
+    QUANTILE  //!< the quantile set by the Quantile attribute
+  };
+
   TimeSeriesAdaptor ();
   virtual ~TimeSeriesAdaptor ();
 
@@ -120,8 +145,43 @@ public:
    */
   typedef void (* OutputTracedCallback) (const double now, const double data);
   
+protected:
+  virtual void DoDispose (void);
+
 private:
+  /**
+   * \brief Add a value to the current aggregation window.
+   * \param data the value.
+   */
+  void Aggregate (double data);
+
+  /**
+   * \brief Output the statistic of the current aggregation window, and
+   * start a new window.
+   */
+  void OutputWindow (void);
+
+  /**
+   * \brief Estimate the quantile of the values of the current window
+   * from their histogram.
+   * \return the quantile.
+   */
+  double GetQuantile (void);
+
   TracedCallback<double, double> m_output; //!< output trace
+
+  Time m_window;             //!< duration of the aggregation windows, or zero
+  Statistic m_statistic;     //!< statistic output for each window
+  double m_quantile;         //!< quantile output by the QUANTILE statistic
+  double m_binWidth;         //!< width of the bins of the histogram of the values
+
+  Time m_windowEnd;          //!< end of the current window
+  EventId m_outputEvent;     //!< event outputting the current window
+  uint32_t m_count;          //!< number of values in the current window
+  double m_sum;              //!< sum of the values of the current window
+  double m_min;              //!< minimum value of the current window
+  double m_max;              //!< maximum value of the current window
+  Histogram m_histogram;     //!< histogram of the values of the current window
 };
 
 } // namespace ns3
@@ -0,0 +1,136 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2021
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <cstdio>
+#include <sstream>
+#include <sqlite3.h>
+
+#include "ns3/test.h"
+#include "ns3/data-collector.h"
+#include "ns3/basic-data-calculators.h"
+#include "ns3/sqlite-data-output.h"
+
+using namespace ns3;
+
+/**
+ * \ingroup stats-test
+ * \ingroup tests
+ *
+ * \brief Test case checking the rows written by SqliteDataOutput
+ */
+class SqliteDataOutputTestCase : public TestCase
+{
+public:
+  SqliteDataOutputTestCase ();
+
+private:
+  virtual void DoRun (void);
+
+  /**
+   * Run a query returning a single value
+   * \param db the database
+   * \param query the query
+   * \return the text of the value returned
+   */
+  std::string Query (sqlite3 *db, std::string query);
+};
+
+SqliteDataOutputTestCase::SqliteDataOutputTestCase ()
+  : TestCase ("SqliteDataOutput writes the run, metadata and calculators")
+{
+}
+
+std::string
+SqliteDataOutputTestCase::Query (sqlite3 *db, std::string query)
+{
+  sqlite3_stmt *stmt;
+  std::string ret;
+  if (sqlite3_prepare_v2 (db, query.c_str (), -1, &stmt, nullptr) == SQLITE_OK)
+    {
+      if (sqlite3_step (stmt) == SQLITE_ROW)
+        {
+          ret = reinterpret_cast<const char *> (sqlite3_column_text (stmt, 0));
+        }
+      sqlite3_finalize (stmt);
+    }
+  return ret;
+}
+
+void
+SqliteDataOutputTestCase::DoRun (void)
+{
+  DataCollector dc;
+  dc.DescribeRun ("experiment", "strategy", "input", "run", "description");
+  const uint32_t nMetadata = 100;
+  const uint32_t nCalculators = 1000;
+  for (uint32_t i = 0; i < nMetadata; i++)
+    {
+      std::ostringstream key;
+      key << "key" << i;
+      dc.AddMetadata (key.str (), i);
+    }
+  for (uint32_t i = 0; i < nCalculators; i++)
+    {
+      std::ostringstream key;
+      key << "counter" << i;
+      Ptr<CounterCalculator<> > counter = CreateObject<CounterCalculator<> > ();
+      counter->SetKey (key.str ());
+      counter->SetContext ("context");
+      counter->Update (i);
+      dc.AddDataCalculator (counter);
+    }
+
+  std::string prefix = CreateTempDirFilename ("sqlite-data-output");
+  std::remove ((prefix + ".db").c_str ());
+  Ptr<SqliteDataOutput> output = CreateObject<SqliteDataOutput> ();
+  output->SetFilePrefix (prefix);
+  output->Output (dc);
+  output = 0;
+
+  sqlite3 *db;
+  NS_TEST_ASSERT_MSG_EQ (sqlite3_open ((prefix + ".db").c_str (), &db), SQLITE_OK, "Cannot open the database");
+  NS_TEST_EXPECT_MSG_EQ (Query (db, "SELECT experiment || ',' || strategy || ',' || input || ',' || description "
+                                "FROM Experiments WHERE run = 'run'"),
+                         "experiment,strategy,input,description", "Wrong run description");
+  NS_TEST_EXPECT_MSG_EQ (Query (db, "SELECT COUNT (*) FROM Metadata WHERE run = 'run'"), "100", "Wrong number of metadata");
+  NS_TEST_EXPECT_MSG_EQ (Query (db, "SELECT value FROM Metadata WHERE key = 'key42'"), "42", "Wrong metadata value");
+  NS_TEST_EXPECT_MSG_EQ (Query (db, "SELECT COUNT (*) FROM Singletons WHERE run = 'run'"), "1000", "Wrong number of singletons");
+  NS_TEST_EXPECT_MSG_EQ (Query (db, "SELECT value FROM Singletons WHERE name = 'context' AND variable = 'counter999'"),
+                         "999", "Wrong singleton value");
+  sqlite3_close (db);
+}
+
+/**
+ * \ingroup stats-test
+ * \ingroup tests
+ *
+ * \brief SqliteDataOutput TestSuite
+ */
+class SqliteDataOutputTestSuite : public TestSuite
+{
+public:
+  SqliteDataOutputTestSuite ();
+};
+
+SqliteDataOutputTestSuite::SqliteDataOutputTestSuite ()
+  : TestSuite ("sqlite-data-output", UNIT)
+{
+  AddTestCase (new SqliteDataOutputTestCase, TestCase::QUICK);
+}
+
+static SqliteDataOutputTestSuite g_sqliteDataOutputTestSuite; //!< Static variable for test initialization
@@ -0,0 +1,228 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2021
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <vector>
+#include <utility>
+
+#include "ns3/test.h"
+#include "ns3/simulator.h"
+#include "ns3/nstime.h"
+#include "ns3/enum.h"
+#include "ns3/double.h"
+#include "ns3/time-series-adaptor.h"
+
+using namespace ns3;
+
+/**
+ * \ingroup stats-test
+ * \ingroup tests
+ *
+ * \brief Test case checking the values output by a TimeSeriesAdaptor,
+ * with and without an aggregation window.
+ */
+class TimeSeriesAdaptorTestCase : public TestCase
+{
+public:
+  /**
+   * Constructor
+   * \param name the name of the test case
+   * \param window the AggregationWindow attribute
+   * \param statistic the Statistic attribute
+   */
+  TimeSeriesAdaptorTestCase (std::string name, Time window, TimeSeriesAdaptor::Statistic statistic);
+
+  /**
+   * Add a value to feed to the adaptor
+   * \param time the time of the value, in seconds
+   * \param value the value
+   */
+  void AddValue (double time, double value);
+  /**
+   * Add a value expected to be output by the adaptor
+   * \param time the time of the value, in seconds
+   * \param value the value
+   */
+  void AddExpected (double time, double value);
+
+private:
+  virtual void DoRun (void);
+
+  /**
+   * Trace sink of the output of the adaptor
+   * \param time the time of the value, in seconds
+   * \param value the value
+   */
+  void Output (double time, double value);
+
+  Time m_window;                                        //!< the AggregationWindow attribute
+  TimeSeriesAdaptor::Statistic m_statistic;             //!< the Statistic attribute
+  std::vector<std::pair<double, double> > m_values;     //!< the values fed to the adaptor
+  std::vector<std::pair<double, double> > m_expected;   //!< the values expected to be output
+  std::vector<std::pair<double, double> > m_output;     //!< the values output
+};
+
+TimeSeriesAdaptorTestCase::TimeSeriesAdaptorTestCase (std::string name, Time window,
+                                                      TimeSeriesAdaptor::Statistic statistic)
+  : TestCase (name),
+    m_window (window),
+    m_statistic (statistic)
+{
+}
+
+void
+TimeSeriesAdaptorTestCase::AddValue (double time, double value)
+{
+  m_values.push_back (std::make_pair (time, value));
+}
+
+void
+TimeSeriesAdaptorTestCase::AddExpected (double time, double value)
+{
+  m_expected.push_back (std::make_pair (time, value));
+}
+
+void
+TimeSeriesAdaptorTestCase::Output (double time, double value)
+{
+  m_output.push_back (std::make_pair (time, value));
+}
+
+void
+TimeSeriesAdaptorTestCase::DoRun (void)
+{
+  Ptr<TimeSeriesAdaptor> adaptor = CreateObject<TimeSeriesAdaptor> ();
+  adaptor->SetAttribute ("AggregationWindow", TimeValue (m_window));
+  adaptor->SetAttribute ("Statistic", EnumValue (m_statistic));
+  NS_TEST_EXPECT_MSG_EQ (adaptor->SetAttributeFailSafe ("HistogramBinWidth", DoubleValue (0)), false,
+                         "A null bin width must be rejected");
+  adaptor->Enable ();
+  adaptor->TraceConnectWithoutContext ("Output", MakeCallback (&TimeSeriesAdaptorTestCase::Output, this));
+  for (std::size_t i = 0; i < m_values.size (); i++)
+    {
+      Simulator::Schedule (Seconds (m_values[i].first), &TimeSeriesAdaptor::TraceSinkDouble, adaptor,
+                           0, m_values[i].second);
+    }
+  Simulator::Stop (Seconds (10));
+  Simulator::Run ();
+  Simulator::Destroy ();
+
+  NS_TEST_ASSERT_MSG_EQ (m_output.size (), m_expected.size (), "Wrong number of values output");
+  for (std::size_t i = 0; i < m_output.size (); i++)
+    {
+      NS_TEST_EXPECT_MSG_EQ_TOL (m_output[i].first, m_expected[i].first, 1e-9, "Wrong time of value " << i);
+      NS_TEST_EXPECT_MSG_EQ_TOL (m_output[i].second, m_expected[i].second, 1e-9, "Wrong value " << i);
+    }
+}
+
+/**
+ * \ingroup stats-test
+ * \ingroup tests
+ *
+ * \brief TimeSeriesAdaptor TestSuite
+ */
+class TimeSeriesAdaptorTestSuite : public TestSuite
+{
+public:
+  TimeSeriesAdaptorTestSuite ();
+
+private:
+  /**
+   * Create a test case fed with the values of three windows of one
+   * second, the first window having values at its start and end, the
+   * second none, and the third a single value.
+   * \param name the name of the test case
+   * \param window the AggregationWindow attribute
+   * \param statistic the Statistic attribute
+   * \return the test case
+   */
+  TimeSeriesAdaptorTestCase * CreateTestCase (std::string name, Time window,
+                                              TimeSeriesAdaptor::Statistic statistic);
+};
+
+TimeSeriesAdaptorTestCase *
+TimeSeriesAdaptorTestSuite::CreateTestCase (std::string name, Time window,
+                                            TimeSeriesAdaptor::Statistic statistic)
+{
+  TimeSeriesAdaptorTestCase *testCase = new TimeSeriesAdaptorTestCase (name, window, statistic);
+  testCase->AddValue (0, 1);
+  testCase->AddValue (0.5, 3);
+  testCase->AddValue (0.75, 8);
+  testCase->AddValue (1, 4);
+  testCase->AddValue (3.25, 6);
+  return testCase;
+}
+
+TimeSeriesAdaptorTestSuite::TimeSeriesAdaptorTestSuite ()
+  : TestSuite ("time-series-adaptor", UNIT)
+{
+  TimeSeriesAdaptorTestCase *testCase;
+
+  testCase = CreateTestCase ("Every value output", Seconds (0), TimeSeriesAdaptor::MEAN);
+  testCase->AddExpected (0, 1);
+  testCase->AddExpected (0.5, 3);
+  testCase->AddExpected (0.75, 8);
+  testCase->AddExpected (1, 4);
+  testCase->AddExpected (3.25, 6);
+  AddTestCase (testCase, TestCase::QUICK);
+
+  testCase = CreateTestCase ("Mean per window", Seconds (1), TimeSeriesAdaptor::MEAN);
+  testCase->AddExpected (1, 4);
+  testCase->AddExpected (2, 4);
+  testCase->AddExpected (4, 6);
+  AddTestCase (testCase, TestCase::QUICK);
+
+  testCase = CreateTestCase ("Minimum per window", Seconds (1), TimeSeriesAdaptor::MIN);
+  testCase->AddExpected (1, 1);
+  testCase->AddExpected (2, 4);
+  testCase->AddExpected (4, 6);
+  AddTestCase (testCase, TestCase::QUICK);
+
+  testCase = CreateTestCase ("Maximum per window", Seconds (1), TimeSeriesAdaptor::MAX);
+  testCase->AddExpected (1, 8);
+  testCase->AddExpected (2, 4);
+  testCase->AddExpected (4, 6);
+  AddTestCase (testCase, TestCase::QUICK);
+
+  testCase = CreateTestCase ("Sum per window", Seconds (1), TimeSeriesAdaptor::SUM);
+  testCase->AddExpected (1, 12);
+  testCase->AddExpected (2, 4);
+  testCase->AddExpected (4, 6);
+  AddTestCase (testCase, TestCase::QUICK);
+
+  testCase = CreateTestCase ("Count per window", Seconds (1), TimeSeriesAdaptor::COUNT);
+  testCase->AddExpected (1, 3);
+  testCase->AddExpected (2, 1);
+  testCase->AddExpected (4, 1);
+  AddTestCase (testCase, TestCase::QUICK);
+
+  testCase = CreateTestCase ("Count per window of two seconds", Seconds (2), TimeSeriesAdaptor::COUNT);
+  testCase->AddExpected (2, 4);
+  testCase->AddExpected (4, 1);
+  AddTestCase (testCase, TestCase::QUICK);
+
+  // the median of 0, 1, ..., 99, estimated with bins of width 1
+  testCase = new TimeSeriesAdaptorTestCase ("Median per window", Seconds (1), TimeSeriesAdaptor::QUANTILE);
+  for (uint32_t i = 0; i < 100; i++)
+    {
+      testCase->AddValue (0.005 * i, 99 - i);
+    }
+  testCase->AddExpected (1, 50);
+  AddTestCase (testCase, TestCase::QUICK);
+}
+
+static TimeSeriesAdaptorTestSuite g_timeSeriesAdaptorTestSuite; //!< Static variable for test initialization
@@ -184,6 +184,14 @@ FqCoDelQueueDisc::~FqCoDelQueueDisc ()
   NS_LOG_FUNCTION (this);
 }
 
+void
+FqCoDelQueueDisc::DoDispose (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_flowTable.Clear ();
+  QueueDisc::DoDispose ();
+}
+
 void
 FqCoDelQueueDisc::SetQuantum (uint32_t quantum)
 {
@@ -197,35 +205,6 @@ FqCoDelQueueDisc::GetQuantum (void) const
   return m_quantum;
 }
 
-uint32_t
-FqCoDelQueueDisc::SetAssociativeHash (uint32_t flowHash)
-{
-  NS_LOG_FUNCTION (this << flowHash);
-
-  uint32_t h = (flowHash % m_flows);
-  uint32_t innerHash = h % m_setWays;
-  uint32_t outerHash = h - innerHash;
-
-  for (uint32_t i = outerHash; i < outerHash + m_setWays; i++)
-    {
-      auto it = m_flowsIndices.find (i);
-
-      if (it == m_flowsIndices.end ()
-          || (m_tags.find (i) != m_tags.end () && m_tags[i] == flowHash)
-          || StaticCast<FqCoDelFlow> (GetQueueDiscClass (it->second))->GetStatus () == FqCoDelFlow::INACTIVE)
-        {
-          // this queue has not been created yet or is associated with this flow
-          // or is inactive, hence we can use it
-          m_tags[i] = flowHash;
-          return i;
-        }
-    }
-
-  // all the queues of the set are used. Use the first queue of the set
-  m_tags[outerHash] = flowHash;
-  return outerHash;
-}
-
 bool
 FqCoDelQueueDisc::DoEnqueue (Ptr<QueueDiscItem> item)
 {
@@ -255,15 +234,15 @@ FqCoDelQueueDisc::DoEnqueue (Ptr<QueueDiscItem> item)
 
   if (m_enableSetAssociativeHash)
     {
-      h = SetAssociativeHash (flowHash);
+      h = m_flowTable.SetAssociativeHash (flowHash, m_setWays);
     }
   else
     {
       h = flowHash % m_flows;
     }
 
-  Ptr<FqCoDelFlow> flow;
-  if (m_flowsIndices.find (h) == m_flowsIndices.end ())
+  Ptr<FqCoDelFlow> flow = StaticCast<FqCoDelFlow> (m_flowTable.GetFlow (h));
+  if (!flow)
     {
       NS_LOG_DEBUG ("Creating a new flow queue with index " << h);
       flow = m_flowFactory.Create<FqCoDelFlow> ();
@@ -280,24 +259,19 @@ FqCoDelQueueDisc::DoEnqueue (Ptr<QueueDiscItem> item)
       flow->SetQueueDisc (qd);
       flow->SetIndex (h);
       AddQueueDiscClass (flow);
-
-      m_flowsIndices[h] = GetNQueueDiscClasses () - 1;
-    }
-  else
-    {
-      flow = StaticCast<FqCoDelFlow> (GetQueueDiscClass (m_flowsIndices[h]));
+      m_flowTable.SetFlow (h, flow);
     }
 
   if (flow->GetStatus () == FqCoDelFlow::INACTIVE)
     {
       flow->SetStatus (FqCoDelFlow::NEW_FLOW);
       flow->SetDeficit (m_quantum);
-      m_newFlows.push_back (flow);
+      m_flowTable.PushBack (FqFlowTable::NEW_FLOWS, h);
     }
 
   flow->GetQueueDisc ()->Enqueue (item);
 
-  NS_LOG_DEBUG ("Packet enqueued into flow " << h << "; flow index " << m_flowsIndices[h]);
+  NS_LOG_DEBUG ("Packet enqueued into flow " << h);
 
   if (GetCurrentSize () > GetMaxSize ())
     {
@@ -320,17 +294,17 @@ FqCoDelQueueDisc::DoDequeue (void)
     {
       bool found = false;
 
-      while (!found && !m_newFlows.empty ())
+      while (!found && !m_flowTable.IsEmpty (FqFlowTable::NEW_FLOWS))
         {
-          flow = m_newFlows.front ();
+          flow = StaticCast<FqCoDelFlow> (m_flowTable.GetFlow (m_flowTable.GetFront (FqFlowTable::NEW_FLOWS)));
 
           if (flow->GetDeficit () <= 0)
             {
               NS_LOG_DEBUG ("Increase deficit for new flow index " << flow->GetIndex ());
               flow->IncreaseDeficit (m_quantum);
               flow->SetStatus (FqCoDelFlow::OLD_FLOW);
-              m_oldFlows.push_back (flow);
-              m_newFlows.pop_front ();
+              m_flowTable.PopFront (FqFlowTable::NEW_FLOWS);
+              m_flowTable.PushBack (FqFlowTable::OLD_FLOWS, flow->GetIndex ());
             }
           else
             {
@@ -339,16 +313,16 @@ FqCoDelQueueDisc::DoDequeue (void)
             }
         }
 
-      while (!found && !m_oldFlows.empty ())
+      while (!found && !m_flowTable.IsEmpty (FqFlowTable::OLD_FLOWS))
         {
-          flow = m_oldFlows.front ();
+          flow = StaticCast<FqCoDelFlow> (m_flowTable.GetFlow (m_flowTable.GetFront (FqFlowTable::OLD_FLOWS)));
 
           if (flow->GetDeficit () <= 0)
             {
               NS_LOG_DEBUG ("Increase deficit for old flow index " << flow->GetIndex ());
               flow->IncreaseDeficit (m_quantum);
-              m_oldFlows.push_back (flow);
-              m_oldFlows.pop_front ();
+              m_flowTable.PopFront (FqFlowTable::OLD_FLOWS);
+              m_flowTable.PushBack (FqFlowTable::OLD_FLOWS, flow->GetIndex ());
             }
           else
             {
@@ -368,16 +342,16 @@ FqCoDelQueueDisc::DoDequeue (void)
       if (!item)
         {
           NS_LOG_DEBUG ("Could not get a packet from the selected flow queue");
-          if (!m_newFlows.empty ())
+          if (!m_flowTable.IsEmpty (FqFlowTable::NEW_FLOWS))
             {
               flow->SetStatus (FqCoDelFlow::OLD_FLOW);
-              m_oldFlows.push_back (flow);
-              m_newFlows.pop_front ();
+              m_flowTable.PopFront (FqFlowTable::NEW_FLOWS);
+              m_flowTable.PushBack (FqFlowTable::OLD_FLOWS, flow->GetIndex ());
             }
           else
             {
               flow->SetStatus (FqCoDelFlow::INACTIVE);
-              m_oldFlows.pop_front ();
+              m_flowTable.PopFront (FqFlowTable::OLD_FLOWS);
             }
         }
       else
@@ -451,6 +425,8 @@ FqCoDelQueueDisc::InitializeParams (void)
 {
   NS_LOG_FUNCTION (this);
 
+  m_flowTable.Reset (m_flows);
+
   m_flowFactory.SetTypeId ("ns3::FqCoDelFlow");
 
   m_queueDiscFactory.SetTypeId ("ns3::CoDelQueueDisc");
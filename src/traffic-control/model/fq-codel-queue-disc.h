@@ -24,8 +24,7 @@
 
 #include "ns3/queue-disc.h"
 #include "ns3/object-factory.h"
-#include <list>
-#include <map>
+#include "ns3/fq-flow-table.h"
 
 namespace ns3 {
 
@@ -141,6 +140,12 @@ public:
   static constexpr const char* UNCLASSIFIED_DROP = "Unclassified drop";  //!< No packet filter able to classify packet
   static constexpr const char* OVERLIMIT_DROP = "Overlimit drop";        //!< Overlimit dropped packets
 
+protected:
+  /**
+   * \brief Dispose of the object
+   */
+  virtual void DoDispose (void);
+
 private:
   virtual bool DoEnqueue (Ptr<QueueDiscItem> item);
   virtual Ptr<QueueDiscItem> DoDequeue (void);
@@ -154,15 +159,6 @@ private:
   uint32_t FqCoDelDrop (void);
 
   bool m_useEcn;             //!< True if ECN is used (packets are marked instead of being dropped)
-  /**
-   * Compute the index of the queue for the flow having the given flowHash,
-   * according to the set associative hash approach.
-   *
-   * \param flowHash the hash of the flow 5-tuple
-   * \return the index of the queue for the given flow
-   */
-  uint32_t SetAssociativeHash (uint32_t flowHash);
-
   std::string m_interval;    //!< CoDel interval attribute
   std::string m_target;      //!< CoDel target attribute
   uint32_t m_quantum;        //!< Deficit assigned to flows at each round
@@ -174,11 +170,7 @@ private:
   bool m_enableSetAssociativeHash; //!< whether to enable set associative hash
   bool m_useL4s;             //!< True if L4S is used (ECT1 packets are marked at CE threshold)
 
-  std::list<Ptr<FqCoDelFlow> > m_newFlows;    //!< The list of new flows
-  std::list<Ptr<FqCoDelFlow> > m_oldFlows;    //!< The list of old flows
-
-  std::map<uint32_t, uint32_t> m_flowsIndices;    //!< Map with the index of class for each flow
-  std::map<uint32_t, uint32_t> m_tags;            //!< Tags used by set associative hash
+  FqFlowTable m_flowTable;   //!< The flow queues and the lists of new and old flows
 
   ObjectFactory m_flowFactory;         //!< Factory to create a new flow
   ObjectFactory m_queueDiscFactory;    //!< Factory to create a new queue
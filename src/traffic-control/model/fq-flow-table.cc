@@ -0,0 +1,157 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2021
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/log.h"
+#include "fq-flow-table.h"
+#include "queue-disc.h"
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("FqFlowTable");
+
+/// Index marking the end of a list
+static const uint32_t NO_FLOW = 0xffffffff;
+
+FqFlowTable::Slot::Slot ()
+  : tag (0),
+    tagged (false),
+    active (false),
+    next (NO_FLOW)
+{
+}
+
+FqFlowTable::FqFlowTable ()
+{
+  m_head[NEW_FLOWS] = m_head[OLD_FLOWS] = NO_FLOW;
+  m_tail[NEW_FLOWS] = m_tail[OLD_FLOWS] = NO_FLOW;
+}
+
+void
+FqFlowTable::Reset (uint32_t nFlows)
+{
+  NS_LOG_FUNCTION (this << nFlows);
+  m_slots.assign (nFlows, Slot ());
+  m_head[NEW_FLOWS] = m_head[OLD_FLOWS] = NO_FLOW;
+  m_tail[NEW_FLOWS] = m_tail[OLD_FLOWS] = NO_FLOW;
+}
+
+void
+FqFlowTable::Clear (void)
+{
+  NS_LOG_FUNCTION (this);
+  Reset (0);
+  m_slots.shrink_to_fit ();
+}
+
+uint32_t
+FqFlowTable::SetAssociativeHash (uint32_t flowHash, uint32_t setWays)
+{
+  NS_LOG_FUNCTION (this << flowHash << setWays);
+
+  uint32_t h = (flowHash % m_slots.size ());
+  uint32_t innerHash = h % setWays;
+  uint32_t outerHash = h - innerHash;
+
+  for (uint32_t i = outerHash; i < outerHash + setWays; i++)
+    {
+      Slot& slot = m_slots[i];
+      // a flow queue that has not been created yet is inactive
+      if ((slot.tagged && slot.tag == flowHash) || !slot.active)
+        {
+          // this queue is associated with this flow or is inactive,
+          // hence we can use it
+          slot.tag = flowHash;
+          slot.tagged = true;
+          return i;
+        }
+    }
+
+  // all the queues of the set are used. Use the first queue of the set
+  m_slots[outerHash].tag = flowHash;
+  m_slots[outerHash].tagged = true;
+  return outerHash;
+}
+
+Ptr<QueueDiscClass>
+FqFlowTable::GetFlow (uint32_t index) const
+{
+  NS_ASSERT (index < m_slots.size ());
+  return m_slots[index].flow;
+}
+
+void
+FqFlowTable::SetFlow (uint32_t index, Ptr<QueueDiscClass> flow)
+{
+  NS_LOG_FUNCTION (this << index << flow);
+  NS_ASSERT (index < m_slots.size ());
+  m_slots[index].flow = flow;
+}
+
+bool
+FqFlowTable::IsActive (uint32_t index) const
+{
+  NS_ASSERT (index < m_slots.size ());
+  return m_slots[index].active;
+}
+
+bool
+FqFlowTable::IsEmpty (FlowList list) const
+{
+  return m_head[list] == NO_FLOW;
+}
+
+uint32_t
+FqFlowTable::GetFront (FlowList list) const
+{
+  NS_ASSERT (!IsEmpty (list));
+  return m_head[list];
+}
+
+void
+FqFlowTable::PopFront (FlowList list)
+{
+  NS_ASSERT (!IsEmpty (list));
+  Slot& slot = m_slots[m_head[list]];
+  m_head[list] = slot.next;
+  if (m_head[list] == NO_FLOW)
+    {
+      m_tail[list] = NO_FLOW;
+    }
+  slot.next = NO_FLOW;
+  slot.active = false;
+}
+
+void
+FqFlowTable::PushBack (FlowList list, uint32_t index)
+{
+  NS_ASSERT (index < m_slots.size ());
+  NS_ASSERT (!m_slots[index].active);
+  m_slots[index].active = true;
+  m_slots[index].next = NO_FLOW;
+  if (m_tail[list] == NO_FLOW)
+    {
+      m_head[list] = index;
+    }
+  else
+    {
+      m_slots[m_tail[list]].next = index;
+    }
+  m_tail[list] = index;
+}
+
+} // namespace ns3
@@ -240,6 +240,14 @@ FqPieQueueDisc::~FqPieQueueDisc ()
   NS_LOG_FUNCTION (this);
 }
 
+void
+FqPieQueueDisc::DoDispose (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_flowTable.Clear ();
+  QueueDisc::DoDispose ();
+}
+
 void
 FqPieQueueDisc::SetQuantum (uint32_t quantum)
 {
@@ -253,35 +261,6 @@ FqPieQueueDisc::GetQuantum (void) const
   return m_quantum;
 }
 
-uint32_t
-FqPieQueueDisc::SetAssociativeHash (uint32_t flowHash)
-{
-  NS_LOG_FUNCTION (this << flowHash);
-
-  uint32_t h = (flowHash % m_flows);
-  uint32_t innerHash = h % m_setWays;
-  uint32_t outerHash = h - innerHash;
-
-  for (uint32_t i = outerHash; i < outerHash + m_setWays; i++)
-    {
-      auto it = m_flowsIndices.find (i);
-
-      if (it == m_flowsIndices.end ()
-          || (m_tags.find (i) != m_tags.end () && m_tags[i] == flowHash)
-          || StaticCast<FqPieFlow> (GetQueueDiscClass (it->second))->GetStatus () == FqPieFlow::INACTIVE)
-        {
-          // this queue has not been created yet or is associated with this flow
-          // or is inactive, hence we can use it
-          m_tags[i] = flowHash;
-          return i;
-        }
-    }
-
-  // all the queues of the set are used. Use the first queue of the set
-  m_tags[outerHash] = flowHash;
-  return outerHash;
-}
-
 bool
 FqPieQueueDisc::DoEnqueue (Ptr<QueueDiscItem> item)
 {
@@ -311,15 +290,15 @@ FqPieQueueDisc::DoEnqueue (Ptr<QueueDiscItem> item)
 
   if (m_enableSetAssociativeHash)
     {
-      h = SetAssociativeHash (flowHash);
+      h = m_flowTable.SetAssociativeHash (flowHash, m_setWays);
     }
   else
     {
       h = flowHash % m_flows;
     }
 
-  Ptr<FqPieFlow> flow;
-  if (m_flowsIndices.find (h) == m_flowsIndices.end ())
+  Ptr<FqPieFlow> flow = StaticCast<FqPieFlow> (m_flowTable.GetFlow (h));
+  if (!flow)
     {
       NS_LOG_DEBUG ("Creating a new flow queue with index " << h);
       flow = m_flowFactory.Create<FqPieFlow> ();
@@ -336,24 +315,19 @@ FqPieQueueDisc::DoEnqueue (Ptr<QueueDiscItem> item)
       flow->SetQueueDisc (qd);
       flow->SetIndex (h);
       AddQueueDiscClass (flow);
-
-      m_flowsIndices[h] = GetNQueueDiscClasses () - 1;
-    }
-  else
-    {
-      flow = StaticCast<FqPieFlow> (GetQueueDiscClass (m_flowsIndices[h]));
+      m_flowTable.SetFlow (h, flow);
     }
 
   if (flow->GetStatus () == FqPieFlow::INACTIVE)
     {
       flow->SetStatus (FqPieFlow::NEW_FLOW);
       flow->SetDeficit (m_quantum);
-      m_newFlows.push_back (flow);
+      m_flowTable.PushBack (FqFlowTable::NEW_FLOWS, h);
     }
 
   flow->GetQueueDisc ()->Enqueue (item);
 
-  NS_LOG_DEBUG ("Packet enqueued into flow " << h << "; flow index " << m_flowsIndices[h]);
+  NS_LOG_DEBUG ("Packet enqueued into flow " << h);
 
   if (GetCurrentSize () > GetMaxSize ())
     {
@@ -376,17 +350,17 @@ FqPieQueueDisc::DoDequeue (void)
     {
       bool found = false;
 
-      while (!found && !m_newFlows.empty ())
+      while (!found && !m_flowTable.IsEmpty (FqFlowTable::NEW_FLOWS))
         {
-          flow = m_newFlows.front ();
+          flow = StaticCast<FqPieFlow> (m_flowTable.GetFlow (m_flowTable.GetFront (FqFlowTable::NEW_FLOWS)));
 
           if (flow->GetDeficit () <= 0)
             {
               NS_LOG_DEBUG ("Increase deficit for new flow index " << flow->GetIndex ());
               flow->IncreaseDeficit (m_quantum);
               flow->SetStatus (FqPieFlow::OLD_FLOW);
-              m_oldFlows.push_back (flow);
-              m_newFlows.pop_front ();
+              m_flowTable.PopFront (FqFlowTable::NEW_FLOWS);
+              m_flowTable.PushBack (FqFlowTable::OLD_FLOWS, flow->GetIndex ());
             }
           else
             {
@@ -395,16 +369,16 @@ FqPieQueueDisc::DoDequeue (void)
             }
         }
 
-      while (!found && !m_oldFlows.empty ())
+      while (!found && !m_flowTable.IsEmpty (FqFlowTable::OLD_FLOWS))
         {
-          flow = m_oldFlows.front ();
+          flow = StaticCast<FqPieFlow> (m_flowTable.GetFlow (m_flowTable.GetFront (FqFlowTable::OLD_FLOWS)));
 
           if (flow->GetDeficit () <= 0)
             {
               NS_LOG_DEBUG ("Increase deficit for old flow index " << flow->GetIndex ());
               flow->IncreaseDeficit (m_quantum);
-              m_oldFlows.push_back (flow);
-              m_oldFlows.pop_front ();
+              m_flowTable.PopFront (FqFlowTable::OLD_FLOWS);
+              m_flowTable.PushBack (FqFlowTable::OLD_FLOWS, flow->GetIndex ());
             }
           else
             {
@@ -424,16 +398,16 @@ FqPieQueueDisc::DoDequeue (void)
       if (!item)
         {
           NS_LOG_DEBUG ("Could not get a packet from the selected flow queue");
-          if (!m_newFlows.empty ())
+          if (!m_flowTable.IsEmpty (FqFlowTable::NEW_FLOWS))
             {
               flow->SetStatus (FqPieFlow::OLD_FLOW);
-              m_oldFlows.push_back (flow);
-              m_newFlows.pop_front ();
+              m_flowTable.PopFront (FqFlowTable::NEW_FLOWS);
+              m_flowTable.PushBack (FqFlowTable::OLD_FLOWS, flow->GetIndex ());
             }
           else
             {
               flow->SetStatus (FqPieFlow::INACTIVE);
-              m_oldFlows.pop_front ();
+              m_flowTable.PopFront (FqFlowTable::OLD_FLOWS);
             }
         }
       else
@@ -508,6 +482,8 @@ FqPieQueueDisc::InitializeParams (void)
 {
   NS_LOG_FUNCTION (this);
 
+  m_flowTable.Reset (m_flows);
+
   m_flowFactory.SetTypeId ("ns3::FqPieFlow");
 
   m_queueDiscFactory.SetTypeId ("ns3::PieQueueDisc");
@@ -29,8 +29,7 @@
 
 #include "ns3/queue-disc.h"
 #include "ns3/object-factory.h"
-#include <list>
-#include <map>
+#include "ns3/fq-flow-table.h"
 
 namespace ns3 {
 
@@ -148,6 +147,12 @@ public:
   static constexpr const char* UNCLASSIFIED_DROP = "Unclassified drop";  //!< No packet filter able to classify packet
   static constexpr const char* OVERLIMIT_DROP = "Overlimit drop";        //!< Overlimit dropped packets
 
+protected:
+  /**
+   * \brief Dispose of the object
+   */
+  virtual void DoDispose (void);
+
 private:
   virtual bool DoEnqueue (Ptr<QueueDiscItem> item);
   virtual Ptr<QueueDiscItem> DoDequeue (void);
@@ -160,15 +165,6 @@ private:
    */
   uint32_t FqPieDrop (void);
 
-  /**
-   * Compute the index of the queue for the flow having the given flowHash,
-   * according to the set associative hash approach.
-   *
-   * \param flowHash the hash of the flow 5-tuple
-   * \return the index of the queue for the given flow
-   */
-  uint32_t SetAssociativeHash (uint32_t flowHash);
-
   // PIE queue disc parameter
   bool m_useEcn;             //!< True if ECN is used (packets are marked instead of being dropped)
   double m_markEcnTh;        //!< ECN marking threshold (default 10% as suggested in RFC 8033)
@@ -194,11 +190,7 @@ private:
   uint32_t m_perturbation;   //!< hash perturbation value
   bool m_enableSetAssociativeHash; //!< whether to enable set associative hash
 
-  std::list<Ptr<FqPieFlow> > m_newFlows;    //!< The list of new flows
-  std::list<Ptr<FqPieFlow> > m_oldFlows;    //!< The list of old flows
-
-  std::map<uint32_t, uint32_t> m_flowsIndices;    //!< Map with the index of class for each flow
-  std::map<uint32_t, uint32_t> m_tags;            //!< Tags used by set associative hash
+  FqFlowTable m_flowTable;   //!< The flow queues and the lists of new and old flows
 
   ObjectFactory m_flowFactory;         //!< Factory to create a new flow
   ObjectFactory m_queueDiscFactory;    //!< Factory to create a new queue
@@ -29,6 +29,7 @@
 #include "queue-disc.h"
 #include "ns3/net-device-queue-interface.h"
 #include "ns3/queue.h"
+#include <cstring>
 
 namespace ns3 {
 
@@ -352,18 +353,16 @@ QueueDisc::QueueDisc (QueueDiscSizePolicy policy)
   // the packet is dropped.
   m_childQueueDiscDbeFunctor = [this] (Ptr<const QueueDiscItem> item, const char* r)
     {
-      return DropBeforeEnqueue (item,
-                                m_childQueueDiscDropMsg.assign (CHILD_QUEUE_DISC_DROP).append (r).data ());
+      return DropBeforeEnqueue (item, GetChildQueueDiscReason (CHILD_QUEUE_DISC_DROP, r));
     };
   m_childQueueDiscDadFunctor = [this] (Ptr<const QueueDiscItem> item, const char* r)
     {
-      return DropAfterDequeue (item,
-                               m_childQueueDiscDropMsg.assign (CHILD_QUEUE_DISC_DROP).append (r).data ());
+      return DropAfterDequeue (item, GetChildQueueDiscReason (CHILD_QUEUE_DISC_DROP, r));
     };
   m_childQueueDiscMarkFunctor = [this] (Ptr<const QueueDiscItem> item, const char* r)
     {
       return Mark (const_cast<QueueDiscItem *> (PeekPointer (item)),
-                   m_childQueueDiscMarkMsg.assign (CHILD_QUEUE_DISC_MARK).append (r).data ());
+                   GetChildQueueDiscReason (CHILD_QUEUE_DISC_MARK, r));
     };
 }
 
@@ -433,6 +432,34 @@ QueueDisc::GetStats (void)
   m_stats.nTotalSentBytes = m_stats.nTotalDequeuedBytes - (m_requeued ? m_requeued->GetSize () : 0)
                             - m_stats.nTotalDroppedBytesAfterDequeue;
 
+  // the counters for each reason are only copied here to avoid a lookup by
+  // reason string for every packet dropped or marked
+  m_stats.nDroppedPacketsBeforeEnqueue.clear ();
+  m_stats.nDroppedBytesBeforeEnqueue.clear ();
+  m_stats.nDroppedPacketsAfterDequeue.clear ();
+  m_stats.nDroppedBytesAfterDequeue.clear ();
+  m_stats.nMarkedPackets.clear ();
+  m_stats.nMarkedBytes.clear ();
+
+  for (const auto& counters : m_reasons)
+    {
+      if (counters.nDroppedPacketsBeforeEnqueue > 0)
+        {
+          m_stats.nDroppedPacketsBeforeEnqueue[counters.name] = counters.nDroppedPacketsBeforeEnqueue;
+          m_stats.nDroppedBytesBeforeEnqueue[counters.name] = counters.nDroppedBytesBeforeEnqueue;
+        }
+      if (counters.nDroppedPacketsAfterDequeue > 0)
+        {
+          m_stats.nDroppedPacketsAfterDequeue[counters.name] = counters.nDroppedPacketsAfterDequeue;
+          m_stats.nDroppedBytesAfterDequeue[counters.name] = counters.nDroppedBytesAfterDequeue;
+        }
+      if (counters.nMarkedPackets > 0)
+        {
+          m_stats.nMarkedPackets[counters.name] = counters.nMarkedPackets;
+          m_stats.nMarkedBytes[counters.name] = counters.nMarkedBytes;
+        }
+    }
+
   return m_stats;
 }
 
@@ -725,6 +752,79 @@ QueueDisc::PacketDequeued (Ptr<const QueueDiscItem> item)
     }
 }
 
+QueueDisc::ReasonCounters::ReasonCounters (const char* name)
+  : name (name),
+    nDroppedPacketsBeforeEnqueue (0),
+    nDroppedBytesBeforeEnqueue (0),
+    nDroppedPacketsAfterDequeue (0),
+    nDroppedBytesAfterDequeue (0),
+    nMarkedPackets (0),
+    nMarkedBytes (0)
+{
+}
+
+QueueDisc::ReasonCounters&
+QueueDisc::GetReasonCounters (const char* reason)
+{
+  // a queue disc uses a handful of reasons, hence a linear search by address
+  // is faster than any lookup by string. The address of a reason may however
+  // be reused for a different reason (e.g., a buffer that is overwritten), hence
+  // a match is only accepted if the reason string is also the same
+  for (auto& entry : m_reasonCounters)
+    {
+      if (entry.first == reason)
+        {
+          if (entry.second->name != reason)
+            {
+              NS_LOG_DEBUG ("Address of reason " << entry.second->name << " reused for " << reason);
+              entry.second = &FindReasonCounters (reason);
+            }
+          return *entry.second;
+        }
+    }
+
+  // first time this address is seen. The same reason may have already been
+  // seen at a different address (e.g., the same literal in another module)
+  ReasonCounters* counters = &FindReasonCounters (reason);
+  m_reasonCounters.push_back (std::make_pair (reason, counters));
+  return *counters;
+}
+
+QueueDisc::ReasonCounters&
+QueueDisc::FindReasonCounters (const char* reason)
+{
+  for (auto& counters : m_reasons)
+    {
+      if (counters.name == reason)
+        {
+          return counters;
+        }
+    }
+  NS_LOG_DEBUG ("New reason: " << reason);
+  m_reasons.emplace_back (reason);
+  return m_reasons.back ();
+}
+
+const char*
+QueueDisc::GetChildQueueDiscReason (const char* prefix, const char* reason)
+{
+  auto it = m_childQueueDiscReasons.find (std::make_pair (prefix, reason));
+  // as in GetReasonCounters, the address of the child reason is only a hint:
+  // the recorded reason must also end with the reason provided by the child
+  if (it != m_childQueueDiscReasons.end ()
+      && std::strcmp (it->second->name.c_str () + std::strlen (prefix), reason) == 0)
+    {
+      return it->second->name.c_str ();
+    }
+
+  // the name of the counters is never modified and, being stored in a deque,
+  // never moves, hence it can be used as the reason
+  std::string name = std::string (prefix).append (reason);
+  ReasonCounters* counters = &FindReasonCounters (name.c_str ());
+  m_childQueueDiscReasons[std::make_pair (prefix, reason)] = counters;
+  return counters->name.c_str ();
+}
+
 void
 QueueDisc::DropBeforeEnqueue (Ptr<const QueueDiscItem> item, const char* reason)
 {
@@ -735,26 +835,10 @@ QueueDisc::DropBeforeEnqueue (Ptr<const QueueDiscItem> item, const char* reason)
   m_stats.nTotalDroppedPacketsBeforeEnqueue++;
   m_stats.nTotalDroppedBytesBeforeEnqueue += item->GetSize ();
 
-  // update the number of packets dropped for the given reason
-  std::map<std::string, uint32_t>::iterator itp = m_stats.nDroppedPacketsBeforeEnqueue.find (reason);
-  if (itp != m_stats.nDroppedPacketsBeforeEnqueue.end ())
-    {
-      itp->second++;
-    }
-  else
-    {
-      m_stats.nDroppedPacketsBeforeEnqueue[reason] = 1;
-    }
-  // update the amount of bytes dropped for the given reason
-  std::map<std::string, uint64_t>::iterator itb = m_stats.nDroppedBytesBeforeEnqueue.find (reason);
-  if (itb != m_stats.nDroppedBytesBeforeEnqueue.end ())
-    {
-      itb->second += item->GetSize ();
-    }
-  else
-    {
-      m_stats.nDroppedBytesBeforeEnqueue[reason] = item->GetSize ();
-    }
+  // update the number of packets and the amount of bytes dropped for the given reason
+  ReasonCounters& counters = GetReasonCounters (reason);
+  counters.nDroppedPacketsBeforeEnqueue++;
+  counters.nDroppedBytesBeforeEnqueue += item->GetSize ();
 
   NS_LOG_DEBUG ("Total packets/bytes dropped before enqueue: "
                 << m_stats.nTotalDroppedPacketsBeforeEnqueue << " / "
@@ -774,26 +858,10 @@ QueueDisc::DropAfterDequeue (Ptr<const QueueDiscItem> item, const char* reason)
   m_stats.nTotalDroppedPacketsAfterDequeue++;
   m_stats.nTotalDroppedBytesAfterDequeue += item->GetSize ();
 
-  // update the number of packets dropped for the given reason
-  std::map<std::string, uint32_t>::iterator itp = m_stats.nDroppedPacketsAfterDequeue.find (reason);
-  if (itp != m_stats.nDroppedPacketsAfterDequeue.end ())
-    {
-      itp->second++;
-    }
-  else
-    {
-      m_stats.nDroppedPacketsAfterDequeue[reason] = 1;
-    }
-  // update the amount of bytes dropped for the given reason
-  std::map<std::string, uint64_t>::iterator itb = m_stats.nDroppedBytesAfterDequeue.find (reason);
-  if (itb != m_stats.nDroppedBytesAfterDequeue.end ())
-    {
-      itb->second += item->GetSize ();
-    }
-  else
-    {
-      m_stats.nDroppedBytesAfterDequeue[reason] = item->GetSize ();
-    }
+  // update the number of packets and the amount of bytes dropped for the given reason
+  ReasonCounters& counters = GetReasonCounters (reason);
+  counters.nDroppedPacketsAfterDequeue++;
+  counters.nDroppedBytesAfterDequeue += item->GetSize ();
 
   // if in the context of a peek request a dequeued packet is dropped, we need
   // to update the statistics and fire the dequeue trace before firing the drop
@@ -829,26 +897,10 @@ QueueDisc::Mark (Ptr<QueueDiscItem> item, const char* reason)
   m_stats.nTotalMarkedPackets++;
   m_stats.nTotalMarkedBytes += item->GetSize ();
 
-  // update the number of packets marked for the given reason
-  std::map<std::string, uint32_t>::iterator itp = m_stats.nMarkedPackets.find (reason);
-  if (itp != m_stats.nMarkedPackets.end ())
-    {
-      itp->second++;
-    }
-  else
-    {
-      m_stats.nMarkedPackets[reason] = 1;
-    }
-  // update the amount of bytes marked for the given reason
-  std::map<std::string, uint64_t>::iterator itb = m_stats.nMarkedBytes.find (reason);
-  if (itb != m_stats.nMarkedBytes.end ())
-    {
-      itb->second += item->GetSize ();
-    }
-  else
-    {
-      m_stats.nMarkedBytes[reason] = item->GetSize ();
-    }
+  // update the number of packets and the amount of bytes marked for the given reason
+  ReasonCounters& counters = GetReasonCounters (reason);
+  counters.nMarkedPackets++;
+  counters.nMarkedBytes += item->GetSize ();
 
   NS_LOG_DEBUG ("Total packets/bytes marked: "
                 << m_stats.nTotalMarkedPackets << " / "
@@ -27,6 +27,7 @@
 #include "ns3/queue-size.h"
 #include <vector>
 #include <map>
+#include <deque>
 #include <functional>
 #include <string>
 #include "packet-filter.h"
@@ -167,6 +168,11 @@ enum QueueDiscSizePolicy
  * the reason is "Dropped by internal queue". When a packet is dropped by a child
  * queue disc, the reason is "(Dropped by child queue disc) " followed by the
  * reason why the child queue disc dropped the packet.
+ * The counters of each reason are looked up by the address of the reason
+ * string first, and the string is then compared to make sure that the address
+ * was not reused for a different reason. The maps keyed by reason strings in
+ * the Stats structure are only filled when the statistics are retrieved by
+ * GetStats().
  *
  * The QueueDisc base class provides the SojournTime trace source, which provides
  * the sojourn time of every packet dequeued from a queue disc, including packets
@@ -691,6 +697,53 @@ private:
    */
   void PacketDequeued (Ptr<const QueueDiscItem> item);
 
+  /// Counters kept for each reason why packets are dropped or marked
+  struct ReasonCounters
+  {
+    /**
+     * \param name the reason
+     */
+    ReasonCounters (const char* name);
+
+    std::string name;                       //!< The reason
+    uint32_t nDroppedPacketsBeforeEnqueue;  //!< Packets dropped before enqueue
+    uint64_t nDroppedBytesBeforeEnqueue;    //!< Bytes dropped before enqueue
+    uint32_t nDroppedPacketsAfterDequeue;   //!< Packets dropped after dequeue
+    uint64_t nDroppedBytesAfterDequeue;     //!< Bytes dropped after dequeue
+    uint32_t nMarkedPackets;                //!< Marked packets
+    uint64_t nMarkedBytes;                  //!< Marked bytes
+  };
+
+  /**
+   * Get the counters of the given reason, looking them up by the address of
+   * the reason string and checking that the string matches.
+   *
+   * \param reason the reason why a packet is dropped or marked
+   * \return the counters of the given reason
+   */
+  ReasonCounters& GetReasonCounters (const char* reason);
+
+  /**
+   * Get the counters of the reason having the given string, creating them if
+   * no such reason has been seen yet.
+   *
+   * \param reason the reason why a packet is dropped or marked
+   * \return the counters of the given reason
+   */
+  ReasonCounters& FindReasonCounters (const char* reason);
+
+  /**
+   * Get the reason recorded when a child queue disc drops or marks a packet,
+   * i.e., the concatenation of the given prefix and the reason provided by the
+   * child queue disc. The returned string is owned by this queue disc and is
+   * never modified.
+   *
+   * \param prefix CHILD_QUEUE_DISC_DROP or CHILD_QUEUE_DISC_MARK
+   * \param reason the reason provided by the child queue disc
+   * \return the reason to record
+   */
+  const char* GetChildQueueDiscReason (const char* prefix, const char* reason);
+
   static const uint32_t DEFAULT_QUOTA = 64; //!< Default quota (as in /proc/sys/net/core/dev_weight)
 
   std::vector<Ptr<InternalQueue> > m_queues;    //!< Internal queues
@@ -709,8 +762,12 @@ private:
   bool m_running;                   //!< The queue disc is performing multiple dequeue operations
   Ptr<QueueDiscItem> m_requeued;    //!< The last packet that failed to be transmitted
   bool m_peeked;                    //!< A packet was dequeued because Peek was called
-  std::string m_childQueueDiscDropMsg;  //!< Reason why a packet was dropped by a child queue disc
-  std::string m_childQueueDiscMarkMsg;  //!< Reason why a packet was marked by a child queue disc
+  /// The counters of each reason, in the order reasons were first seen
+  std::deque<ReasonCounters> m_reasons;
+  /// The counters of each reason, indexed by the address of a reason string
+  std::vector<std::pair<const char*, ReasonCounters*> > m_reasonCounters;
+  /// The counters of the reasons recorded for child queue discs, indexed by (prefix, child reason)
+  std::map<std::pair<const char*, const char*>, ReasonCounters*> m_childQueueDiscReasons;
   QueueDiscSizePolicy m_sizePolicy;     //!< The queue disc size policy
   bool m_prohibitChangeMode;            //!< True if changing mode is prohibited
 
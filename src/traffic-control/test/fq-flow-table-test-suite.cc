@@ -0,0 +1,173 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2021
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/test.h"
+#include "ns3/fq-flow-table.h"
+#include "ns3/queue-disc.h"
+#include <vector>
+
+using namespace ns3;
+
+/**
+ * \ingroup traffic-control-test
+ * \ingroup tests
+ *
+ * \brief FqFlowTable Test Case
+ *
+ * Check the insertion of flow queues in the lists of new and old flows,
+ * the move of a flow queue from the new list to the old list, the removal
+ * of flow queues from the lists, the reuse of the slots by the set
+ * associative hash and the release of the flow queues.
+ */
+class FqFlowTableTestCase : public TestCase
+{
+public:
+  FqFlowTableTestCase ();
+  virtual ~FqFlowTableTestCase ();
+
+private:
+  virtual void DoRun (void);
+  /**
+   * Check the content of a list of the table
+   *
+   * \param table the table
+   * \param list the list
+   * \param expected the expected indices of the flow queues in the list
+   */
+  void CheckList (FqFlowTable& table, FqFlowTable::FlowList list, std::vector<uint32_t> expected);
+};
+
+FqFlowTableTestCase::FqFlowTableTestCase ()
+  : TestCase ("Sanity check on the lists and the slots of the flow table")
+{
+}
+
+FqFlowTableTestCase::~FqFlowTableTestCase ()
+{
+}
+
+void
+FqFlowTableTestCase::CheckList (FqFlowTable& table, FqFlowTable::FlowList list, std::vector<uint32_t> expected)
+{
+  // empty the list, then restore it
+  std::vector<uint32_t> found;
+  while (!table.IsEmpty (list))
+    {
+      found.push_back (table.GetFront (list));
+      table.PopFront (list);
+      NS_TEST_EXPECT_MSG_EQ (table.IsActive (found.back ()), false, "A removed flow queue must be inactive");
+    }
+  for (auto index : found)
+    {
+      table.PushBack (list, index);
+    }
+
+  NS_TEST_ASSERT_MSG_EQ (found.size (), expected.size (), "Unexpected number of flow queues in the list");
+  for (std::size_t i = 0; i < expected.size (); i++)
+    {
+      NS_TEST_EXPECT_MSG_EQ (found[i], expected[i], "Unexpected flow queue at position " << i);
+      NS_TEST_EXPECT_MSG_EQ (table.IsActive (expected[i]), true, "A flow queue in a list must be active");
+    }
+}
+
+void
+FqFlowTableTestCase::DoRun (void)
+{
+  FqFlowTable table;
+  table.Reset (8);
+
+  // insert flow queues in the list of new flows
+  for (uint32_t index : {2, 5, 7})
+    {
+      NS_TEST_EXPECT_MSG_EQ ((table.GetFlow (index) == 0), true, "No flow queue created yet");
+      table.SetFlow (index, CreateObject<QueueDiscClass> ());
+      NS_TEST_EXPECT_MSG_EQ (table.IsActive (index), false, "A new flow queue is inactive");
+      table.PushBack (FqFlowTable::NEW_FLOWS, index);
+    }
+  CheckList (table, FqFlowTable::NEW_FLOWS, {2, 5, 7});
+  CheckList (table, FqFlowTable::OLD_FLOWS, {});
+
+  // move the head of the list of new flows to the list of old flows
+  uint32_t index = table.GetFront (FqFlowTable::NEW_FLOWS);
+  table.PopFront (FqFlowTable::NEW_FLOWS);
+  table.PushBack (FqFlowTable::OLD_FLOWS, index);
+  CheckList (table, FqFlowTable::NEW_FLOWS, {5, 7});
+  CheckList (table, FqFlowTable::OLD_FLOWS, {2});
+
+  // move an old flow to the tail of the list of old flows
+  table.PopFront (FqFlowTable::NEW_FLOWS);
+  table.PushBack (FqFlowTable::OLD_FLOWS, 5);
+  table.PopFront (FqFlowTable::OLD_FLOWS);
+  table.PushBack (FqFlowTable::OLD_FLOWS, 2);
+  CheckList (table, FqFlowTable::NEW_FLOWS, {7});
+  CheckList (table, FqFlowTable::OLD_FLOWS, {5, 2});
+
+  // remove the flows from the lists; the flow queues are kept
+  table.PopFront (FqFlowTable::NEW_FLOWS);
+  table.PopFront (FqFlowTable::OLD_FLOWS);
+  CheckList (table, FqFlowTable::NEW_FLOWS, {});
+  CheckList (table, FqFlowTable::OLD_FLOWS, {2});
+  NS_TEST_EXPECT_MSG_EQ ((table.GetFlow (5) != 0), true, "A removed flow queue must be kept");
+
+  // the flows of a set share the slots of the set (sets of 4 slots here):
+  // a flow gets the first inactive slot or the slot it is tagged with
+  NS_TEST_EXPECT_MSG_EQ (table.SetAssociativeHash (1, 4), 0, "The first inactive slot must be used");
+  table.PushBack (FqFlowTable::NEW_FLOWS, 0);
+  NS_TEST_EXPECT_MSG_EQ (table.SetAssociativeHash (9, 4), 1, "The first inactive slot must be used");
+  table.PushBack (FqFlowTable::NEW_FLOWS, 1);
+  NS_TEST_EXPECT_MSG_EQ (table.SetAssociativeHash (1, 4), 0, "A flow must keep its slot while active");
+  NS_TEST_EXPECT_MSG_EQ (table.SetAssociativeHash (17, 4), 3, "The active flow queue 2 must not be used");
+  // once the flow queue 2 is inactive, its slot is used
+  table.PopFront (FqFlowTable::OLD_FLOWS);
+  NS_TEST_EXPECT_MSG_EQ (table.SetAssociativeHash (17, 4), 2, "The slot of the inactive flow queue 2 must be reused");
+  table.PushBack (FqFlowTable::OLD_FLOWS, 2);
+  NS_TEST_EXPECT_MSG_EQ (table.SetAssociativeHash (25, 4), 3, "The first inactive slot must be used");
+  table.PushBack (FqFlowTable::OLD_FLOWS, 3);
+  // all the slots of the set are active, the first slot of the set is shared
+  NS_TEST_EXPECT_MSG_EQ (table.SetAssociativeHash (33, 4), 0, "The first slot of a full set must be used");
+  NS_TEST_EXPECT_MSG_EQ (table.SetAssociativeHash (1, 4), 0, "The first slot of a full set must be used");
+  // once inactive, a slot is reused by any flow of the set
+  table.PopFront (FqFlowTable::NEW_FLOWS);
+  NS_TEST_EXPECT_MSG_EQ (table.SetAssociativeHash (41, 4), 0, "The inactive slot must be reused");
+  CheckList (table, FqFlowTable::NEW_FLOWS, {1});
+  CheckList (table, FqFlowTable::OLD_FLOWS, {2, 3});
+
+  // the flow queues are released when the table is cleared
+  Ptr<QueueDiscClass> flow = table.GetFlow (7);
+  NS_TEST_EXPECT_MSG_EQ (flow->GetReferenceCount (), 2, "The table must hold a reference to the flow queue");
+  table.Clear ();
+  NS_TEST_EXPECT_MSG_EQ (flow->GetReferenceCount (), 1, "The table must release the flow queue");
+  CheckList (table, FqFlowTable::NEW_FLOWS, {});
+  CheckList (table, FqFlowTable::OLD_FLOWS, {});
+}
+
+/**
+ * \ingroup traffic-control-test
+ * \ingroup tests
+ *
+ * \brief FqFlowTable Test Suite
+ */
+static class FqFlowTableTestSuite : public TestSuite
+{
+public:
+  FqFlowTableTestSuite ()
+    : TestSuite ("fq-flow-table", UNIT)
+  {
+    AddTestCase (new FqFlowTableTestCase (), TestCase::QUICK);
+  }
+} g_fqFlowTableTestSuite; ///< the test suite
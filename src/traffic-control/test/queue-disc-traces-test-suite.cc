@@ -25,6 +25,7 @@
 #include "ns3/packet.h"
 #include "ns3/simulator.h"
 #include <map>
+#include <cstring>
 
 using namespace ns3;
 
@@ -92,6 +93,18 @@ public:
   // Reasons for dropping packets
   static constexpr const char* BEFORE_ENQUEUE = "Before enqueue";  //!< Drop before enqueue
   static constexpr const char* AFTER_DEQUEUE = "After dequeue";  //!< Drop after dequeue
+
+private:
+  /**
+   * Copy the given reason into a buffer shared by all the reasons, so that
+   * the queue discs see different reasons at the same address.
+   *
+   * \param reason the reason why a packet is dropped
+   * \return the buffer holding the reason
+   */
+  const char* GetReason (const char* reason);
+
+  char m_reason[32];   //!< Buffer holding the reason of the latest drop
 };
 
 TestChildQueueDisc::TestChildQueueDisc ()
@@ -109,7 +122,7 @@ TestChildQueueDisc::DoEnqueue (Ptr<QueueDiscItem> item)
   // Drop the packet if there are already 4 packets queued
   if (GetNPackets () >= 4)
     {
-      DropBeforeEnqueue (item, BEFORE_ENQUEUE);
+      DropBeforeEnqueue (item, GetReason (BEFORE_ENQUEUE));
       return false;
     }
   return GetInternalQueue (0)->Enqueue (item);
@@ -123,7 +136,7 @@ TestChildQueueDisc::DoDequeue (void)
   // Drop the packet if at least 2 packets remain in the queue
   while (GetNPackets () >= 2)
     {
-      DropAfterDequeue (item, AFTER_DEQUEUE);
+      DropAfterDequeue (item, GetReason (AFTER_DEQUEUE));
       item = GetInternalQueue (0)->Dequeue ();
     }
   return item;
@@ -141,6 +154,14 @@ TestChildQueueDisc::InitializeParams (void)
 {
 }
 
+const char*
+TestChildQueueDisc::GetReason (const char* reason)
+{
+  std::strncpy (m_reason, reason, sizeof (m_reason) - 1);
+  m_reason[sizeof (m_reason) - 1] = '\0';
+  return m_reason;
+}
+
 
 /**
  * \ingroup traffic-control-test
@@ -555,6 +576,30 @@ QueueDiscTracesTestCase::DoRun (void)
   CheckDroppedBeforeEnqueue (child, 1, pktSizeUnit * 5);
   CheckDroppedAfterDequeue (child, 2, pktSizeUnit * 3);
 
+  // Check the statistics kept for each reason. The reasons of the root queue
+  // disc are those of the child queue disc, prefixed by CHILD_QUEUE_DISC_DROP.
+  // The child queue disc passes all its reasons in the same buffer
+  QueueDisc::Stats childStats = child->GetStats ();
+  NS_TEST_EXPECT_MSG_EQ (childStats.GetNDroppedPackets (TestChildQueueDisc::BEFORE_ENQUEUE), 1,
+                         "Verify the number of packets dropped by the child before enqueue");
+  NS_TEST_EXPECT_MSG_EQ (childStats.GetNDroppedPackets (TestChildQueueDisc::AFTER_DEQUEUE), 2,
+                         "Verify the number of packets dropped by the child after dequeue");
+  NS_TEST_EXPECT_MSG_EQ (childStats.GetNDroppedBytes (TestChildQueueDisc::AFTER_DEQUEUE), pktSizeUnit * 3,
+                         "Verify the number of bytes dropped by the child after dequeue");
+  NS_TEST_EXPECT_MSG_EQ (childStats.nDroppedPacketsBeforeEnqueue.size (), 1,
+                         "Verify that only one reason to drop before enqueue is recorded");
+
+  QueueDisc::Stats rootStats = root->GetStats ();
+  std::string prefix (QueueDisc::CHILD_QUEUE_DISC_DROP);
+  NS_TEST_EXPECT_MSG_EQ (rootStats.GetNDroppedPackets (prefix + TestChildQueueDisc::BEFORE_ENQUEUE), 1,
+                         "Verify the number of packets dropped by the root before enqueue");
+  NS_TEST_EXPECT_MSG_EQ (rootStats.GetNDroppedBytes (prefix + TestChildQueueDisc::BEFORE_ENQUEUE), pktSizeUnit * 5,
+                         "Verify the number of bytes dropped by the root before enqueue");
+  NS_TEST_EXPECT_MSG_EQ (rootStats.GetNDroppedPackets (prefix + TestChildQueueDisc::AFTER_DEQUEUE), 2,
+                         "Verify the number of packets dropped by the root after dequeue");
+  NS_TEST_EXPECT_MSG_EQ (rootStats.GetNDroppedPackets (TestChildQueueDisc::AFTER_DEQUEUE), 0,
+                         "The reasons of the root must be prefixed");
+
   Simulator::Destroy ();
 }
 
@@ -136,8 +136,8 @@ BlockAckManager::CreateAgreement (const MgtAddBaRequestHeader *reqHdr, Mac48Addr
   uint8_t tid = reqHdr->GetTid ();
   m_agreementState (Simulator::Now (), recipient, tid, OriginatorBlockAckAgreement::PENDING);
   agreement.SetState (OriginatorBlockAckAgreement::PENDING);
-  PacketQueue queue;
-  std::pair<OriginatorBlockAckAgreement, PacketQueue> value (agreement, queue);
+  OutstandingMpduBuffer queue;
+  std::pair<OriginatorBlockAckAgreement, OutstandingMpduBuffer> value (agreement, queue);
   if (ExistsAgreement (recipient, tid))
     {
       // Delete agreement if it exists and in RESET state
@@ -197,6 +197,7 @@ BlockAckManager::UpdateAgreement (const MgtAddBaResponseHeader *respHdr, Mac48Ad
       agreement.SetAmsduSupport (respHdr->IsAmsduSupported ());
       agreement.SetStartingSequence (startingSeq);
       agreement.InitTxWindow ();
+      it->second.second.Reserve (agreement.GetBufferSize ());
       if (respHdr->IsImmediateBlockAck ())
         {
           agreement.SetImmediateBlockAck ();
@@ -248,28 +249,11 @@ BlockAckManager::StorePacket (Ptr<WifiMacQueueItem> mpdu)
       return;
     }
 
-  // store the packet and keep the list sorted in increasing order of sequence number
-  // with respect to the starting sequence number
-  PacketQueueI it = agreementIt->second.second.begin ();
-  while (it != agreementIt->second.second.end ())
+  if (!agreementIt->second.second.Insert (mpdu))
     {
-      if (mpdu->GetHeader ().GetSequenceControl () == (*it)->GetHeader ().GetSequenceControl ())
-        {
-          NS_LOG_DEBUG ("Packet already in the queue of the BA agreement");
-          return;
-        }
-
-      uint16_t dist = agreementIt->second.first.GetDistance ((*it)->GetHeader ().GetSequenceNumber ());
-
-      if (mpduDist < dist ||
-          (mpduDist == dist && mpdu->GetHeader ().GetFragmentNumber () < (*it)->GetHeader ().GetFragmentNumber ()))
-        {
-          break;
-        }
-
-      it++;
+      NS_LOG_DEBUG ("Packet already in the queue of the BA agreement");
+      return;
     }
-  agreementIt->second.second.insert (it, mpdu);
   agreementIt->second.first.NotifyTransmittedMpdu (mpdu);
 }
 
@@ -313,17 +297,13 @@ BlockAckManager::GetBar (bool remove, uint8_t tid, Mac48Address address)
               continue;
             }
           // remove expired outstanding MPDUs and update the starting sequence number
-          for (auto mpduIt = it->second.second.begin (); mpduIt != it->second.second.end (); )
+          for (auto& mpdu : it->second.second.GetMpdus (it->second.first.GetStartingSequence ()))
             {
-              if ((*mpduIt)->GetTimeStamp () + m_queue->GetMaxDelay () <= Simulator::Now ())
+              if (mpdu->GetTimeStamp () + m_queue->GetMaxDelay () <= Simulator::Now ())
                 {
                   // MPDU expired
-                  it->second.first.NotifyDiscardedMpdu (*mpduIt);
-                  mpduIt = it->second.second.erase (mpduIt);
-                }
-              else
-                {
-                  mpduIt++;
+                  it->second.first.NotifyDiscardedMpdu (mpdu);
+                  it->second.second.Remove (mpdu);
                 }
             }
           // update BAR if the starting sequence number changed
@@ -364,19 +344,8 @@ BlockAckManager::GetNBufferedPackets (Mac48Address recipient, uint8_t tid) const
     {
       return 0;
     }
-  uint32_t nPackets = 0;
-  PacketQueueCI queueIt = (*it).second.second.begin ();
-  while (queueIt != (*it).second.second.end ())
-    {
-      uint16_t currentSeq = (*queueIt)->GetHeader ().GetSequenceNumber ();
-      nPackets++;
-      /* a fragmented packet must be counted as one packet */
-      while (queueIt != (*it).second.second.end () && (*queueIt)->GetHeader ().GetSequenceNumber () == currentSeq)
-        {
-          queueIt++;
-        }
-    }
-  return nPackets;
+  /* a fragmented packet must be counted as one packet */
+  return it->second.second.GetNSequenceNumbers ();
 }
 
 void
@@ -407,18 +376,7 @@ BlockAckManager::NotifyGotAck (Ptr<const WifiMacQueueItem> mpdu)
   NS_ASSERT (it != m_agreements.end ());
 
   // remove the acknowledged frame from the queue of outstanding packets
-  PacketQueueI queueIt = it->second.second.begin ();
-  while (queueIt != it->second.second.end ())
-    {
-      if ((*queueIt)->GetHeader ().GetSequenceNumber () == mpdu->GetHeader ().GetSequenceNumber ())
-        {
-          queueIt = it->second.second.erase (queueIt);
-        }
-      else
-      {
-        queueIt++;
-      }
-    }
+  it->second.second.Remove (mpdu->GetHeader ().GetSequenceNumber ());
 
   it->second.first.NotifyAckedMpdu (mpdu);
 }
@@ -438,18 +396,7 @@ BlockAckManager::NotifyMissedAck (Ptr<WifiMacQueueItem> mpdu)
 
   // remove the frame from the queue of outstanding packets (it will be re-inserted
   // if retransmitted)
-  PacketQueueI queueIt = it->second.second.begin ();
-  while (queueIt != it->second.second.end ())
-    {
-      if ((*queueIt)->GetHeader ().GetSequenceNumber () == mpdu->GetHeader ().GetSequenceNumber ())
-        {
-          queueIt = it->second.second.erase (queueIt);
-        }
-      else
-      {
-        queueIt++;
-      }
-    }
+  it->second.second.Remove (mpdu->GetHeader ().GetSequenceNumber ());
 
   // insert in the retransmission queue
   InsertInRetryQueue (mpdu);
@@ -468,7 +415,6 @@ BlockAckManager::NotifyGotBlockAck (const CtrlBAckResponseHeader *blockAck, Mac4
           uint16_t nSuccessfulMpdus = 0;
           uint16_t nFailedMpdus = 0;
           AgreementsI it = m_agreements.find (std::make_pair (recipient, tid));
-          PacketQueueI queueEnd = it->second.second.end ();
 
           if (it->second.first.m_inactivityEvent.IsRunning ())
             {
@@ -486,13 +432,22 @@ BlockAckManager::NotifyGotBlockAck (const CtrlBAckResponseHeader *blockAck, Mac4
           uint16_t currentStartingSeq = it->second.first.GetStartingSequence ();
           uint16_t currentSeq = SEQNO_SPACE_SIZE;   // invalid value
 
+          std::vector<Ptr<WifiMacQueueItem>> mpdus;
+
+          if (blockAck->IsBasic () || blockAck->IsCompressed () || blockAck->IsExtendedCompressed ())
+            {
+              // whatever their fate, the packets are no longer outstanding
+              mpdus = it->second.second.GetMpdus (currentStartingSeq);
+              it->second.second.Clear ();
+            }
+
           if (blockAck->IsBasic ())
             {
-              for (PacketQueueI queueIt = it->second.second.begin (); queueIt != queueEnd; )
+              for (auto& mpdu : mpdus)
                 {
-                  currentSeq = (*queueIt)->GetHeader ().GetSequenceNumber ();
+                  currentSeq = mpdu->GetHeader ().GetSequenceNumber ();
                   if (blockAck->IsFragmentReceived (currentSeq,
-                                                    (*queueIt)->GetHeader ().GetFragmentNumber ()))
+                                                    mpdu->GetHeader ().GetFragmentNumber ()))
                     {
                       nSuccessfulMpdus++;
                     }
@@ -504,10 +459,8 @@ BlockAckManager::NotifyGotBlockAck (const CtrlBAckResponseHeader *blockAck, Mac4
                           RemoveOldPackets (recipient, tid, currentSeq);
                         }
                       nFailedMpdus++;
-                      InsertInRetryQueue (*queueIt);
+                      InsertInRetryQueue (mpdu);
                     }
-                  // in any case, this packet is no longer outstanding
-                  queueIt = it->second.second.erase (queueIt);
                 }
               // If all frames were acknowledged, move the transmit window past the last one
               if (!foundFirstLost && currentSeq != SEQNO_SPACE_SIZE)
@@ -517,16 +470,16 @@ BlockAckManager::NotifyGotBlockAck (const CtrlBAckResponseHeader *blockAck, Mac4
             }
           else if (blockAck->IsCompressed () || blockAck->IsExtendedCompressed ())
             {
-              for (PacketQueueI queueIt = it->second.second.begin (); queueIt != queueEnd; )
+              for (auto& mpdu : mpdus)
                 {
-                  currentSeq = (*queueIt)->GetHeader ().GetSequenceNumber ();
+                  currentSeq = mpdu->GetHeader ().GetSequenceNumber ();
                   if (blockAck->IsPacketReceived (currentSeq))
                     {
-                      it->second.first.NotifyAckedMpdu (*queueIt);
+                      it->second.first.NotifyAckedMpdu (mpdu);
                       nSuccessfulMpdus++;
                       if (!m_txOkCallback.IsNull ())
                         {
-                          m_txOkCallback (*queueIt);
+                          m_txOkCallback (mpdu);
                         }
                     }
                   else if (!QosUtilsIsOldPacket (currentStartingSeq, currentSeq))
@@ -534,12 +487,10 @@ BlockAckManager::NotifyGotBlockAck (const CtrlBAckResponseHeader *blockAck, Mac4
                       nFailedMpdus++;
                       if (!m_txFailedCallback.IsNull ())
                         {
-                          m_txFailedCallback (*queueIt);
+                          m_txFailedCallback (mpdu);
                         }
-                      InsertInRetryQueue (*queueIt);
+                      InsertInRetryQueue (mpdu);
                     }
-                  // in any case, this packet is no longer outstanding
-                  queueIt = it->second.second.erase (queueIt);
                 }
             }
           m_stationManager->ReportAmpduTxStatus (recipient, nSuccessfulMpdus, nFailedMpdus, rxSnr, dataSnr, dataTxVector);
@@ -559,14 +510,14 @@ BlockAckManager::NotifyMissedBlockAck (Mac48Address recipient, uint8_t tid)
   if (ExistsAgreementInState (recipient, tid, OriginatorBlockAckAgreement::ESTABLISHED))
     {
       AgreementsI it = m_agreements.find (std::make_pair (recipient, tid));
-      for (auto& item : it->second.second)
+      for (auto& item : it->second.second.GetMpdus (it->second.first.GetStartingSequence ()))
         {
           // Queue previously transmitted packets that do not already exist in the retry queue.
           InsertInRetryQueue (item);
         }
       // remove all packets from the queue of outstanding packets (they will be
       // re-inserted if retransmitted)
-      it->second.second.clear ();
+      it->second.second.Clear ();
     }
 }
 
@@ -577,19 +528,22 @@ BlockAckManager::DiscardOutstandingMpdus (Mac48Address recipient, uint8_t tid)
   if (ExistsAgreementInState (recipient, tid, OriginatorBlockAckAgreement::ESTABLISHED))
     {
       AgreementsI it = m_agreements.find (std::make_pair (recipient, tid));
-      while (!it->second.second.empty ())
+      // discarding an MPDU also removes the outstanding MPDUs preceding it and
+      // advances the starting sequence number, hence the MPDUs that follow
+      // can only become old
+      for (auto& mpdu : it->second.second.GetMpdus (it->second.first.GetStartingSequence ()))
         {
-          Ptr<WifiMacQueueItem> mpdu = it->second.second.front ();
           if (it->second.first.GetDistance (mpdu->GetHeader ().GetSequenceNumber ()) >= SEQNO_SPACE_HALF_SIZE)
             {
               // old packet
-              it->second.second.pop_front ();
+              it->second.second.Remove (mpdu);
             }
           else
             {
               NotifyDiscardedMpdu (mpdu);
             }
         }
+      NS_ASSERT (it->second.second.IsEmpty ());
     }
 }
 
@@ -801,7 +755,7 @@ bool BlockAckManager::NeedBarRetransmission (uint8_t tid, Mac48Address recipient
       NS_ASSERT (it != m_agreements.end ());
 
       // A BAR needs to be retransmitted if there is at least a non-expired outstanding MPDU
-      for (auto& mpdu : it->second.second)
+      for (auto& mpdu : it->second.second.GetMpdus (it->second.first.GetStartingSequence ()))
         {
           if (mpdu->GetTimeStamp () + m_queue->GetMaxDelay () > Simulator::Now ())
             {
@@ -872,21 +826,7 @@ BlockAckManager::RemoveOldPackets (Mac48Address recipient, uint8_t tid, uint16_t
   RemoveFromRetryQueue (recipient, tid, currStartingSeq, lastRemovedSeq);
 
   // remove packets that will become old from the queue of outstanding packets
-  PacketQueueI it = agreementIt->second.second.begin ();
-  while (it != agreementIt->second.second.end ())
-    {
-      uint16_t itSeq = (*it)->GetHeader ().GetSequenceNumber ();
-
-      if (agreementIt->second.first.GetDistance (itSeq) <= agreementIt->second.first.GetDistance (lastRemovedSeq))
-        {
-          NS_LOG_DEBUG ("Removing frame with seqnum = " << itSeq);
-          it = agreementIt->second.second.erase (it);
-        }
-      else
-        {
-          it++;
-        }
-    }
+  agreementIt->second.second.RemoveRange (currStartingSeq, lastRemovedSeq);
 }
 
 void
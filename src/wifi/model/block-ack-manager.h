@@ -27,6 +27,7 @@
 #include "wifi-mac-header.h"
 #include "originator-block-ack-agreement.h"
 #include "block-ack-type.h"
+#include "outstanding-mpdu-buffer.h"
 #include "wifi-mac-queue-item.h"
 #include "wifi-tx-vector.h"
 
@@ -450,33 +451,21 @@ private:
    */
   void RemoveOldPackets (Mac48Address recipient, uint8_t tid, uint16_t startingSeq);
 
-  /**
-   * typedef for a list of WifiMacQueueItem.
-   */
-  typedef std::list<Ptr<WifiMacQueueItem>> PacketQueue;
-  /**
-   * typedef for an iterator for PacketQueue.
-   */
-  typedef std::list<Ptr<WifiMacQueueItem>>::iterator PacketQueueI;
-  /**
-   * typedef for a const iterator for PacketQueue.
-   */
-  typedef std::list<Ptr<WifiMacQueueItem>>::const_iterator PacketQueueCI;
   /**
    * typedef for a map between MAC address and block ack agreement.
    */
   typedef std::map<std::pair<Mac48Address, uint8_t>,
-                   std::pair<OriginatorBlockAckAgreement, PacketQueue> > Agreements;
+                   std::pair<OriginatorBlockAckAgreement, OutstandingMpduBuffer> > Agreements;
   /**
    * typedef for an iterator for Agreements.
    */
   typedef std::map<std::pair<Mac48Address, uint8_t>,
-                   std::pair<OriginatorBlockAckAgreement, PacketQueue> >::iterator AgreementsI;
+                   std::pair<OriginatorBlockAckAgreement, OutstandingMpduBuffer> >::iterator AgreementsI;
   /**
    * typedef for a const iterator for Agreements.
    */
   typedef std::map<std::pair<Mac48Address, uint8_t>,
-                   std::pair<OriginatorBlockAckAgreement, PacketQueue> >::const_iterator AgreementsCI;
+                   std::pair<OriginatorBlockAckAgreement, OutstandingMpduBuffer> >::const_iterator AgreementsCI;
 
   /**
    * \param mpdu the packet to insert in the retransmission queue
@@ -0,0 +1,285 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2021
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <algorithm>
+#include "ns3/log.h"
+#include "ns3/packet.h"
+#include "outstanding-mpdu-buffer.h"
+#include "wifi-mac-queue-item.h"
+#include "wifi-utils.h"
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("OutstandingMpduBuffer");
+
+/// Initial size of the ring buffer (the size of a legacy Block Ack window)
+static const std::size_t INITIAL_SIZE = 64;
+
+OutstandingMpduBuffer::OutstandingMpduBuffer ()
+  : m_slots (INITIAL_SIZE),
+    m_mask (INITIAL_SIZE - 1),
+    m_first (0),
+    m_span (0),
+    m_nSeqs (0)
+{
+}
+
+void
+OutstandingMpduBuffer::Reserve (std::size_t size)
+{
+  NS_LOG_FUNCTION (this << size);
+  if (size > m_slots.size ())
+    {
+      Resize (size);
+    }
+}
+
+OutstandingMpduBuffer::Slot&
+OutstandingMpduBuffer::GetSlot (uint16_t seq)
+{
+  return m_slots[seq & m_mask];
+}
+
+bool
+OutstandingMpduBuffer::IsStored (uint16_t seq) const
+{
+  const Slot& slot = m_slots[seq & m_mask];
+  return !slot.empty () && slot.front ()->GetHeader ().GetSequenceNumber () == seq;
+}
+
+void
+OutstandingMpduBuffer::Resize (std::size_t size)
+{
+  NS_LOG_FUNCTION (this << size);
+  NS_ASSERT (size <= SEQNO_SPACE_SIZE);
+  std::size_t newSize = m_slots.size ();
+  while (newSize < size)
+    {
+      newSize *= 2;
+    }
+  std::vector<Slot> slots (newSize);
+  for (auto& slot : m_slots)
+    {
+      if (!slot.empty ())
+        {
+          slots[slot.front ()->GetHeader ().GetSequenceNumber () & (newSize - 1)].swap (slot);
+        }
+    }
+  m_slots.swap (slots);
+  m_mask = newSize - 1;
+}
+
+bool
+OutstandingMpduBuffer::Insert (Ptr<WifiMacQueueItem> mpdu)
+{
+  NS_LOG_FUNCTION (this << *mpdu);
+  uint16_t seq = mpdu->GetHeader ().GetSequenceNumber ();
+
+  if (m_nSeqs == 0)
+    {
+      m_first = seq;
+      m_span = 1;
+    }
+  else
+    {
+      std::size_t offset = (seq - m_first + SEQNO_SPACE_SIZE) % SEQNO_SPACE_SIZE;
+      if (offset >= m_span)
+        {
+          // extend the span forward or backward, whichever keeps it shorter
+          std::size_t forward = offset + 1;
+          std::size_t backward = m_span + SEQNO_SPACE_SIZE - offset;
+          std::size_t span = std::min (forward, backward);
+          if (span > m_slots.size ())
+            {
+              Resize (span);
+            }
+          if (backward < forward)
+            {
+              m_first = seq;
+            }
+          m_span = span;
+        }
+    }
+
+  Slot& slot = GetSlot (seq);
+  if (slot.empty ())
+    {
+      m_nSeqs++;
+    }
+  uint8_t fragment = mpdu->GetHeader ().GetFragmentNumber ();
+  auto it = slot.begin ();
+  while (it != slot.end () && (*it)->GetHeader ().GetFragmentNumber () < fragment)
+    {
+      it++;
+    }
+  if (it != slot.end () && (*it)->GetHeader ().GetFragmentNumber () == fragment)
+    {
+      NS_LOG_DEBUG ("MPDU already stored");
+      return false;
+    }
+  slot.insert (it, mpdu);
+  return true;
+}
+
+void
+OutstandingMpduBuffer::ClearSlot (uint16_t seq)
+{
+  GetSlot (seq).clear ();
+  if (--m_nSeqs == 0)
+    {
+      m_span = 0;
+      return;
+    }
+  while (!IsStored (m_first))
+    {
+      m_first = (m_first + 1) % SEQNO_SPACE_SIZE;
+      m_span--;
+    }
+  while (!IsStored ((m_first + m_span - 1) % SEQNO_SPACE_SIZE))
+    {
+      m_span--;
+    }
+}
+
+void
+OutstandingMpduBuffer::Remove (uint16_t seq)
+{
+  NS_LOG_FUNCTION (this << seq);
+  if (IsStored (seq))
+    {
+      ClearSlot (seq);
+    }
+}
+
+void
+OutstandingMpduBuffer::Remove (Ptr<const WifiMacQueueItem> mpdu)
+{
+  NS_LOG_FUNCTION (this << *mpdu);
+  uint16_t seq = mpdu->GetHeader ().GetSequenceNumber ();
+  if (!IsStored (seq))
+    {
+      return;
+    }
+  Slot& slot = GetSlot (seq);
+  for (auto it = slot.begin (); it != slot.end (); it++)
+    {
+      if ((*it)->GetHeader ().GetFragmentNumber () == mpdu->GetHeader ().GetFragmentNumber ())
+        {
+          slot.erase (it);
+          break;
+        }
+    }
+  if (slot.empty ())
+    {
+      ClearSlot (seq);
+    }
+}
+
+void
+OutstandingMpduBuffer::RemoveRange (uint16_t startSeq, uint16_t endSeq)
+{
+  NS_LOG_FUNCTION (this << startSeq << endSeq);
+  std::size_t count = (endSeq - startSeq + SEQNO_SPACE_SIZE) % SEQNO_SPACE_SIZE + 1;
+
+  if (count <= m_span)
+    {
+      for (std::size_t i = 0; i < count; i++)
+        {
+          Remove (static_cast<uint16_t> ((startSeq + i) % SEQNO_SPACE_SIZE));
+        }
+      return;
+    }
+  // the range is wider than the span of the stored sequence numbers
+  uint16_t first = m_first;
+  std::size_t span = m_span;
+  for (std::size_t i = 0; i < span; i++)
+    {
+      uint16_t seq = (first + i) % SEQNO_SPACE_SIZE;
+      std::size_t dist = (seq - startSeq + SEQNO_SPACE_SIZE) % SEQNO_SPACE_SIZE;
+      if (dist < count)
+        {
+          Remove (seq);
+        }
+    }
+}
+
+void
+OutstandingMpduBuffer::Clear (void)
+{
+  NS_LOG_FUNCTION (this);
+  for (std::size_t i = 0; i < m_span; i++)
+    {
+      GetSlot ((m_first + i) % SEQNO_SPACE_SIZE).clear ();
+    }
+  m_span = 0;
+  m_nSeqs = 0;
+}
+
+bool
+OutstandingMpduBuffer::IsEmpty (void) const
+{
+  return m_nSeqs == 0;
+}
+
+std::size_t
+OutstandingMpduBuffer::GetNSequenceNumbers (void) const
+{
+  return m_nSeqs;
+}
+
+std::vector<Ptr<WifiMacQueueItem>>
+OutstandingMpduBuffer::GetMpdus (uint16_t startingSeq) const
+{
+  NS_LOG_FUNCTION (this << startingSeq);
+  std::vector<Ptr<WifiMacQueueItem>> mpdus;
+  if (m_nSeqs == 0)
+    {
+      return mpdus;
+    }
+  mpdus.reserve (m_nSeqs);
+
+  // Walk the span from the first stored sequence number. Distances from the
+  // starting sequence number grow along the span, except for a single wrap
+  // around; the MPDUs after the wrap around come first.
+  std::size_t firstDist = (m_first - startingSeq + SEQNO_SPACE_SIZE) % SEQNO_SPACE_SIZE;
+  std::size_t wrap = 0;
+  bool wrapped = false;
+  for (std::size_t i = 0; i < m_span; i++)
+    {
+      uint16_t seq = (m_first + i) % SEQNO_SPACE_SIZE;
+      if (!IsStored (seq))
+        {
+          continue;
+        }
+      std::size_t dist = (seq - startingSeq + SEQNO_SPACE_SIZE) % SEQNO_SPACE_SIZE;
+      if (!wrapped && dist < firstDist)
+        {
+          wrapped = true;
+          wrap = mpdus.size ();
+        }
+      const Slot& slot = m_slots[seq & m_mask];
+      mpdus.insert (mpdus.end (), slot.begin (), slot.end ());
+    }
+  if (wrapped)
+    {
+      std::rotate (mpdus.begin (), mpdus.begin () + wrap, mpdus.end ());
+    }
+  return mpdus;
+}
+
+} //namespace ns3
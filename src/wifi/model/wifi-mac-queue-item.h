@@ -194,6 +194,7 @@ private:
   Time m_tstamp;                                //!< timestamp when the packet arrived at the queue
   DeaggregatedMsdus m_msduList;                 //!< The list of aggregated MSDUs included in this MPDU
   std::list<QueueIteratorPair> m_queueIts;      //!< Queue iterators pointing to this MSDU(s), if queued
+  uint64_t m_queueOrder;                        //!< Position in the order of the queue storing this item, if queued
 };
 
 /**
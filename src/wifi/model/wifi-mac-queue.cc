@@ -25,6 +25,8 @@
 #include "wifi-mac-queue.h"
 #include "qos-blocked-destinations.h"
 #include <functional>
+#include <algorithm>
+#include <limits>
 
 namespace ns3 {
 
@@ -33,6 +35,11 @@ NS_LOG_COMPONENT_DEFINE ("WifiMacQueue");
 NS_OBJECT_ENSURE_REGISTERED (WifiMacQueue);
 NS_OBJECT_TEMPLATE_CLASS_DEFINE (Queue, WifiMacQueueItem);
 
+/// Position number of the first item enqueued in an empty queue
+static const uint64_t ORDER_ORIGIN = static_cast<uint64_t> (1) << 63;
+/// Gap between the position numbers of consecutive items
+static const uint64_t ORDER_GAP = static_cast<uint64_t> (1) << 20;
+
 TypeId
 WifiMacQueue::GetTypeId (void)
 {
@@ -63,8 +70,7 @@ WifiMacQueue::GetTypeId (void)
 }
 
 WifiMacQueue::WifiMacQueue ()
-  : m_expiredPacketsPresent (false),
-    NS_LOG_TEMPLATE_DEFINE ("WifiMacQueue")
+  : NS_LOG_TEMPLATE_DEFINE ("WifiMacQueue")
 {
 }
 
@@ -73,6 +79,9 @@ WifiMacQueue::~WifiMacQueue ()
   NS_LOG_FUNCTION_NOARGS ();
   m_nQueuedPackets.clear ();
   m_nQueuedBytes.clear ();
+  m_qosSubQueues.clear ();
+  m_otherSubQueue.clear ();
+  m_expiryHeap.clear ();
 }
 
 static std::list<Ptr<WifiMacQueueItem>> g_emptyWifiMacQueue;
@@ -92,12 +101,18 @@ WifiMacQueue::GetMaxDelay (void) const
   return m_maxDelay;
 }
 
+bool
+WifiMacQueue::IsExpired (ConstIterator it) const
+{
+  return Simulator::Now () > (*it)->GetTimeStamp () + m_maxDelay;
+}
+
 bool
 WifiMacQueue::TtlExceeded (ConstIterator &it)
 {
   NS_LOG_FUNCTION (this);
 
-  if (Simulator::Now () > (*it)->GetTimeStamp () + m_maxDelay)
+  if (IsExpired (it))
     {
       NS_LOG_DEBUG ("Removing packet that stayed in the queue for too long (" <<
                     Simulator::Now () - (*it)->GetTimeStamp () << ")");
@@ -138,19 +153,10 @@ WifiMacQueue::Insert (ConstIterator pos, Ptr<WifiMacQueueItem> item)
       return DoEnqueue (pos, item);
     }
 
-  // the queue is full; scan the list in the attempt to remove stale packets
-  ConstIterator it = begin ();
-  while (it != end ())
+  // the queue is full; remove the first stale packet, if any
+  if (RemoveFirstExpired (pos))
     {
-      if (it == pos && TtlExceeded (it))
-        {
-          return DoEnqueue (it, item);
-        }
-      if (TtlExceeded (it))
-        {
-          return DoEnqueue (pos, item);
-        }
-      it++;
+      return DoEnqueue (pos, item);
     }
 
   // the queue is still full, remove the oldest item if the policy is drop oldest
@@ -244,38 +250,20 @@ WifiMacQueue::Dequeue (ConstIterator pos)
 {
   NS_LOG_FUNCTION (this);
 
-  if (!m_expiredPacketsPresent)
+  // remove stale items queued before the given position
+  RemoveExpired (pos);
+
+  if (pos == end ())
     {
-      if (TtlExceeded (pos))
-        {
-          NS_LOG_DEBUG ("Packet lifetime expired");
-          return 0;
-        }
-      return DoDequeue (pos);
+      NS_LOG_DEBUG ("Invalid iterator");
+      return 0;
     }
-
-  // remove stale items queued before the given position
-  ConstIterator it = begin ();
-  while (it != end ())
+  if (TtlExceeded (pos))
     {
-      if (it == pos)
-        {
-          // reset the flag signaling the presence of expired packets before returning
-          m_expiredPacketsPresent = false;
-
-          if (TtlExceeded (it))
-            {
-              return 0;
-            }
-          return DoDequeue (it);
-        }
-      else if (!TtlExceeded (it))
-        {
-          it++;
-        }
+      NS_LOG_DEBUG ("Packet lifetime expired");
+      return 0;
     }
-  NS_LOG_DEBUG ("Invalid iterator");
-  return 0;
+  return DoDequeue (pos);
 }
 
 Ptr<const WifiMacQueueItem>
@@ -286,12 +274,10 @@ WifiMacQueue::Peek (void) const
     {
       // skip packets that stayed in the queue for too long. They will be
       // actually removed from the queue by the next call to a non-const method
-      if (Simulator::Now () <= (*it)->GetTimeStamp () + m_maxDelay)
+      if (!IsExpired (it))
         {
           return DoPeek (it);
         }
-      // signal the presence of expired packets
-      m_expiredPacketsPresent = true;
     }
   NS_LOG_DEBUG ("The queue is empty");
   return 0;
@@ -301,83 +287,67 @@ WifiMacQueue::ConstIterator
 WifiMacQueue::PeekByAddress (Mac48Address dest, ConstIterator pos) const
 {
   NS_LOG_FUNCTION (this << dest);
-  ConstIterator it = (pos != EMPTY ? pos : begin ());
-  while (it != end ())
+  if (pos == end ())
     {
-      // skip packets that stayed in the queue for too long. They will be
-      // actually removed from the queue by the next call to a non-const method
-      if (Simulator::Now () <= (*it)->GetTimeStamp () + m_maxDelay)
+      return end ();
+    }
+
+  ConstIterator ret = end ();
+  for (uint8_t tid = 0; tid < 16; tid++)
+    {
+      auto subQueueIt = m_qosSubQueues.find ({dest, tid});
+      if (subQueueIt != m_qosSubQueues.end ())
         {
-          if (((*it)->GetHeader ().IsData () || (*it)->GetHeader ().IsQosData ())
-              && (*it)->GetDestinationAddress () == dest)
-            {
-              return it;
-            }
+          ret = GetFirst (ret, PeekSubQueue (subQueueIt->second, pos));
         }
-      else
+    }
+
+  // the frames other than QoS Data frames are not sorted by receiver
+  auto it = (pos != EMPTY ? m_otherSubQueue.lower_bound ((*pos)->m_queueOrder)
+                          : m_otherSubQueue.begin ());
+  for ( ; it != m_otherSubQueue.end (); it++)
+    {
+      if (ret != end () && it->first > (*ret)->m_queueOrder)
         {
-          // signal the presence of expired packets
-          m_expiredPacketsPresent = true;
+          break;
+        }
+      // skip packets that stayed in the queue for too long. They will be
+      // actually removed from the queue by the next call to a non-const method
+      if (!IsExpired (it->second) && (*it->second)->GetHeader ().IsData ()
+          && (*it->second)->GetDestinationAddress () == dest)
+        {
+          return it->second;
         }
-      it++;
     }
-  NS_LOG_DEBUG ("The queue is empty");
-  return end ();
+  return ret;
 }
 
 WifiMacQueue::ConstIterator
 WifiMacQueue::PeekByTid (uint8_t tid, ConstIterator pos) const
 {
   NS_LOG_FUNCTION (this << +tid);
-  ConstIterator it = (pos != EMPTY ? pos : begin ());
-  while (it != end ())
+  ConstIterator ret = end ();
+  for (const auto& subQueue : m_qosSubQueues)
     {
-      // skip packets that stayed in the queue for too long. They will be
-      // actually removed from the queue by the next call to a non-const method
-      if (Simulator::Now () <= (*it)->GetTimeStamp () + m_maxDelay)
-        {
-          if ((*it)->GetHeader ().IsQosData () && (*it)->GetHeader ().GetQosTid () == tid)
-            {
-              return it;
-            }
-        }
-      else
+      if (subQueue.first.second == tid)
         {
-          // signal the presence of expired packets
-          m_expiredPacketsPresent = true;
+          ret = GetFirst (ret, PeekSubQueue (subQueue.second, pos));
         }
-      it++;
     }
-  NS_LOG_DEBUG ("The queue is empty");
-  return end ();
+  return ret;
 }
 
 WifiMacQueue::ConstIterator
 WifiMacQueue::PeekByTidAndAddress (uint8_t tid, Mac48Address dest, ConstIterator pos) const
 {
   NS_LOG_FUNCTION (this << +tid << dest);
-  ConstIterator it = (pos != EMPTY ? pos : begin ());
-  while (it != end ())
+  auto subQueueIt = m_qosSubQueues.find ({dest, tid});
+  if (subQueueIt == m_qosSubQueues.end ())
     {
-      // skip packets that stayed in the queue for too long. They will be
-      // actually removed from the queue by the next call to a non-const method
-      if (Simulator::Now () <= (*it)->GetTimeStamp () + m_maxDelay)
-        {
-          if ((*it)->GetHeader ().IsQosData () && (*it)->GetDestinationAddress () == dest
-              && (*it)->GetHeader ().GetQosTid () == tid)
-            {
-              return it;
-            }
-        }
-      else
-        {
-          // signal the presence of expired packets
-          m_expiredPacketsPresent = true;
-        }
-      it++;
+      NS_LOG_DEBUG ("The queue is empty");
+      return end ();
     }
-  NS_LOG_DEBUG ("The queue is empty");
-  return end ();
+  return PeekSubQueue (subQueueIt->second, pos);
 }
 
 WifiMacQueue::ConstIterator
@@ -389,23 +359,34 @@ WifiMacQueue::PeekFirstAvailable (const Ptr<QosBlockedDestinations> blockedPacke
     {
       // skip packets that stayed in the queue for too long. They will be
       // actually removed from the queue by the next call to a non-const method
-      if (Simulator::Now () <= (*it)->GetTimeStamp () + m_maxDelay)
+      if (!IsExpired (it))
         {
           if (!(*it)->GetHeader ().IsQosData () || !blockedPackets
               || !blockedPackets->IsBlocked ((*it)->GetHeader ().GetAddr1 (), (*it)->GetHeader ().GetQosTid ()))
             {
               return it;
             }
+          break;
         }
-      else
+      it++;
+    }
+  if (it == end ())
+    {
+      NS_LOG_DEBUG ("The queue is empty");
+      return end ();
+    }
+
+  // the first packet is blocked, look for the first packet that is not in a
+  // blocked sub-queue rather than walking past all the blocked ones
+  ConstIterator ret = PeekSubQueue (m_otherSubQueue, it);
+  for (const auto& subQueue : m_qosSubQueues)
+    {
+      if (!blockedPackets->IsBlocked (subQueue.first.first, subQueue.first.second))
         {
-          // signal the presence of expired packets
-          m_expiredPacketsPresent = true;
+          ret = GetFirst (ret, PeekSubQueue (subQueue.second, it));
         }
-      it++;
     }
-  NS_LOG_DEBUG ("The queue is empty");
-  return end ();
+  return ret;
 }
 
 Ptr<WifiMacQueueItem>
@@ -458,25 +439,16 @@ WifiMacQueue::Remove (ConstIterator pos, bool removeExpired)
     }
 
   // remove stale items queued before the given position
-  ConstIterator it = begin ();
-  while (it != end ())
-    {
-      if (it == pos)
-        {
-          // reset the flag signaling the presence of expired packets before returning
-          m_expiredPacketsPresent = false;
+  RemoveExpired (pos);
 
-          ConstIterator curr = pos++;
-          DoRemove (curr);
-          return pos;
-        }
-      else if (!TtlExceeded (it))
-        {
-          it++;
-        }
+  if (pos == EMPTY || pos == end ())
+    {
+      NS_LOG_DEBUG ("Invalid iterator");
+      return end ();
     }
-  NS_LOG_DEBUG ("Invalid iterator");
-  return end ();
+  ConstIterator curr = pos++;
+  DoRemove (curr);
+  return pos;
 }
 
 uint32_t
@@ -484,18 +456,24 @@ WifiMacQueue::GetNPacketsByAddress (Mac48Address dest)
 {
   NS_LOG_FUNCTION (this << dest);
 
+  // remove packets that stayed in the queue for too long
+  RemoveExpired (end ());
+
   uint32_t nPackets = 0;
 
-  for (ConstIterator it = begin (); it != end (); )
+  for (uint8_t tid = 0; tid < 16; tid++)
     {
-      if (!TtlExceeded (it))
+      auto subQueueIt = m_qosSubQueues.find ({dest, tid});
+      if (subQueueIt != m_qosSubQueues.end ())
         {
-          if ((*it)->GetHeader ().IsData () && (*it)->GetDestinationAddress () == dest)
-            {
-              nPackets++;
-            }
-
-          it++;
+          nPackets += subQueueIt->second.size ();
+        }
+    }
+  for (const auto& item : m_otherSubQueue)
+    {
+      if ((*item.second)->GetHeader ().IsData () && (*item.second)->GetDestinationAddress () == dest)
+        {
+          nPackets++;
         }
     }
   NS_LOG_DEBUG ("returns " << nPackets);
@@ -506,20 +484,11 @@ uint32_t
 WifiMacQueue::GetNPacketsByTidAndAddress (uint8_t tid, Mac48Address dest)
 {
   NS_LOG_FUNCTION (this << dest);
-  uint32_t nPackets = 0;
-  for (ConstIterator it = begin (); it != end (); )
-    {
-      if (!TtlExceeded (it))
-        {
-          if ((*it)->GetHeader ().IsQosData () && (*it)->GetDestinationAddress () == dest
-              && (*it)->GetHeader ().GetQosTid () == tid)
-            {
-              nPackets++;
-            }
 
-          it++;
-        }
-    }
+  // remove packets that stayed in the queue for too long
+  RemoveExpired (end ());
+
+  uint32_t nPackets = GetNPackets (tid, dest);
   NS_LOG_DEBUG ("returns " << nPackets);
   return nPackets;
 }
@@ -545,13 +514,7 @@ WifiMacQueue::GetNPackets (void)
 {
   NS_LOG_FUNCTION (this);
   // remove packets that stayed in the queue for too long
-  for (ConstIterator it = begin (); it != end (); )
-    {
-      if (!TtlExceeded (it))
-        {
-          it++;
-        }
-    }
+  RemoveExpired (end ());
   return QueueBase::GetNPackets ();
 }
 
@@ -560,13 +523,7 @@ WifiMacQueue::GetNBytes (void)
 {
   NS_LOG_FUNCTION (this);
   // remove packets that stayed in the queue for too long
-  for (ConstIterator it = begin (); it != end (); )
-    {
-      if (!TtlExceeded (it))
-        {
-          it++;
-        }
-    }
+  RemoveExpired (end ());
   return QueueBase::GetNBytes ();
 }
 
@@ -615,6 +572,7 @@ WifiMacQueue::DoEnqueue (ConstIterator pos, Ptr<WifiMacQueueItem> item)
         }
       // set item's information about its position in the queue
       item->m_queueIts = {{this, ret}};
+      AddToIndex (ret);
       return true;
     }
   return false;
@@ -623,6 +581,11 @@ WifiMacQueue::DoEnqueue (ConstIterator pos, Ptr<WifiMacQueueItem> item)
 Ptr<WifiMacQueueItem>
 WifiMacQueue::DoDequeue (ConstIterator pos)
 {
+  if (pos != end ())
+    {
+      RemoveFromIndex (pos);
+    }
+
   Ptr<WifiMacQueueItem> item = Queue<WifiMacQueueItem>::DoDequeue (pos);
 
   if (item != 0 && item->GetHeader ().IsQosData ())
@@ -648,6 +611,11 @@ WifiMacQueue::DoDequeue (ConstIterator pos)
 Ptr<WifiMacQueueItem>
 WifiMacQueue::DoRemove (ConstIterator pos)
 {
+  if (pos != end ())
+    {
+      RemoveFromIndex (pos);
+    }
+
   Ptr<WifiMacQueueItem> item = Queue<WifiMacQueueItem>::DoRemove (pos);
 
   if (item != 0 && item->GetHeader ().IsQosData ())
@@ -670,4 +638,280 @@ WifiMacQueue::DoRemove (ConstIterator pos)
   return item;
 }
 
+WifiMacQueue::ConstIterator
+WifiMacQueue::PeekSubQueue (const SubQueue& subQueue, ConstIterator pos) const
+{
+  if (pos == end ())
+    {
+      return end ();
+    }
+  auto it = (pos != EMPTY ? subQueue.lower_bound ((*pos)->m_queueOrder) : subQueue.begin ());
+  for ( ; it != subQueue.end (); it++)
+    {
+      // skip packets that stayed in the queue for too long. They will be
+      // actually removed from the queue by the next call to a non-const method
+      if (!IsExpired (it->second))
+        {
+          return it->second;
+        }
+    }
+  return end ();
+}
+
+WifiMacQueue::ConstIterator
+WifiMacQueue::GetFirst (ConstIterator a, ConstIterator b) const
+{
+  if (a == end ())
+    {
+      return b;
+    }
+  if (b == end ())
+    {
+      return a;
+    }
+  return ((*a)->m_queueOrder <= (*b)->m_queueOrder ? a : b);
+}
+
+void
+WifiMacQueue::AddToIndex (ConstIterator it)
+{
+  ConstIterator next = std::next (it);
+  uint64_t order;
+
+  if (it == begin ())
+    {
+      if (next == end ())
+        {
+          order = ORDER_ORIGIN;
+        }
+      else if ((*next)->m_queueOrder >= ORDER_GAP)
+        {
+          order = (*next)->m_queueOrder - ORDER_GAP;
+        }
+      else
+        {
+          Reindex ();
+          return;
+        }
+    }
+  else
+    {
+      uint64_t prevOrder = (*std::prev (it))->m_queueOrder;
+      if (next == end ())
+        {
+          if (prevOrder > std::numeric_limits<uint64_t>::max () - ORDER_GAP)
+            {
+              Reindex ();
+              return;
+            }
+          order = prevOrder + ORDER_GAP;
+        }
+      else if ((*next)->m_queueOrder - prevOrder >= 2)
+        {
+          order = prevOrder + ((*next)->m_queueOrder - prevOrder) / 2;
+        }
+      else
+        {
+          Reindex ();
+          return;
+        }
+    }
+
+  Ptr<WifiMacQueueItem> item = *it;
+  item->m_queueOrder = order;
+  bool qosData = item->GetHeader ().IsQosData ();
+  WifiAddressTidPair addressTidPair;
+  if (qosData)
+    {
+      addressTidPair = {item->GetHeader ().GetAddr1 (), item->GetHeader ().GetQosTid ()};
+      m_qosSubQueues[addressTidPair].emplace_hint (m_qosSubQueues[addressTidPair].end (), order, it);
+    }
+  else
+    {
+      m_otherSubQueue.emplace_hint (m_otherSubQueue.end (), order, it);
+    }
+
+  // the entries of the items that left the queue are only dropped from the
+  // heap once they expire, so rebuild the heap if they pile up
+  if (m_expiryHeap.size () >= 2 * QueueBase::GetNPackets () + 64)
+    {
+      Reindex ();
+      return;
+    }
+  m_expiryHeap.push_back ({item->GetTimeStamp (), order, qosData, addressTidPair});
+  std::push_heap (m_expiryHeap.begin (), m_expiryHeap.end (), ExpiryCompare ());
+}
+
+void
+WifiMacQueue::RemoveFromIndex (ConstIterator it)
+{
+  Ptr<const WifiMacQueueItem> item = *it;
+  if (item->GetHeader ().IsQosData ())
+    {
+      auto subQueueIt = m_qosSubQueues.find ({item->GetHeader ().GetAddr1 (),
+                                              item->GetHeader ().GetQosTid ()});
+      NS_ASSERT (subQueueIt != m_qosSubQueues.end ());
+      subQueueIt->second.erase (item->m_queueOrder);
+      if (subQueueIt->second.empty ())
+        {
+          m_qosSubQueues.erase (subQueueIt);
+        }
+    }
+  else
+    {
+      m_otherSubQueue.erase (item->m_queueOrder);
+    }
+}
+
+void
+WifiMacQueue::Reindex (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_qosSubQueues.clear ();
+  m_otherSubQueue.clear ();
+  m_expiryHeap.clear ();
+
+  uint64_t order = ORDER_ORIGIN;
+  for (ConstIterator it = begin (); it != end (); it++, order += ORDER_GAP)
+    {
+      (*it)->m_queueOrder = order;
+      bool qosData = (*it)->GetHeader ().IsQosData ();
+      WifiAddressTidPair addressTidPair;
+      if (qosData)
+        {
+          addressTidPair = {(*it)->GetHeader ().GetAddr1 (), (*it)->GetHeader ().GetQosTid ()};
+          m_qosSubQueues[addressTidPair].emplace_hint (m_qosSubQueues[addressTidPair].end (), order, it);
+        }
+      else
+        {
+          m_otherSubQueue.emplace_hint (m_otherSubQueue.end (), order, it);
+        }
+      m_expiryHeap.push_back ({(*it)->GetTimeStamp (), order, qosData, addressTidPair});
+    }
+  std::make_heap (m_expiryHeap.begin (), m_expiryHeap.end (), ExpiryCompare ());
+}
+
+WifiMacQueue::ConstIterator
+WifiMacQueue::FindQueuedItem (const ExpiryEntry& entry) const
+{
+  const SubQueue* subQueue = &m_otherSubQueue;
+  if (entry.qosData)
+    {
+      auto subQueueIt = m_qosSubQueues.find (entry.addressTidPair);
+      if (subQueueIt == m_qosSubQueues.end ())
+        {
+          return end ();
+        }
+      subQueue = &subQueueIt->second;
+    }
+  auto itemIt = subQueue->find (entry.order);
+  if (itemIt == subQueue->end () || (*itemIt->second)->GetTimeStamp () != entry.tstamp)
+    {
+      return end ();
+    }
+  return itemIt->second;
+}
+
+bool
+WifiMacQueue::RemoveFirstExpired (ConstIterator &pos)
+{
+  NS_LOG_FUNCTION (this);
+  Time now = Simulator::Now ();
+  std::vector<ExpiryEntry> expired;
+  ConstIterator first = end ();
+
+  // the heap returns the expired items by timestamp, hence all of them must
+  // be popped to find the one that comes first in the queue
+  while (!m_expiryHeap.empty () && now > m_expiryHeap.front ().tstamp + m_maxDelay)
+    {
+      ExpiryEntry entry = m_expiryHeap.front ();
+      std::pop_heap (m_expiryHeap.begin (), m_expiryHeap.end (), ExpiryCompare ());
+      m_expiryHeap.pop_back ();
+
+      // the item may have left the queue already
+      ConstIterator it = FindQueuedItem (entry);
+      if (it == end ())
+        {
+          continue;
+        }
+      if (first == end () || entry.order < (*first)->m_queueOrder)
+        {
+          first = it;
+        }
+      expired.push_back (entry);
+    }
+
+  // put back the entries of the items that are not removed
+  for (const auto& entry : expired)
+    {
+      if (entry.order != (*first)->m_queueOrder)
+        {
+          m_expiryHeap.push_back (entry);
+          std::push_heap (m_expiryHeap.begin (), m_expiryHeap.end (), ExpiryCompare ());
+        }
+    }
+
+  if (first == end ())
+    {
+      return false;
+    }
+  if (first == pos)
+    {
+      // TtlExceeded moves pos to the following item
+      return TtlExceeded (pos);
+    }
+  return TtlExceeded (first);
+}
+
+void
+WifiMacQueue::RemoveExpired (ConstIterator pos)
+{
+  NS_LOG_FUNCTION (this);
+  Time now = Simulator::Now ();
+  bool all = (pos == EMPTY || pos == end ());
+  std::vector<ConstIterator> expired;
+  std::vector<ExpiryEntry> queuedAfterPos;
+
+  while (!m_expiryHeap.empty () && now > m_expiryHeap.front ().tstamp + m_maxDelay)
+    {
+      ExpiryEntry entry = m_expiryHeap.front ();
+      std::pop_heap (m_expiryHeap.begin (), m_expiryHeap.end (), ExpiryCompare ());
+      m_expiryHeap.pop_back ();
+
+      // the item may have left the queue already
+      ConstIterator it = FindQueuedItem (entry);
+      if (it == end ())
+        {
+          continue;
+        }
+
+      if (all || entry.order < (*pos)->m_queueOrder)
+        {
+          expired.push_back (it);
+        }
+      else
+        {
+          queuedAfterPos.push_back (entry);
+        }
+    }
+
+  for (const auto& entry : queuedAfterPos)
+    {
+      m_expiryHeap.push_back (entry);
+      std::push_heap (m_expiryHeap.begin (), m_expiryHeap.end (), ExpiryCompare ());
+    }
+
+  // remove the expired items in the order they are queued
+  std::sort (expired.begin (), expired.end (),
+             [] (ConstIterator a, ConstIterator b) { return (*a)->m_queueOrder < (*b)->m_queueOrder; });
+  expired.erase (std::unique (expired.begin (), expired.end ()), expired.end ());
+  for (auto& it : expired)
+    {
+      NS_LOG_DEBUG ("Removing packet that stayed in the queue for too long (" <<
+                    now - (*it)->GetTimeStamp () << ")");
+      m_traceExpired (*it);
+      DoRemove (it);
+    }
+}
+
 } //namespace ns3
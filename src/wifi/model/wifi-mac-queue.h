@@ -27,6 +27,8 @@
 #include "wifi-mac-queue-item.h"
 #include "ns3/queue.h"
 #include <unordered_map>
+#include <map>
+#include <vector>
 #include "qos-utils.h"
 
 namespace ns3 {
@@ -55,6 +57,15 @@ extern template class Queue<WifiMacQueueItem>;
  * to verify whether or not it should be dropped. If
  * dot11EDCATableMSDULifetime has elapsed, it is dropped.
  * Otherwise, it is returned to the caller.
+ *
+ * Besides the list of all the items in arrival order, the queue keeps the
+ * QoS Data frames in per (receiver address, TID) sub-queues and the other
+ * frames in a sub-queue of their own, so that searching for the next frame
+ * for a given receiver and TID does not need to walk past the frames queued
+ * for other receivers. Each item is given a number increasing with its
+ * position in the queue to compare positions across sub-queues, and the
+ * timestamps of the items are kept in a heap to find the expired items
+ * without a scan of the queue.
  */
 class WifiMacQueue : public Queue<WifiMacQueueItem>
 {
@@ -262,7 +273,8 @@ public:
   ConstIterator Remove (ConstIterator pos, bool removeExpired = false);
   /**
    * Return the number of packets having destination address specified by
-   * <i>dest</i>. The complexity is linear in the size of the queue.
+   * <i>dest</i>. The complexity is linear in the number of frames in the
+   * queue that are not QoS Data frames.
    *
    * \param dest the given destination
    *
@@ -271,8 +283,8 @@ public:
   uint32_t GetNPacketsByAddress (Mac48Address dest);
   /**
    * Return the number of QoS packets having TID equal to <i>tid</i> and
-   * destination address equal to <i>dest</i>.  The complexity is linear in
-   * the size of the queue.
+   * destination address equal to <i>dest</i>.  The complexity in the average
+   * case is constant, plus the removal of the expired packets.
    *
    * \param tid the given TID
    * \param dest the given destination
@@ -331,6 +343,97 @@ public:
 
 
 private:
+  /// Items of a sub-queue, indexed by their position in the queue
+  typedef std::map<uint64_t, ConstIterator> SubQueue;
+
+  /// Entry of the heap of the timestamps of the queued items
+  struct ExpiryEntry
+  {
+    Time tstamp;                         //!< timestamp of the item
+    uint64_t order;                      //!< position of the item in the queue
+    bool qosData;                        //!< whether the item is a QoS Data frame
+    WifiAddressTidPair addressTidPair;   //!< receiver address and TID of a QoS Data frame
+  };
+
+  /// Comparison functor putting the oldest timestamp on top of the heap
+  struct ExpiryCompare
+  {
+    /**
+     * \param a the first entry
+     * \param b the second entry
+     * \return true if the timestamp of the first entry is more recent
+     */
+    bool operator() (const ExpiryEntry& a, const ExpiryEntry& b) const
+    {
+      return a.tstamp > b.tstamp;
+    }
+  };
+
+  /**
+   * \param it an iterator pointing to an item
+   * \return true if the lifetime of the item expired
+   */
+  bool IsExpired (ConstIterator it) const;
+  /**
+   * Return the first item of the given sub-queue that is not before the given
+   * position in the queue and whose lifetime has not expired.
+   *
+   * \param subQueue the sub-queue
+   * \param pos the position the search starts from (EMPTY for the head of the queue)
+   * \return an iterator pointing to the item, or end () if there is no such item
+   */
+  ConstIterator PeekSubQueue (const SubQueue& subQueue, ConstIterator pos) const;
+  /**
+   * Return the one of the two given positions that comes first in the queue,
+   * where end () comes last.
+   *
+   * \param a the first position
+   * \param b the second position
+   * \return the position coming first
+   */
+  ConstIterator GetFirst (ConstIterator a, ConstIterator b) const;
+  /**
+   * Set the position number of the item just inserted at the given position
+   * and add it to its sub-queue and to the expiry heap. All the items are
+   * numbered again if there is no room between the neighbors of the item.
+   *
+   * \param it the position of the item
+   */
+  void AddToIndex (ConstIterator it);
+  /**
+   * Remove the item at the given position from its sub-queue.
+   *
+   * \param it the position of the item
+   */
+  void RemoveFromIndex (ConstIterator it);
+  /**
+   * Number all the items again, evenly spaced, and rebuild the sub-queues
+   * and the expiry heap.
+   */
+  void Reindex (void);
+  /**
+   * Return the queued item the given entry of the expiry heap refers to.
+   *
+   * \param entry the entry of the expiry heap
+   * \return an iterator pointing to the item, or end () if the item left the queue
+   */
+  ConstIterator FindQueuedItem (const ExpiryEntry& entry) const;
+  /**
+   * Remove the expired item that comes first in the queue, if any.
+   *
+   * \param pos a position in the queue, moved to the following item if the
+   *            removed item is the one it points to
+   * \return true if an item is removed, false otherwise
+   */
+  bool RemoveFirstExpired (ConstIterator &pos);
+  /**
+   * Remove the expired items that are queued before the given position
+   * (all the expired items if the given position is end ()).
+   *
+   * \param pos the position
+   */
+  void RemoveExpired (ConstIterator pos);
+
   /**
    * Remove the item pointed to by the iterator <i>it</i> if it has been in the
    * queue for too long. If the item is removed, the iterator is updated to
@@ -371,7 +474,11 @@ private:
 
   Time m_maxDelay;                          //!< Time to live for packets in the queue
   DropPolicy m_dropPolicy;                  //!< Drop behavior of queue
-  mutable bool m_expiredPacketsPresent;     //!< True if expired packets are in the queue
+
+  /// QoS Data frames per (receiver address, TID) pair
+  std::unordered_map<WifiAddressTidPair, SubQueue, WifiAddressTidHash> m_qosSubQueues;
+  SubQueue m_otherSubQueue;                 //!< Frames other than QoS Data frames
+  std::vector<ExpiryEntry> m_expiryHeap;    //!< Heap of the timestamps of the queued items
 
   //!< Per (MAC address, TID) pair queued packets
   std::unordered_map<WifiAddressTidPair, uint32_t, WifiAddressTidHash> m_nQueuedPackets;
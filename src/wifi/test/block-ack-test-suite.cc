@@ -35,6 +35,8 @@
 #include "ns3/pointer.h"
 #include "ns3/recipient-block-ack-agreement.h"
 #include "ns3/mac-rx-middle.h"
+#include "ns3/outstanding-mpdu-buffer.h"
+#include "ns3/wifi-mac-queue-item.h"
 #include <list>
 
 using namespace ns3;
@@ -549,6 +551,111 @@ OriginatorBlockAckWindowTest::DoRun (void)
 }
 
 
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Test for the buffer of outstanding MPDUs of an originator
+ */
+class OutstandingMpduBufferTest : public TestCase
+{
+public:
+  OutstandingMpduBufferTest ();
+private:
+  virtual void DoRun ();
+  /**
+   * Create a QoS Data frame
+   * \param seq the sequence number
+   * \param frag the fragment number
+   * \return the QoS Data frame
+   */
+  Ptr<WifiMacQueueItem> CreateMpdu (uint16_t seq, uint8_t frag);
+  /**
+   * Check the sequence numbers returned by GetMpdus
+   * \param buffer the buffer of outstanding MPDUs
+   * \param startingSeq the starting sequence number
+   * \param expected the expected sequence and fragment numbers
+   */
+  void CheckMpdus (const OutstandingMpduBuffer& buffer, uint16_t startingSeq,
+                   std::vector<std::pair<uint16_t, uint8_t>> expected);
+};
+
+OutstandingMpduBufferTest::OutstandingMpduBufferTest ()
+  : TestCase ("Check the correctness of the buffer of outstanding MPDUs")
+{
+}
+
+Ptr<WifiMacQueueItem>
+OutstandingMpduBufferTest::CreateMpdu (uint16_t seq, uint8_t frag)
+{
+  WifiMacHeader hdr;
+  hdr.SetType (WIFI_MAC_QOSDATA);
+  hdr.SetSequenceNumber (seq);
+  hdr.SetFragmentNumber (frag);
+  return Create<WifiMacQueueItem> (Create<Packet> (), hdr);
+}
+
+void
+OutstandingMpduBufferTest::CheckMpdus (const OutstandingMpduBuffer& buffer, uint16_t startingSeq,
+                                       std::vector<std::pair<uint16_t, uint8_t>> expected)
+{
+  std::vector<Ptr<WifiMacQueueItem>> mpdus = buffer.GetMpdus (startingSeq);
+  NS_TEST_ASSERT_MSG_EQ (mpdus.size (), expected.size (), "Unexpected number of MPDUs");
+  for (std::size_t i = 0; i < mpdus.size (); i++)
+    {
+      NS_TEST_EXPECT_MSG_EQ (mpdus[i]->GetHeader ().GetSequenceNumber (), expected[i].first,
+                             "Unexpected sequence number at position " << i);
+      NS_TEST_EXPECT_MSG_EQ (+mpdus[i]->GetHeader ().GetFragmentNumber (), +expected[i].second,
+                             "Unexpected fragment number at position " << i);
+    }
+}
+
+void
+OutstandingMpduBufferTest::DoRun (void)
+{
+  OutstandingMpduBuffer buffer;
+  uint16_t startingSeq = 4090;
+
+  // store MPDUs out of order, across the wrap around of sequence numbers
+  NS_TEST_EXPECT_MSG_EQ (buffer.Insert (CreateMpdu (4095, 0)), true, "MPDU not stored");
+  Ptr<WifiMacQueueItem> first = CreateMpdu (4090, 0);
+  NS_TEST_EXPECT_MSG_EQ (buffer.Insert (first), true, "MPDU not stored");
+  NS_TEST_EXPECT_MSG_EQ (buffer.Insert (CreateMpdu (3, 1)), true, "MPDU not stored");
+  NS_TEST_EXPECT_MSG_EQ (buffer.Insert (CreateMpdu (3, 0)), true, "MPDU not stored");
+  NS_TEST_EXPECT_MSG_EQ (buffer.Insert (CreateMpdu (1, 0)), true, "MPDU not stored");
+  NS_TEST_EXPECT_MSG_EQ (buffer.Insert (CreateMpdu (4090, 0)), false, "Duplicate MPDU stored");
+  NS_TEST_EXPECT_MSG_EQ (buffer.GetNSequenceNumbers (), 4, "Fragments must be counted once");
+  CheckMpdus (buffer, startingSeq, {{4090, 0}, {4095, 0}, {1, 0}, {3, 0}, {3, 1}});
+
+  // an old MPDU comes after all the others
+  buffer.Insert (CreateMpdu (4080, 0));
+  CheckMpdus (buffer, startingSeq, {{4090, 0}, {4095, 0}, {1, 0}, {3, 0}, {3, 1}, {4080, 0}});
+  CheckMpdus (buffer, 4080, {{4080, 0}, {4090, 0}, {4095, 0}, {1, 0}, {3, 0}, {3, 1}});
+
+  // store an MPDU beyond the initial size of the buffer, which has to grow
+  buffer.Insert (CreateMpdu (200, 0));
+  CheckMpdus (buffer, startingSeq, {{4090, 0}, {4095, 0}, {1, 0}, {3, 0}, {3, 1}, {200, 0}, {4080, 0}});
+
+  buffer.Remove (3);
+  buffer.Remove (first);
+  NS_TEST_EXPECT_MSG_EQ (buffer.GetNSequenceNumbers (), 4, "Unexpected number of sequence numbers");
+  CheckMpdus (buffer, startingSeq, {{4095, 0}, {1, 0}, {200, 0}, {4080, 0}});
+
+  buffer.RemoveRange (startingSeq, 100);
+  CheckMpdus (buffer, startingSeq, {{200, 0}, {4080, 0}});
+
+  // a range wider than the stored sequence numbers
+  buffer.RemoveRange (0, 4095);
+  NS_TEST_EXPECT_MSG_EQ (buffer.IsEmpty (), true, "The buffer should be empty");
+
+  buffer.Insert (CreateMpdu (10, 0));
+  buffer.Insert (CreateMpdu (11, 0));
+  buffer.Clear ();
+  NS_TEST_EXPECT_MSG_EQ (buffer.IsEmpty (), true, "The buffer should be empty");
+  CheckMpdus (buffer, 10, {});
+}
+
+
 /**
  * \ingroup wifi-test
  * \ingroup tests
@@ -1204,6 +1311,7 @@ BlockAckTestSuite::BlockAckTestSuite ()
   AddTestCase (new PacketBufferingCaseA, TestCase::QUICK);
   AddTestCase (new PacketBufferingCaseB, TestCase::QUICK);
   AddTestCase (new OriginatorBlockAckWindowTest, TestCase::QUICK);
+  AddTestCase (new OutstandingMpduBufferTest, TestCase::QUICK);
   AddTestCase (new CtrlBAckResponseHeaderTest, TestCase::QUICK);
   AddTestCase (new BlockAckRecipientBufferTest (0), TestCase::QUICK);
   AddTestCase (new BlockAckRecipientBufferTest (4090), TestCase::QUICK);
@@ -20,6 +20,7 @@
 
 #include "ns3/test.h"
 #include "ns3/wifi-mac-queue.h"
+#include "ns3/qos-blocked-destinations.h"
 #include "ns3/simulator.h"
 
 using namespace ns3;
@@ -107,6 +108,203 @@ WifiMacQueueDropOldestTest::DoRun ()
   Simulator::Destroy ();
 }
 
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Test the searches by receiver address and TID.
+ *
+ * Frames for several receivers and TIDs are queued in an interleaved order,
+ * also in the middle of the queue, and the results of the searches are
+ * compared with those of a walk through the whole queue. The lifetime of
+ * some of the frames expires before the end of the test.
+ */
+class WifiMacQueueSubQueuesTest : public TestCase
+{
+public:
+  /**
+   * \brief Constructor
+   */
+  WifiMacQueueSubQueuesTest ();
+
+  void DoRun () override;
+
+private:
+  /**
+   * Enqueue a QoS Data frame.
+   *
+   * \param addr the receiver address
+   * \param tid the TID
+   */
+  void Enqueue (Mac48Address addr, uint8_t tid);
+  /**
+   * Check the results of the searches against a walk through the queue.
+   */
+  void CheckSearches (void);
+  /**
+   * Check that expired frames are dropped and no longer counted.
+   */
+  void CheckExpired (void);
+  /**
+   * Check that enqueuing a frame in a full queue removes only the first
+   * expired frame.
+   */
+  void CheckFullQueue (void);
+  /**
+   * Notify the expiration of a frame.
+   *
+   * \param item the expired frame
+   */
+  void NotifyExpired (Ptr<const WifiMacQueueItem> item);
+
+  Ptr<WifiMacQueue> m_queue;           ///< the queue
+  std::vector<Mac48Address> m_addrs;  ///< the receiver addresses
+  uint32_t m_nExpired;                 ///< the number of expired frames
+};
+
+WifiMacQueueSubQueuesTest::WifiMacQueueSubQueuesTest ()
+  : TestCase ("Test WifiMacQueue searches by receiver address and TID"),
+    m_nExpired (0)
+{
+}
+
+void
+WifiMacQueueSubQueuesTest::Enqueue (Mac48Address addr, uint8_t tid)
+{
+  WifiMacHeader header;
+  header.SetType (WIFI_MAC_QOSDATA);
+  header.SetAddr1 (addr);
+  header.SetQosTid (tid);
+  m_queue->Enqueue (Create<WifiMacQueueItem> (Create<Packet> (100), header));
+}
+
+void
+WifiMacQueueSubQueuesTest::NotifyExpired (Ptr<const WifiMacQueueItem> item)
+{
+  m_nExpired++;
+}
+
+void
+WifiMacQueueSubQueuesTest::CheckSearches (void)
+{
+  for (const auto& addr : m_addrs)
+    {
+      for (uint8_t tid = 0; tid < 2; tid++)
+        {
+          // walk through the queue and check that every frame of the pair is found
+          uint32_t count = 0;
+          WifiMacQueue::ConstIterator found = m_queue->PeekByTidAndAddress (tid, addr);
+          for (auto it = m_queue->begin (); it != m_queue->end (); it++)
+            {
+              // searching from any position returns the first frame of the pair
+              // not before that position
+              NS_TEST_EXPECT_MSG_EQ ((m_queue->PeekByTidAndAddress (tid, addr, it) == found), true,
+                                     "Unexpected frame found from a given position");
+              if ((*it)->GetHeader ().IsQosData () && (*it)->GetHeader ().GetAddr1 () == addr
+                  && (*it)->GetHeader ().GetQosTid () == tid)
+                {
+                  NS_TEST_ASSERT_MSG_EQ ((found == it), true, "Unexpected frame found");
+                  found = m_queue->PeekByTidAndAddress (tid, addr, std::next (it));
+                  count++;
+                }
+            }
+          NS_TEST_EXPECT_MSG_EQ ((found == m_queue->end ()), true, "Frame found past the last one");
+          NS_TEST_EXPECT_MSG_EQ (m_queue->GetNPacketsByTidAndAddress (tid, addr), count,
+                                 "Unexpected number of frames");
+        }
+      NS_TEST_EXPECT_MSG_EQ ((m_queue->PeekByAddress (addr) == m_queue->PeekByTidAndAddress (0, addr)
+                              || m_queue->PeekByAddress (addr) == m_queue->PeekByTidAndAddress (1, addr)),
+                             true, "Unexpected frame found by address");
+    }
+
+  // block all the receivers but the last one
+  Ptr<QosBlockedDestinations> blocked = Create<QosBlockedDestinations> ();
+  for (uint32_t i = 0; i + 1 < m_addrs.size (); i++)
+    {
+      blocked->Block (m_addrs[i], 0);
+      blocked->Block (m_addrs[i], 1);
+    }
+  WifiMacQueue::ConstIterator expected = m_queue->begin ();
+  while (expected != m_queue->end () && (*expected)->GetHeader ().GetAddr1 () != m_addrs.back ())
+    {
+      expected++;
+    }
+  NS_TEST_EXPECT_MSG_EQ ((m_queue->PeekFirstAvailable (blocked) == expected), true,
+                         "Unexpected first available frame");
+}
+
+void
+WifiMacQueueSubQueuesTest::CheckExpired (void)
+{
+  // the frames queued at time 0 expired, those queued at 600 ms did not
+  NS_TEST_EXPECT_MSG_EQ (m_queue->GetNPacketsByTidAndAddress (0, m_addrs[0]), 1,
+                         "Expired frames still counted");
+  // 60 frames queued at time 0, 2 of which were dequeued
+  NS_TEST_EXPECT_MSG_EQ (m_nExpired, 58, "Unexpected number of expired frames");
+  NS_TEST_EXPECT_MSG_EQ (m_queue->GetNPackets (), 3, "Unexpected number of frames");
+  CheckSearches ();
+}
+
+void
+WifiMacQueueSubQueuesTest::CheckFullQueue (void)
+{
+  // the three frames queued at 600 ms expired
+  m_queue->SetMaxSize (QueueSize ("3p"));
+  Enqueue (m_addrs[0], 0);
+  NS_TEST_EXPECT_MSG_EQ (m_nExpired, 59, "Only one expired frame must be removed");
+  NS_TEST_EXPECT_MSG_EQ (std::distance (m_queue->begin (), m_queue->end ()), 3,
+                         "Unexpected number of frames in the queue");
+  NS_TEST_EXPECT_MSG_EQ ((*m_queue->begin ())->GetHeader ().GetAddr1 (), m_addrs[1],
+                         "The first expired frame must have been removed");
+}
+
+void
+WifiMacQueueSubQueuesTest::DoRun ()
+{
+  m_queue = CreateObject<WifiMacQueue> ();
+  m_queue->SetMaxSize (QueueSize ("1000p"));
+  m_queue->SetMaxDelay (Seconds (1));
+  m_queue->TraceConnectWithoutContext ("Expired",
+                                       MakeCallback (&WifiMacQueueSubQueuesTest::NotifyExpired, this));
+
+  for (uint8_t i = 1; i <= 3; i++)
+    {
+      m_addrs.push_back (Mac48Address::Allocate ());
+    }
+
+  for (uint32_t n = 0; n < 20; n++)
+    {
+      Enqueue (m_addrs[n % 3], n % 2);
+    }
+  CheckSearches ();
+
+  // insert frames repeatedly at the same position in the middle of the queue,
+  // until the items have to be numbered again
+  WifiMacQueue::ConstIterator pos = std::next (m_queue->begin (), 10);
+  for (uint32_t n = 0; n < 40; n++)
+    {
+      WifiMacHeader header;
+      header.SetType (WIFI_MAC_QOSDATA);
+      header.SetAddr1 (m_addrs[n % 3]);
+      header.SetQosTid (1);
+      m_queue->Insert (pos, Create<WifiMacQueueItem> (Create<Packet> (100), header));
+    }
+  CheckSearches ();
+
+  // dequeue some frames from the middle of the queue
+  m_queue->DequeueByTidAndAddress (1, m_addrs[2]);
+  m_queue->DequeueByTidAndAddress (0, m_addrs[1]);
+  CheckSearches ();
+
+  Simulator::Schedule (MilliSeconds (600), &WifiMacQueueSubQueuesTest::Enqueue, this, m_addrs[0], 0);
+  Simulator::Schedule (MilliSeconds (600), &WifiMacQueueSubQueuesTest::Enqueue, this, m_addrs[1], 1);
+  Simulator::Schedule (MilliSeconds (600), &WifiMacQueueSubQueuesTest::Enqueue, this, m_addrs[2], 0);
+  Simulator::Schedule (MilliSeconds (1200), &WifiMacQueueSubQueuesTest::CheckExpired, this);
+  Simulator::Schedule (MilliSeconds (2000), &WifiMacQueueSubQueuesTest::CheckFullQueue, this);
+  Simulator::Run ();
+  Simulator::Destroy ();
+}
+
 /**
  * \ingroup wifi-test
  * \ingroup tests
@@ -123,6 +321,7 @@ WifiMacQueueTestSuite::WifiMacQueueTestSuite ()
   : TestSuite ("wifi-mac-queue", UNIT)
 {
   AddTestCase (new WifiMacQueueDropOldestTest, TestCase::QUICK);
+  AddTestCase (new WifiMacQueueSubQueuesTest, TestCase::QUICK);
 }
 
 static WifiMacQueueTestSuite g_wifiMacQueueTestSuite; ///< the test suite
@@ -0,0 +1,182 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2021
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program can be used to benchmark the packet queues: the containers
+// that can store the items of a Queue, and the DropTailQueue of the
+// point-to-point and csma net devices, for various numbers of packets 'n'.
+// The device benchmarks send bursts of packets, so that the device queues
+// fill up and drain.
+// Sample usage:  ./waf --run 'bench-queue --n=1000000'
+
+#include "ns3/command-line.h"
+#include "ns3/system-wall-clock-ms.h"
+#include "ns3/simulator.h"
+#include "ns3/packet.h"
+#include "ns3/ring-buffer.h"
+#include "ns3/node-container.h"
+#include "ns3/net-device-container.h"
+#include "ns3/point-to-point-helper.h"
+#include "ns3/csma-helper.h"
+#include "ns3/string.h"
+#include <iostream>
+#include <list>
+#include <limits>
+#include <algorithm>
+#include <stdlib.h> // for exit ()
+
+using namespace ns3;
+
+static uint32_t g_occupancy = 50;  //!< number of packets kept in the containers
+static uint32_t g_burst = 50;      //!< number of packets sent back to back to a device
+static uint32_t g_received = 0;    //!< number of packets received by the devices
+
+/**
+ * Keep a number of packets in a container while pushing and popping n packets.
+ * \param n the number of packets
+ */
+template <typename Container>
+static void
+benchContainer (uint32_t n)
+{
+  Container container;
+  Ptr<Packet> p = Create<Packet> (1000);
+  for (uint32_t i = 0; i < g_occupancy; i++)
+    {
+      container.push_back (p);
+    }
+  for (uint32_t i = 0; i < n; i++)
+    {
+      container.push_back (p);
+      container.pop_front ();
+    }
+}
+
+static bool
+receive (Ptr<NetDevice> device, Ptr<const Packet> packet, uint16_t protocol, const Address &from)
+{
+  g_received++;
+  return true;
+}
+
+static void
+sendBurst (Ptr<NetDevice> device, Address dest, uint32_t burst)
+{
+  for (uint32_t i = 0; i < burst; i++)
+    {
+      device->Send (Create<Packet> (1000), dest, 0x0800);
+    }
+}
+
+/**
+ * Send n packets from the first to the second device, in bursts.
+ * \param devices the devices
+ * \param n the number of packets
+ */
+static void
+benchDevices (NetDeviceContainer devices, uint32_t n)
+{
+  g_received = 0;
+  for (uint32_t i = 1; i < devices.GetN (); i++)
+    {
+      devices.Get (i)->SetReceiveCallback (MakeCallback (&receive));
+    }
+  // a burst takes 8 us per packet to drain at 1 Gbps
+  uint64_t intervalUs = 10 * g_burst;
+  uint32_t sent = 0;
+  for (uint64_t i = 0; sent < n; i++)
+    {
+      uint32_t burst = std::min (g_burst, n - sent);
+      Simulator::Schedule (MicroSeconds (intervalUs * i), &sendBurst,
+                           devices.Get (0), devices.Get (1)->GetAddress (), burst);
+      sent += burst;
+    }
+  Simulator::Run ();
+  Simulator::Destroy ();
+}
+
+static void
+benchPointToPoint (uint32_t n)
+{
+  NodeContainer nodes;
+  nodes.Create (2);
+  PointToPointHelper p2p;
+  p2p.SetDeviceAttribute ("DataRate", StringValue ("1Gbps"));
+  p2p.SetChannelAttribute ("Delay", StringValue ("1us"));
+  benchDevices (p2p.Install (nodes), n);
+}
+
+static void
+benchCsma (uint32_t n)
+{
+  NodeContainer nodes;
+  nodes.Create (4);
+  CsmaHelper csma;
+  csma.SetChannelAttribute ("DataRate", StringValue ("1Gbps"));
+  csma.SetChannelAttribute ("Delay", StringValue ("1us"));
+  benchDevices (csma.Install (nodes), n);
+}
+
+static void
+runBench (void (*bench) (uint32_t), uint32_t n, uint32_t minIterations, char const *name)
+{
+  uint64_t minDelay = std::numeric_limits<uint64_t>::max ();
+  for (uint32_t i = 0; i < minIterations; i++)
+    {
+      SystemWallClockMs time;
+      time.Start ();
+      (*bench) (n);
+      minDelay = std::min (minDelay, static_cast<uint64_t> (time.End ()));
+    }
+  double ps = n;
+  ps *= 1000;
+  ps /= std::max<uint64_t> (minDelay, 1);
+  std::cout << ps << " packets/s"
+            << " (" << minDelay << " ms elapsed)\t"
+            << name
+            << std::endl;
+}
+
+int main (int argc, char *argv[])
+{
+  uint32_t n = 0;
+  uint32_t minIterations = 1;
+
+  CommandLine cmd (__FILE__);
+  cmd.Usage ("Benchmark the packet queues");
+  cmd.AddValue ("n", "number of packets", n);
+  cmd.AddValue ("min-iterations", "number of subiterations to minimize iteration time over", minIterations);
+  cmd.AddValue ("occupancy", "number of packets kept in the containers", g_occupancy);
+  cmd.AddValue ("burst", "number of packets sent back to back to a device (at most the queue size)", g_burst);
+  cmd.Parse (argc, argv);
+
+  if (n == 0)
+    {
+      std::cerr << "Error-- number of packets must be specified " <<
+        "by command-line argument --n=(number of packets)" << std::endl;
+      exit (1);
+    }
+  std::cout << "Running bench-queue with n=" << n << std::endl;
+
+  runBench (&benchContainer<std::list<Ptr<Packet> > >, n, minIterations, "std::list container");
+  runBench (&benchContainer<RingBuffer<Ptr<Packet> > >, n, minIterations, "RingBuffer container");
+  runBench (&benchPointToPoint, n, minIterations, "PointToPointNetDevice");
+  runBench (&benchCsma, n, minIterations, "CsmaNetDevice");
+  std::cout << g_received << " packets received in the last run" << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,219 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2021
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program can be used to benchmark the LTE RLC entities: a transmitting
+// and a receiving LteRlcUm (or LteRlcAm) entity exchange 'n' SDUs through a
+// loopback MAC, which offers one transmission opportunity to each entity per
+// TTI. The SDUs are segmented and reassembled when they are larger than the
+// transmission opportunities, and concatenated when they are smaller.
+// Sample usage:  ./waf --run 'bench-rlc --n=100000 --sdu-size=1500 --tx-opportunity=100'
+
+#include "ns3/command-line.h"
+#include "ns3/system-wall-clock-ms.h"
+#include "ns3/simulator.h"
+#include "ns3/packet.h"
+#include "ns3/uinteger.h"
+#include "ns3/lte-rlc-um.h"
+#include "ns3/lte-rlc-am.h"
+#include "ns3/lte-rlc-sap.h"
+#include "ns3/lte-mac-sap.h"
+#include <iostream>
+#include <limits>
+#include <algorithm>
+#include <stdlib.h> // for exit ()
+
+using namespace ns3;
+
+static uint32_t g_sduSize = 1500;       //!< size of the SDUs
+static uint32_t g_txOpportunity = 100;  //!< size of the transmission opportunities
+static uint32_t g_backlog = 16;         //!< number of SDUs kept in flight
+
+/**
+ * A MAC that delivers the PDUs of an RLC entity to its peer entity.
+ */
+class LoopbackMac : public LteMacSapProvider
+{
+public:
+  LoopbackMac ()
+    : m_peer (0)
+  {
+  }
+  /**
+   * \param peer the MAC SAP user of the peer RLC entity
+   */
+  void SetPeer (LteMacSapUser *peer)
+  {
+    m_peer = peer;
+  }
+  virtual void TransmitPdu (TransmitPduParameters params)
+  {
+    m_peer->ReceivePdu (LteMacSapUser::ReceivePduParameters (params.pdu, params.rnti, params.lcid));
+  }
+  virtual void ReportBufferStatus (ReportBufferStatusParameters params)
+  {
+  }
+
+private:
+  LteMacSapUser *m_peer;  //!< the MAC SAP user of the peer RLC entity
+};
+
+/**
+ * A PDCP that counts the SDUs delivered by the RLC.
+ */
+class CountingPdcp : public LteRlcSapUser
+{
+public:
+  CountingPdcp ()
+    : m_received (0)
+  {
+  }
+  virtual void ReceivePdcpPdu (Ptr<Packet> p)
+  {
+    m_received++;
+  }
+
+  uint32_t m_received;  //!< number of SDUs received
+};
+
+/**
+ * A pair of RLC entities connected by loopback MACs.
+ */
+struct RlcLink
+{
+  Ptr<LteRlc> tx;       //!< the transmitting entity
+  Ptr<LteRlc> rx;       //!< the receiving entity
+  LoopbackMac txMac;    //!< the MAC of the transmitting entity
+  LoopbackMac rxMac;    //!< the MAC of the receiving entity
+  CountingPdcp txPdcp;  //!< the PDCP of the transmitting entity
+  CountingPdcp rxPdcp;  //!< the PDCP of the receiving entity
+  uint32_t sent;        //!< number of SDUs sent
+  uint32_t n;           //!< number of SDUs to send
+};
+
+static void
+tti (RlcLink *link)
+{
+  // keep the transmission buffer of the transmitting entity filled
+  while (link->sent < link->n && link->sent - link->rxPdcp.m_received < g_backlog)
+    {
+      LteRlcSapProvider::TransmitPdcpPduParameters params;
+      params.pdcpPdu = Create<Packet> (g_sduSize);
+      params.rnti = 1;
+      params.lcid = 1;
+      link->tx->GetLteRlcSapProvider ()->TransmitPdcpPdu (params);
+      link->sent++;
+    }
+  LteMacSapUser::TxOpportunityParameters params (g_txOpportunity, 0, 0, 0, 1, 1);
+  link->tx->GetLteMacSapUser ()->NotifyTxOpportunity (params);
+  // let the receiving entity send its STATUS PDUs, if any
+  link->rx->GetLteMacSapUser ()->NotifyTxOpportunity (params);
+  if (link->rxPdcp.m_received < link->n)
+    {
+      Simulator::Schedule (MilliSeconds (1), &tti, link);
+    }
+  else
+    {
+      Simulator::Stop ();
+    }
+}
+
+/**
+ * Send n SDUs from a transmitting to a receiving RLC entity.
+ * \param n the number of SDUs
+ */
+template <typename Rlc>
+static void
+benchRlc (uint32_t n)
+{
+  RlcLink link;
+  link.sent = 0;
+  link.n = n;
+  link.tx = CreateObject<Rlc> ();
+  link.rx = CreateObject<Rlc> ();
+  // only the UM entities limit the size of their transmission buffer
+  link.tx->SetAttributeFailSafe ("MaxTxBufferSize", UintegerValue (std::numeric_limits<uint32_t>::max ()));
+  link.tx->SetLteMacSapProvider (&link.txMac);
+  link.rx->SetLteMacSapProvider (&link.rxMac);
+  link.tx->SetLteRlcSapUser (&link.txPdcp);
+  link.rx->SetLteRlcSapUser (&link.rxPdcp);
+  link.txMac.SetPeer (link.rx->GetLteMacSapUser ());
+  link.rxMac.SetPeer (link.tx->GetLteMacSapUser ());
+  link.tx->SetRnti (1);
+  link.rx->SetRnti (1);
+  link.tx->SetLcId (1);
+  link.rx->SetLcId (1);
+
+  Simulator::ScheduleNow (&tti, &link);
+  Simulator::Run ();
+  Simulator::Destroy ();
+  if (link.rxPdcp.m_received != n)
+    {
+      std::cerr << "Error-- " << link.rxPdcp.m_received << " SDUs received out of " << n << std::endl;
+      exit (1);
+    }
+  link.tx->Dispose ();
+  link.rx->Dispose ();
+}
+
+static void
+runBench (void (*bench) (uint32_t), uint32_t n, uint32_t minIterations, char const *name)
+{
+  uint64_t minDelay = std::numeric_limits<uint64_t>::max ();
+  for (uint32_t i = 0; i < minIterations; i++)
+    {
+      SystemWallClockMs time;
+      time.Start ();
+      (*bench) (n);
+      minDelay = std::min (minDelay, static_cast<uint64_t> (time.End ()));
+    }
+  double ps = n;
+  ps *= 1000;
+  ps /= std::max<uint64_t> (minDelay, 1);
+  std::cout << ps << " SDUs/s"
+            << " (" << minDelay << " ms elapsed)\t"
+            << name
+            << std::endl;
+}
+
+int main (int argc, char *argv[])
+{
+  uint32_t n = 0;
+  uint32_t minIterations = 1;
+
+  CommandLine cmd (__FILE__);
+  cmd.Usage ("Benchmark the LTE RLC entities");
+  cmd.AddValue ("n", "number of SDUs", n);
+  cmd.AddValue ("min-iterations", "number of subiterations to minimize iteration time over", minIterations);
+  cmd.AddValue ("sdu-size", "size of the SDUs", g_sduSize);
+  cmd.AddValue ("tx-opportunity", "size of the transmission opportunities (at least 4 bytes)", g_txOpportunity);
+  cmd.AddValue ("backlog", "number of SDUs kept in flight", g_backlog);
+  cmd.Parse (argc, argv);
+
+  if (n == 0)
+    {
+      std::cerr << "Error-- number of SDUs must be specified " <<
+        "by command-line argument --n=(number of SDUs)" << std::endl;
+      exit (1);
+    }
+  std::cout << "Running bench-rlc with n=" << n << std::endl;
+
+  runBench (&benchRlc<LteRlcUm>, n, minIterations, "LteRlcUm");
+  runBench (&benchRlc<LteRlcAm>, n, minIterations, "LteRlcAm");
+
+  return 0;
+}